@@ -0,0 +1,65 @@
+# ******************************************************************************
+# Copyright 2017-2020 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ******************************************************************************
+
+# Sums the sizes of the ngraph::runtime::cpu::kernel symbols in the CPU backend library and
+# writes them to REPORT. If BASELINE names a report produced by an earlier build (for example
+# one configured with NGRAPH_CPU_OPTIMIZED_RANKS=all), the bytes saved are printed as well.
+#
+# Inputs: LIBRARY, REPORT, optional BASELINE
+
+find_program(NM_EXECUTABLE nm)
+if (NOT NM_EXECUTABLE)
+    message(FATAL_ERROR "nm is required for the CPU kernel size report")
+endif()
+
+execute_process(COMMAND ${NM_EXECUTABLE} -C -S --size-sort ${LIBRARY}
+    OUTPUT_VARIABLE SYMBOLS
+    RESULT_VARIABLE RESULT)
+if (NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "nm failed on ${LIBRARY}")
+endif()
+
+string(REPLACE "\n" ";" SYMBOLS "${SYMBOLS}")
+set(KERNEL_BYTES 0)
+set(KERNEL_COUNT 0)
+foreach(LINE ${SYMBOLS})
+    if (LINE MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] .*ngraph::runtime::cpu::kernel::")
+        math(EXPR KERNEL_BYTES "${KERNEL_BYTES} + 0x${CMAKE_MATCH_1}")
+        math(EXPR KERNEL_COUNT "${KERNEL_COUNT} + 1")
+    endif()
+endforeach()
+
+file(SIZE ${LIBRARY} LIBRARY_BYTES)
+file(WRITE ${REPORT} "library_bytes ${LIBRARY_BYTES}\n")
+file(APPEND ${REPORT} "kernel_symbols ${KERNEL_COUNT}\n")
+file(APPEND ${REPORT} "kernel_bytes ${KERNEL_BYTES}\n")
+message(STATUS "CPU kernels: ${KERNEL_COUNT} symbols, ${KERNEL_BYTES} bytes "
+    "(library ${LIBRARY_BYTES} bytes)")
+
+if (BASELINE AND EXISTS ${BASELINE})
+    file(STRINGS ${BASELINE} BASELINE_LINES)
+    foreach(LINE ${BASELINE_LINES})
+        if (LINE MATCHES "^(library_bytes|kernel_bytes) ([0-9]+)$")
+            set(BASELINE_${CMAKE_MATCH_1} ${CMAKE_MATCH_2})
+        endif()
+    endforeach()
+    math(EXPR SAVED_KERNEL "${BASELINE_kernel_bytes} - ${KERNEL_BYTES}")
+    math(EXPR SAVED_LIBRARY "${BASELINE_library_bytes} - ${LIBRARY_BYTES}")
+    file(APPEND ${REPORT} "kernel_bytes_saved ${SAVED_KERNEL}\n")
+    file(APPEND ${REPORT} "library_bytes_saved ${SAVED_LIBRARY}\n")
+    message(STATUS "Saved ${SAVED_KERNEL} kernel bytes, ${SAVED_LIBRARY} library bytes "
+        "relative to ${BASELINE}")
+endif()
@@ -18,3 +18,4 @@
 from _pyngraph.runtime import Backend
 from _pyngraph.runtime import Executable
 from _pyngraph.runtime import Tensor
+from _pyngraph.runtime import UnsupportedOp
@@ -22,7 +22,7 @@ import numpy as np
 
 from ngraph.exceptions import UserInputError
 from ngraph.impl import Function, Node, Shape, PartialShape, serialize, util
-from ngraph.impl.runtime import Backend, Executable, Tensor
+from ngraph.impl.runtime import Backend, Executable, Tensor, UnsupportedOp
 from ngraph.utils.types import NumericData, get_dtype
 
 log = logging.getLogger(__name__)
@@ -81,6 +81,7 @@ class Computation(object):
         self.parameters = ng_function.get_parameters()
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
+        self.zero_copy = not self.function.is_dynamic()
 
         self.tensor_views = []  # type: List[Tensor]
         for parameter in self.parameters:
@@ -106,6 +107,13 @@ class Computation(object):
 
     def __call__(self, *input_values: NumericData) -> List[NumericData]:
         """Run computation on input values and return result."""
+        if self.zero_copy:
+            try:
+                return self._call_zero_copy(input_values)
+            except UnsupportedOp:
+                # The backend cannot wrap caller memory; fall back to copying through tensors
+                self.zero_copy = False
+
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
@@ -124,6 +132,27 @@ class Computation(object):
 
         return results
 
+    def _call_zero_copy(self, input_values: List[NumericData]) -> List[NumericData]:
+        """Run the computation directly on the memory of the input and output arrays.
+
+        Inputs that are C-contiguous arrays of the parameter type are read in place and the
+        backend writes each result straight into a freshly allocated array.
+        """
+        input_tensors = []
+        for index, (tensor_view, value) in enumerate(zip(self.tensor_views, input_values)):
+            value = Computation._as_tensor_view_ndarray(value, tensor_view)
+            input_tensors.append(self.handle.create_input_tensor(index, value))
+
+        results = []
+        output_tensors = []
+        for index, result_view in enumerate(self.result_views):
+            result = np.empty(result_view.shape, dtype=get_dtype(result_view.element_type))
+            output_tensors.append(self.handle.create_output_tensor(index, result))
+            results.append(result)
+
+        self.handle.call(output_tensors, input_tensors)
+        return results
+
     def serialize(self, indent: int = 0) -> str:
         """Serialize function (compute graph) to a JSON string.
 
@@ -137,14 +166,22 @@ class Computation(object):
         return int((element_type.bitwidth / 8.0) * element_count)
 
     @staticmethod
-    def _write_ndarray_to_tensor_view(value: np.ndarray, tensor_view: Tensor) -> None:
+    def _as_tensor_view_ndarray(value: NumericData, tensor_view: Tensor) -> np.ndarray:
+        """Return the value as a C-contiguous array of the tensor's type and shape.
+
+        The value itself is returned when it already is one, so it is not copied.
+        """
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
         tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError(
-                "Provided tensor's shape: %s does not match the expected: %s.",
-                list(value.shape),
-                list(tensor_view.shape),
-            )
+        if list(tensor_view.shape) != list(value.shape):
+            if len(value.shape) > 0:
+                raise UserInputError(
+                    "Provided tensor's shape: %s does not match the expected: %s.",
+                    list(value.shape),
+                    list(tensor_view.shape),
+                )
+            value = np.broadcast_to(value, tuple(tensor_view.shape))
         if value.dtype != tensor_view_dtype:
             log.warning(
                 "Attempting to write a %s value to a %s tensor. Will attempt type conversion.",
@@ -152,12 +189,16 @@ class Computation(object):
                 tensor_view.element_type,
             )
             value = value.astype(tensor_view_dtype)
+        if not value.flags["C_CONTIGUOUS"]:
+            value = np.ascontiguousarray(value)
+        return value
 
+    @staticmethod
+    def _write_ndarray_to_tensor_view(value: np.ndarray, tensor_view: Tensor) -> None:
+        nparray = Computation._as_tensor_view_ndarray(value, tensor_view)
         buffer_size = Computation._get_buffer_size(
             tensor_view.element_type, tensor_view.element_count
         )
-
-        nparray = np.ascontiguousarray(value)
         tensor_view.write(util.numpy_to_c(nparray), buffer_size)
 
     @staticmethod
@@ -23,6 +23,55 @@
 
 namespace py = pybind11;
 
+// Returns the memory of a C-contiguous buffer holding a tensor of the given type and shape
+static void* get_buffer_data(py::buffer& buffer,
+                             const ngraph::element::Type& element_type,
+                             const ngraph::Shape& shape,
+                             bool writable)
+{
+    py::buffer_info info = buffer.request(writable);
+    if (static_cast<size_t>(info.itemsize) != element_type.size())
+    {
+        throw std::invalid_argument("Buffer item size " + std::to_string(info.itemsize) +
+                                    " does not match element type " +
+                                    element_type.get_type_name());
+    }
+    if (ngraph::Shape(info.shape.begin(), info.shape.end()) != shape)
+    {
+        throw std::invalid_argument("Buffer shape does not match tensor shape");
+    }
+    py::ssize_t stride = info.itemsize;
+    for (size_t i = info.shape.size(); i-- > 0;)
+    {
+        if (info.shape[i] > 1 && info.strides[i] != stride)
+        {
+            throw std::invalid_argument("Buffer is not C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    return info.ptr;
+}
+
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_input_tensor(ngraph::runtime::Executable* self, size_t input_index, py::buffer buffer)
+{
+    auto parameter = self->get_parameters().at(input_index);
+    void* data = get_buffer_data(buffer,
+                                 parameter->get_output_element_type(0),
+                                 parameter->get_output_shape(0),
+                                 false);
+    return self->create_input_tensor(input_index, data);
+}
+
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_output_tensor(ngraph::runtime::Executable* self, size_t output_index, py::buffer buffer)
+{
+    auto result = self->get_results().at(output_index);
+    void* data = get_buffer_data(
+        buffer, result->get_output_element_type(0), result->get_output_shape(0), true);
+    return self->create_output_tensor(output_index, data);
+}
+
 void regclass_pyngraph_runtime_Executable(py::module m)
 {
     py::class_<ngraph::runtime::Executable, std::shared_ptr<ngraph::runtime::Executable>>
@@ -32,12 +81,17 @@ void regclass_pyngraph_runtime_Executable(py::module m)
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call);
+                       ngraph::runtime::Executable::call,
+                   py::call_guard<py::gil_scoped_release>());
     executable.def("call_with_validate",
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call_with_validate);
+                       ngraph::runtime::Executable::call_with_validate,
+                   py::call_guard<py::gil_scoped_release>());
+    // The tensors wrap the buffer memory without copying and keep the buffer alive
+    executable.def("create_input_tensor", &create_input_tensor, py::keep_alive<0, 3>());
+    executable.def("create_output_tensor", &create_output_tensor, py::keep_alive<0, 3>());
     executable.def(
         "get_performance_data",
         (std::vector<ngraph::runtime::PerformanceCounter>(ngraph::runtime::Executable::*)()) &
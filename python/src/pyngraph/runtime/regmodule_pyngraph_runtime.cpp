@@ -16,6 +16,7 @@
 
 #include "pyngraph/runtime/regmodule_pyngraph_runtime.hpp"
 #include <pybind11/pybind11.h>
+#include "ngraph/except.hpp"
 
 namespace py = pybind11;
 
@@ -26,4 +27,6 @@ void regmodule_pyngraph_runtime(py::module m)
     regclass_pyngraph_runtime_Tensor(m_runtime);
     regclass_pyngraph_runtime_Backend(m_runtime);
     regclass_pyngraph_runtime_Executable(m_runtime);
+    // Raised when a backend does not implement a requested feature, e.g. wrapping caller memory
+    py::register_exception<ngraph::unsupported_op>(m_runtime, "UnsupportedOp", PyExc_RuntimeError);
 }
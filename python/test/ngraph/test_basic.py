@@ -84,6 +84,26 @@ def test_simple_computation_on_ndarrays(dtype):
     assert np.allclose(result, np.array([[630, 704], [782, 864]], dtype=dtype))
 
 
+def test_computation_on_strided_inputs_returns_independent_results():
+    runtime = get_runtime()
+
+    shape = [2, 3]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name="A")
+    parameter_b = ng.parameter(shape, dtype=np.float32, name="B")
+    model = parameter_a * parameter_b
+    computation = runtime.computation(model, parameter_a, parameter_b)
+
+    # a strided view is copied once, a contiguous array is read in place
+    value_a = np.arange(12, dtype=np.float32).reshape(3, 4)[:2, :3]
+    value_b = np.full(shape, 2, dtype=np.float32)
+    first = computation(value_a, value_b)[0]
+    second = computation(value_b, value_b)[0]
+
+    assert np.allclose(first, np.array([[0, 2, 4], [8, 10, 12]], dtype=np.float32))
+    assert np.allclose(second, np.full(shape, 4, dtype=np.float32))
+    assert np.allclose(value_a, np.array([[0, 1, 2], [4, 5, 6]], dtype=np.float32))
+
+
 def test_serialization():
     dtype = np.float32
     backend_name = test.BACKEND_NAME
@@ -51,6 +51,7 @@ OutputVector make_zeros(std::shared_ptr<Node> x)
 }
 
 autodiff::Adjoints::Adjoints(const OutputVector& ys, const OutputVector& cs)
+    : m_ys(ys)
 {
     if (ys.size() != cs.size())
     {
@@ -159,6 +160,23 @@ Output<Node> autodiff::Adjoints::backprop_output(const Output<Node>& x)
     return deltas.at(x.get_index());
 }
 
+autodiff::RematerializationReport
+    autodiff::Adjoints::rematerialize(const RematerializationConfig& config)
+{
+    OutputVector backward;
+    for (auto& adjoints : m_adjoint_map)
+    {
+        for (auto& delta : adjoints.second)
+        {
+            if (delta != Output<Node>())
+            {
+                backward.push_back(delta);
+            }
+        }
+    }
+    return autodiff::rematerialize(m_ys, backward, config);
+}
+
 void autodiff::Adjoints::add_delta(const Output<Node>& x, const Output<Node>& delta)
 {
     auto adjoint_it = m_adjoint_map.find(x.get_node());
@@ -20,6 +20,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "ngraph/autodiff/rematerialization.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/output_vector.hpp"
 #include "ngraph/strides.hpp"
@@ -71,8 +72,15 @@ namespace ngraph
             /// \param x The output whose adjoint is desired.
             Output<Node> backprop_output(const Output<Node>& x);
 
+            /// \brief Recompute forward values in the backprop graph instead of keeping them
+            ///        alive until their adjoint is computed. See autodiff::rematerialize.
+            ///
+            /// Call it once all adjoints were requested with backprop_output.
+            RematerializationReport rematerialize(const RematerializationConfig& config);
+
         protected:
             std::map<Node*, OutputVector> m_adjoint_map;
+            OutputVector m_ys;
         };
     }
 }
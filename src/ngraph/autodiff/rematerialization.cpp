@@ -0,0 +1,342 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/autodiff/rematerialization.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    size_t output_bytes(const Output<Node>& output)
+    {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+        {
+            return 0;
+        }
+        return shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+
+    // Inputs that only give backprop a shape. LikeReplacement removes them, so they do not
+    // keep the forward value alive.
+    bool reads_shape_only(const Input<Node>& input)
+    {
+        const Node* node = input.get_node();
+        return is_type<op::v0::ScalarConstantLike>(node) ||
+               (is_type<op::v0::BroadcastLike>(node) && input.get_index() == 1);
+    }
+
+    bool is_input(const Node* node) { return node->is_parameter() || node->is_constant(); }
+}
+
+uint64_t autodiff::estimate_flops(const Node* node)
+{
+    uint64_t output_elements = 0;
+    for (auto& output : node->outputs())
+    {
+        if (output.get_partial_shape().is_static())
+        {
+            output_elements += shape_size(output.get_shape());
+        }
+    }
+    // Multiply-adds per output element
+    uint64_t reduction_size = 0;
+    if (is_type<op::v0::Dot>(node) && node->get_input_partial_shape(0).is_static())
+    {
+        auto dot = static_cast<const op::v0::Dot*>(node);
+        const Shape& shape = node->get_input_shape(0);
+        reduction_size = 1;
+        for (size_t i = shape.size() - dot->get_reduction_axes_count(); i < shape.size(); i++)
+        {
+            reduction_size *= shape[i];
+        }
+    }
+    else if (is_type<op::v0::MatMul>(node) && node->get_input_partial_shape(0).is_static() &&
+             node->get_input_shape(0).size() > 0)
+    {
+        auto matmul = static_cast<const op::v0::MatMul*>(node);
+        const Shape& shape = node->get_input_shape(0);
+        reduction_size = (matmul->get_transpose_a() && shape.size() > 1) ? shape[shape.size() - 2]
+                                                                         : shape.back();
+    }
+    else if ((is_type<op::v0::Convolution>(node) || is_type<op::v1::Convolution>(node)) &&
+             node->get_input_partial_shape(1).is_static())
+    {
+        const Shape& filters = node->get_input_shape(1);
+        reduction_size = filters.empty() || filters[0] == 0 ? 0 : shape_size(filters) / filters[0];
+    }
+    return reduction_size > 0 ? 2 * output_elements * reduction_size : output_elements;
+}
+
+autodiff::RematerializationReport
+    autodiff::rematerialize(const OutputVector& forward,
+                            const OutputVector& backward,
+                            const RematerializationConfig& config)
+{
+    RematerializationReport report;
+
+    NodeVector forward_roots;
+    for (auto& value : forward)
+    {
+        forward_roots.push_back(value.get_node_shared_ptr());
+    }
+    NodeVector forward_ops = topological_sort(forward_roots);
+    unordered_set<Node*> forward_set;
+    for (auto& node : forward_ops)
+    {
+        forward_set.insert(node.get());
+    }
+
+    // Backprop ops in topological order, so the first reader of a recomputed value comes first
+    NodeVector backward_roots;
+    for (auto& value : backward)
+    {
+        backward_roots.push_back(value.get_node_shared_ptr());
+    }
+    // Backprop ops that only read forward values, such as y * y for the derivative of tanh,
+    // could run as soon as the forward pass did. They count as forward ops, so that they are
+    // kept or recomputed like them and their readers, which also wait for backprop values,
+    // decide when the recomputation runs.
+    NodeVector backward_ops;
+    for (auto& node : topological_sort(backward_roots))
+    {
+        if (forward_set.count(node.get()))
+        {
+            continue;
+        }
+        auto inputs = node->input_values();
+        bool forward_only =
+            !inputs.empty() && !node->has_state() &&
+            find(backward_roots.begin(), backward_roots.end(), node) == backward_roots.end() &&
+            all_of(inputs.begin(), inputs.end(), [&forward_set](const Output<Node>& value) {
+                return forward_set.count(value.get_node()) != 0;
+            });
+        if (forward_only)
+        {
+            forward_set.insert(node.get());
+            forward_ops.push_back(node);
+        }
+        else
+        {
+            backward_ops.push_back(node);
+        }
+    }
+
+    // Forward values that readers keep alive, and their size
+    auto forward_reads = [&forward_set](const NodeVector& readers) {
+        set<Output<Node>> values;
+        for (auto& reader : readers)
+        {
+            for (auto& input : reader->inputs())
+            {
+                auto source = input.get_source_output();
+                if (!reads_shape_only(input) && forward_set.count(source.get_node()) &&
+                    !is_input(source.get_node()))
+                {
+                    values.insert(source);
+                }
+            }
+        }
+        return values;
+    };
+    auto read = forward_reads(backward_ops);
+    for (auto& value : read)
+    {
+        report.activation_bytes += output_bytes(value);
+    }
+
+    // Forward ops kept for backprop; the other ones are recomputed when backprop needs them
+    unordered_set<Node*> checkpoints;
+    vector<Node*> candidates;
+    for (auto& node : forward_ops)
+    {
+        if (is_input(node.get()))
+        {
+            continue;
+        }
+        if (node->has_state() || !node->get_control_dependencies().empty() ||
+            find(forward_roots.begin(), forward_roots.end(), node) != forward_roots.end())
+        {
+            checkpoints.insert(node.get());
+        }
+        else
+        {
+            candidates.push_back(node.get());
+        }
+    }
+    switch (config.policy)
+    {
+    case RematerializationConfig::Policy::NONE:
+        checkpoints.insert(candidates.begin(), candidates.end());
+        break;
+    case RematerializationConfig::Policy::SQRT_N:
+    {
+        size_t segment = max<size_t>(
+            static_cast<size_t>(ceil(sqrt(static_cast<double>(candidates.size())))), 1);
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            if ((i + 1) % segment == 0)
+            {
+                checkpoints.insert(candidates[i]);
+            }
+        }
+        break;
+    }
+    case RematerializationConfig::Policy::MEMORY_BUDGET:
+    {
+        // Start from keeping what backprop reads and give up the values with the most bytes per
+        // FLOP of recomputation first. Ops backprop does not read are recomputed from the kept
+        // values, so dropping a value never adds another one to keep, but recomputing it also
+        // recomputes the chain of dropped values it is computed from.
+        unordered_map<Node*, size_t> read_bytes;
+        for (auto& value : read)
+        {
+            read_bytes[value.get_node()] += output_bytes(value);
+        }
+        vector<Node*> droppable;
+        for (Node* node : candidates)
+        {
+            if (read_bytes.count(node))
+            {
+                checkpoints.insert(node);
+                droppable.push_back(node);
+            }
+        }
+        // FLOPs of recomputing node from the current checkpoints
+        auto recompute_flops = [&checkpoints](Node* node) {
+            uint64_t flops = 0;
+            unordered_set<Node*> visited;
+            function<void(Node*)> visit = [&](Node* n) {
+                if (!visited.insert(n).second)
+                {
+                    return;
+                }
+                flops += estimate_flops(n);
+                for (auto& value : n->input_values())
+                {
+                    Node* arg = value.get_node();
+                    if (!is_input(arg) && checkpoints.count(arg) == 0)
+                    {
+                        visit(arg);
+                    }
+                }
+            };
+            visit(node);
+            return flops;
+        };
+        // Dropping a value lengthens the chains of the values computed from it, so the ranking
+        // is redone after every drop
+        size_t kept = report.activation_bytes;
+        while (kept > config.memory_budget && !droppable.empty())
+        {
+            auto best = droppable.begin();
+            double best_ratio = -1;
+            for (auto it = droppable.begin(); it != droppable.end(); it++)
+            {
+                double ratio = static_cast<double>(read_bytes[*it]) / (recompute_flops(*it) + 1);
+                if (ratio > best_ratio)
+                {
+                    best = it;
+                    best_ratio = ratio;
+                }
+            }
+            checkpoints.erase(*best);
+            kept -= read_bytes[*best];
+            droppable.erase(best);
+        }
+        break;
+    }
+    }
+
+    unordered_map<Node*, shared_ptr<Node>> clones;
+    function<shared_ptr<Node>(Node*, const NodeVector&)> recompute = [&](
+        Node* node, const NodeVector& after) -> shared_ptr<Node> {
+        auto it = clones.find(node);
+        if (it != clones.end())
+        {
+            return it->second;
+        }
+        OutputVector args;
+        for (auto& value : node->input_values())
+        {
+            Node* arg = value.get_node();
+            if (is_input(arg) || checkpoints.count(arg))
+            {
+                args.push_back(value);
+            }
+            else
+            {
+                args.push_back(recompute(arg, after)->output(value.get_index()));
+            }
+        }
+        auto clone = node->copy_with_new_inputs(args, after);
+        clones[node] = clone;
+        report.recomputed_ops++;
+        report.extra_flops += estimate_flops(node);
+        return clone;
+    };
+    for (auto& reader : backward_ops)
+    {
+        // The backprop values reader waits for. Recomputing after them keeps the copies from
+        // being scheduled during the forward pass, where they would not save anything.
+        NodeVector after;
+        for (auto& value : reader->input_values())
+        {
+            if (forward_set.count(value.get_node()) == 0)
+            {
+                after.push_back(value.get_node_shared_ptr());
+            }
+        }
+        for (auto& input : reader->inputs())
+        {
+            auto source = input.get_source_output();
+            Node* node = source.get_node();
+            if (reads_shape_only(input) || forward_set.count(node) == 0 || is_input(node) ||
+                checkpoints.count(node))
+            {
+                continue;
+            }
+            input.replace_source_output(recompute(node, after)->output(source.get_index()));
+        }
+    }
+
+    NodeVector readers = backward_ops;
+    for (auto& clone : clones)
+    {
+        readers.push_back(clone.second);
+    }
+    set<Node*> kept_ops;
+    for (auto& value : forward_reads(readers))
+    {
+        report.checkpoint_bytes += output_bytes(value);
+        kept_ops.insert(value.get_node());
+    }
+    report.checkpoint_count = kept_ops.size();
+    return report;
+}
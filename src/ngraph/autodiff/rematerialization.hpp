@@ -0,0 +1,91 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/output_vector.hpp"
+
+namespace ngraph
+{
+    class Node;
+
+    namespace autodiff
+    {
+        /// \brief How forward values are kept for, or recomputed by, a backprop graph
+        struct RematerializationConfig
+        {
+            enum class Policy
+            {
+                /// Keep every forward value; rematerialize does nothing
+                NONE,
+                /// Keep every ceil(sqrt(n))-th forward op and recompute the ops in between
+                /// (Chen et al., "Training Deep Nets with Sublinear Memory Cost")
+                SQRT_N,
+                /// Recompute the forward values with the most bytes per FLOP until the values
+                /// backprop reads from the forward pass fit in memory_budget bytes. The FLOPs
+                /// of a value include the values already dropped that it is computed from.
+                MEMORY_BUDGET,
+            };
+
+            Policy policy = Policy::SQRT_N;
+            size_t memory_budget = 0;
+        };
+
+        /// \brief Effect of rematerialize. Bytes only count outputs with a static shape.
+        struct RematerializationReport
+        {
+            /// Bytes of forward values backprop read before the rewrite
+            size_t activation_bytes = 0;
+            /// Bytes of forward values backprop and the recomputation read after the rewrite
+            size_t checkpoint_bytes = 0;
+            size_t checkpoint_count = 0;
+            size_t recomputed_ops = 0;
+            /// Estimated floating point operations of the recomputed ops
+            uint64_t extra_flops = 0;
+
+            size_t get_memory_saved() const
+            {
+                return activation_bytes > checkpoint_bytes ? activation_bytes - checkpoint_bytes
+                                                           : 0;
+            }
+        };
+
+        /// \brief Rewrite the backprop graph computing backward so it recomputes forward values
+        ///        from a subset of them (the checkpoints) instead of keeping them all alive.
+        ///
+        /// Ops of backward that read a forward value which is not a checkpoint read a copy of
+        /// the forward ops computing it instead. The copies have control dependencies on the
+        /// other inputs of their first reader, so they only run once backprop got there.
+        /// Backprop ops that only read forward values are handled like forward ops. Ops with
+        /// state, such as random number generators, are always checkpoints.
+        ///
+        /// \param forward The values computed by the forward pass
+        /// \param backward The values computed by backprop
+        NGRAPH_API
+        RematerializationReport rematerialize(const OutputVector& forward,
+                                              const OutputVector& backward,
+                                              const RematerializationConfig& config);
+
+        /// \brief Rough number of floating point operations of node; 2 per multiply-add for
+        ///        Dot, MatMul and Convolution, one per output element otherwise
+        NGRAPH_API
+        uint64_t estimate_flops(const Node* node);
+    }
+}
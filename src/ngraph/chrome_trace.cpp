@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
 #include <iostream>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 
@@ -35,6 +37,42 @@ static bool read_tracing_env_var()
 
 mutex event::Manager::s_file_mutex;
 bool event::Manager::s_tracing_enabled = read_tracing_env_var();
+bool event::Manager::s_first_event = true;
+bool event::Manager::s_closed = false;
+constexpr size_t event::Manager::s_flush_bytes;
+
+class event::Manager::ThreadBuffer
+{
+public:
+    ThreadBuffer();
+    ~ThreadBuffer();
+
+    mutex m_mutex;
+    string m_events;
+
+    // Buffers of all live threads, so that close() can flush the ones still holding events
+    static mutex s_registry_mutex;
+    static set<ThreadBuffer*>& get_registry()
+    {
+        static set<ThreadBuffer*> s_registry;
+        return s_registry;
+    }
+};
+
+mutex event::Manager::ThreadBuffer::s_registry_mutex;
+
+event::Manager::ThreadBuffer::ThreadBuffer()
+{
+    lock_guard<mutex> lock(s_registry_mutex);
+    get_registry().insert(this);
+}
+
+event::Manager::ThreadBuffer::~ThreadBuffer()
+{
+    Manager::flush(*this);
+    lock_guard<mutex> lock(s_registry_mutex);
+    get_registry().erase(this);
+}
 
 event::Duration::Duration(const string& name, const string& category, const string& args)
 {
@@ -58,33 +96,22 @@ void event::Duration::stop()
 
 void event::Duration::write()
 {
-    if (Manager::is_tracing_enabled())
+    if (Manager::is_tracing_enabled() && !m_name.empty())
     {
         size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
 
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-
-        str +=
-            R"({"name":")" + m_name + R"(","cat":")" + m_category + R"(","ph":"X","pid":)" +
-            Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id() +
-            R"(,"ts":)" + to_string(m_start) + R"(,"dur":)" + to_string(stop_time - m_start);
+        string str = R"({"name":")" + m_name + R"(","cat":")" + m_category +
+                     R"(","ph":"X","pid":)" + Manager::get_process_id() + R"(,"tid":)" +
+                     to_string(Manager::get_thread_id()) + R"(,"ts":)" + to_string(m_start) +
+                     R"(,"dur":)" + to_string(stop_time - m_start);
         if (!m_args.empty())
         {
             str += R"(,"args":)" + m_args;
         }
         str += "}";
-        out << str;
+        Manager::write_event(str);
+        // Only write once, even if write() is called before the destructor
+        m_name.clear();
     }
 }
 
@@ -94,28 +121,15 @@ event::Object::Object(const string& name, const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-        str += R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
-               R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-               R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
+        string str = Manager::get_event_header(m_name, "N") + R"(,"id":")" + to_string(m_id) +
+                     R"(")";
         if (!args.empty())
         {
             str += R"(,"args":)" + args;
         }
         str += "}";
-
-        write_snapshot(out, args);
+        Manager::write_event(str);
+        snapshot(args);
     }
 }
 
@@ -123,54 +137,79 @@ void event::Object::snapshot(const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+        stringstream ss;
+        write_snapshot(ss, args);
+        Manager::write_event(ss.str());
     }
 }
 
 void event::Object::write_snapshot(ostream& out, const string& args)
 {
-    string str = R"({"name":")" + m_name + R"(","ph":"O","id":")" + to_string(m_id) +
-                 R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                 R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
+    out << Manager::get_event_header(m_name, "O") << R"(,"id":")" << m_id << R"(")";
     if (!args.empty())
     {
-        str += R"(,"args":)" + args;
+        out << R"(,"args":)" << args;
     }
-    str += "}";
-    out << str;
+    out << "}";
 }
 
 void event::Object::destroy()
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
+        Manager::write_event(Manager::get_event_header(m_name, "D") + R"(,"id":")" +
+                             to_string(m_id) + R"("})");
+    }
+}
 
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
+string event::Manager::get_event_header(const string& name, const string& phase)
+{
+    return R"({"name":")" + name + R"(","ph":")" + phase + R"(","ts":)" +
+           to_string(get_current_microseconds()) + R"(,"pid":)" + get_process_id() +
+           R"(,"tid":)" + to_string(get_thread_id());
+}
+
+void event::Manager::write_event(const string& event)
+{
+    static thread_local ThreadBuffer s_buffer;
+    bool full;
+    {
+        lock_guard<mutex> lock(s_buffer.m_mutex);
+        s_buffer.m_events += ",\n";
+        s_buffer.m_events += event;
+        full = s_buffer.m_events.size() >= s_flush_bytes;
+    }
+    if (full)
+    {
+        flush(s_buffer);
+    }
+}
+
+void event::Manager::flush(ThreadBuffer& buffer)
+{
+    string events;
+    {
+        lock_guard<mutex> lock(buffer.m_mutex);
+        events.swap(buffer.m_events);
+    }
+    if (events.empty())
+    {
+        return;
+    }
+    lock_guard<mutex> lock(get_mutex());
+    ofstream& out = get_output_stream();
+    if (out.is_open() == false)
+    {
+        // Reopening would truncate the trace that close() has finished
+        if (s_closed)
         {
-            Manager::get_output_stream() << ",\n";
+            return;
         }
-        string str = R"({"name":")" + m_name + R"(","ph":"D","id":")" + to_string(m_id) +
-                     R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                     R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
-                     Manager::get_thread_id() + "}";
+        open();
     }
+    // Every buffered event starts with a separator, except the first one in the file
+    out << (s_first_event ? events.substr(2) : events);
+    s_first_event = false;
 }
 
 void event::Manager::open(const string& path)
@@ -178,19 +217,38 @@ void event::Manager::open(const string& path)
     ofstream& out = get_output_stream();
     if (out.is_open() == false)
     {
+        s_closed = false;
         out.open(path, ios_base::trunc);
         out << "[\n";
+        s_first_event = true;
+
+        // Constructed after the output stream and the buffer registry, so destroyed (and
+        // closing the trace) before them
+        ThreadBuffer::get_registry();
+        static struct Closer
+        {
+            ~Closer() { Manager::close(); }
+        } s_closer;
     }
 }
 
 void event::Manager::close()
 {
+    {
+        lock_guard<mutex> lock(ThreadBuffer::s_registry_mutex);
+        for (ThreadBuffer* buffer : ThreadBuffer::get_registry())
+        {
+            flush(*buffer);
+        }
+    }
+    lock_guard<mutex> lock(get_mutex());
     ofstream& out = get_output_stream();
     if (out.is_open())
     {
         out << "\n]\n";
         out.close();
     }
+    s_closed = true;
 }
 
 ofstream& event::Manager::get_output_stream()
@@ -220,22 +278,9 @@ bool event::Manager::is_event_tracing_enabled()
     return s_tracing_enabled;
 }
 
-string event::Manager::get_thread_id()
+size_t event::Manager::get_thread_id()
 {
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
-    {
-        rc = it->second;
-    }
-    return rc;
+    static atomic<size_t> s_next_id{0};
+    static thread_local size_t s_id = s_next_id++;
+    return s_id;
 }
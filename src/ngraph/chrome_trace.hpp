@@ -74,31 +74,55 @@ namespace ngraph
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
 
-class ngraph::event::Manager
+//
+// Events are formatted on the thread that records them and collected in a buffer owned by
+// that thread. A buffer is appended to the trace file once it holds s_flush_bytes, when its
+// thread exits, or on close(), so memory stays bounded however long the trace runs and
+// threads only contend on the file when they flush. Complete ("X") events recorded on the
+// same thread nest by their timestamps, so a Duration opened inside another one shows up as
+// its child in the viewer.
+//
+// Tracing is enabled with NGRAPH_ENABLE_TRACING or enable_event_tracing(). The trace is
+// written to runtime_event_trace.json unless open() names another file first.
+
+class NGRAPH_API ngraph::event::Manager
 {
     friend class Duration;
     friend class Object;
 
 public:
     static void open(const std::string& path = "runtime_event_trace.json");
+    /// \brief Write the buffered events of all threads and close the trace file. Later events
+    ///        are dropped until open() starts a new trace.
     static void close();
     static bool is_tracing_enabled() { return s_tracing_enabled; }
     static void enable_event_tracing();
     static void disable_event_tracing();
     static bool is_event_tracing_enabled();
 
+    /// \brief Small integer id of the calling thread, as used for "tid" in the trace
+    static size_t get_thread_id();
+
 private:
+    class ThreadBuffer;
+
     static std::ofstream& get_output_stream();
     static const std::string& get_process_id();
     static size_t get_current_microseconds()
     {
-        return std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1000;
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::high_resolution_clock::now().time_since_epoch())
+            .count();
     }
-    static std::string get_thread_id();
+    static std::string get_event_header(const std::string& name, const std::string& phase);
+    static void write_event(const std::string& event);
+    static void flush(ThreadBuffer& buffer);
     static std::mutex& get_mutex() { return s_file_mutex; }
-    static std::ostream s_ostream;
     static std::mutex s_file_mutex;
     static bool s_tracing_enabled;
+    static bool s_first_event;
+    static bool s_closed;
+    static constexpr size_t s_flush_bytes = 64 * 1024;
 };
 
 class NGRAPH_API ngraph::event::Duration
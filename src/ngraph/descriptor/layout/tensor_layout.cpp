@@ -17,6 +17,7 @@
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/type/packed.hpp"
 
 using namespace ngraph;
 
@@ -43,5 +44,5 @@ size_t descriptor::layout::TensorLayout::get_size() const
 
 size_t descriptor::layout::TensorLayout::get_allocated_size()
 {
-    return get_size() * get_element_type().size();
+    return packed::byte_size(get_element_type(), get_size());
 }
@@ -17,6 +17,7 @@
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/type/packed.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -99,7 +100,7 @@ size_t descriptor::Tensor::size() const
     }
     else
     {
-        return shape_size(get_shape()) * m_element_type.size();
+        return packed::byte_size(m_element_type, shape_size(get_shape()));
     }
 }
 
@@ -16,6 +16,8 @@
 
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/ring.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/type.hpp"
 
@@ -42,6 +44,22 @@ std::ostream& reduction::operator<<(std::ostream& out, const reduction::Type& ob
     return out << as_string(obj);
 }
 
+namespace
+{
+    class CompletedRequest : public DistributedRequest
+    {
+    public:
+        void wait() override {}
+    };
+}
+
+std::shared_ptr<DistributedRequest> DistributedInterface::all_reduce_async(
+    void* in, void* out, element::Type_t element_type, reduction::Type reduce_type, size_t count)
+{
+    all_reduce(in, out, element_type, reduce_type, count);
+    return std::make_shared<CompletedRequest>();
+}
+
 static std::unique_ptr<DistributedInterface> s_distributed_interface;
 
 void ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface)
@@ -54,8 +72,15 @@ DistributedInterface* ngraph::get_distributed_interface()
 {
     if (nullptr == s_distributed_interface)
     {
-        set_distributed_interface(
-            std::unique_ptr<DistributedInterface>(new ngraph::distributed::Null()));
+        if (getenv_string("NGRAPH_DISTRIBUTED") == "RING")
+        {
+            set_distributed_interface(distributed::Ring::create_from_environment());
+        }
+        else
+        {
+            set_distributed_interface(
+                std::unique_ptr<DistributedInterface>(new ngraph::distributed::Null()));
+        }
     }
     return s_distributed_interface.get();
 }
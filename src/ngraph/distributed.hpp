@@ -54,7 +54,16 @@ namespace ngraph
         const DiscreteTypeInfo& get_type_info() const override { return type_info; }
     };
 
-    class DistributedInterface
+    /// \brief Handle to a collective started with DistributedInterface::all_reduce_async
+    class NGRAPH_API DistributedRequest
+    {
+    public:
+        virtual ~DistributedRequest() {}
+        /// \brief Block until the collective completed. Rethrows errors of the collective.
+        virtual void wait() = 0;
+    };
+
+    class NGRAPH_API DistributedInterface
     {
     public:
         virtual ~DistributedInterface() {}
@@ -67,6 +76,15 @@ namespace ngraph
                                 element::Type_t element_type,
                                 reduction::Type reduce_type,
                                 size_t count) = 0;
+        /// \brief Start an all_reduce and return without waiting for it. in and out must stay
+        ///        valid until the request completed. Collectives complete in the order they
+        ///        were started, which must be the same on all ranks. The default
+        ///        implementation runs all_reduce before returning.
+        virtual std::shared_ptr<DistributedRequest> all_reduce_async(void* in,
+                                                                     void* out,
+                                                                     element::Type_t element_type,
+                                                                     reduction::Type reduce_type,
+                                                                     size_t count);
         virtual void
             broadcast(void* in, element::Type_t element_type, size_t count, int root_id) = 0;
         virtual void recv(void* in, element::Type_t element_type, size_t count, int src_id) = 0;
@@ -74,6 +92,7 @@ namespace ngraph
             send(const void* in, element::Type_t element_type, size_t count, int dest_id) = 0;
     };
 
+    NGRAPH_API
     void set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface);
 
     NGRAPH_API
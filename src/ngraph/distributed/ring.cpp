@@ -0,0 +1,676 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/distributed/ring.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t distributed::Ring::default_segment_bytes;
+
+class distributed::Ring::Request : public DistributedRequest
+{
+public:
+    Request(function<void()> task)
+        : m_task(move(task))
+    {
+    }
+
+    void run()
+    {
+        exception_ptr error;
+        try
+        {
+            m_task();
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        lock_guard<mutex> lock(m_mutex);
+        m_error = error;
+        m_done = true;
+        m_condition.notify_all();
+    }
+
+    void wait() override
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] { return m_done; });
+        if (m_error)
+        {
+            rethrow_exception(m_error);
+        }
+    }
+
+private:
+    function<void()> m_task;
+    mutex m_mutex;
+    condition_variable m_condition;
+    bool m_done = false;
+    exception_ptr m_error;
+};
+
+namespace
+{
+    // Accumulation type of T; the 16-bit floating point types reduce in float
+    template <typename T>
+    struct Accumulator
+    {
+        using type = T;
+    };
+
+    template <>
+    struct Accumulator<bfloat16>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct Accumulator<float16>
+    {
+        using type = float;
+    };
+
+    template <typename T>
+    void reduce(void* acc_data, const void* in_data, size_t count, reduction::Type reduce_type)
+    {
+        using A = typename Accumulator<T>::type;
+        T* acc = static_cast<T*>(acc_data);
+        const T* in = static_cast<const T*>(in_data);
+        for (size_t i = 0; i < count; i++)
+        {
+            A a = static_cast<A>(acc[i]);
+            A b = static_cast<A>(in[i]);
+            switch (reduce_type)
+            {
+            case reduction::Type::SUM: a = a + b; break;
+            case reduction::Type::PROD: a = a * b; break;
+            case reduction::Type::MIN: a = std::min(a, b); break;
+            case reduction::Type::MAX: a = std::max(a, b); break;
+            }
+            acc[i] = static_cast<T>(a);
+        }
+    }
+
+    void reduce(void* acc,
+                const void* in,
+                size_t count,
+                element::Type_t element_type,
+                reduction::Type reduce_type)
+    {
+        switch (element_type)
+        {
+        case element::Type_t::bf16: reduce<bfloat16>(acc, in, count, reduce_type); break;
+        case element::Type_t::f16: reduce<float16>(acc, in, count, reduce_type); break;
+        case element::Type_t::f32: reduce<float>(acc, in, count, reduce_type); break;
+        case element::Type_t::f64: reduce<double>(acc, in, count, reduce_type); break;
+        case element::Type_t::i8: reduce<int8_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::i16: reduce<int16_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::i32: reduce<int32_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::i64: reduce<int64_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::u8: reduce<uint8_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::u16: reduce<uint16_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::u32: reduce<uint32_t>(acc, in, count, reduce_type); break;
+        case element::Type_t::u64: reduce<uint64_t>(acc, in, count, reduce_type); break;
+        default:
+            throw ngraph_error("Ring all_reduce does not support element type " +
+                               element::Type(element_type).get_type_name());
+        }
+    }
+
+    string errno_message(const string& what)
+    {
+        return what + ": " + strerror(errno);
+    }
+}
+
+#ifndef _WIN32
+
+distributed::Ring::Ring(
+    int rank, int size, int base_port, const string& host, size_t segment_bytes)
+    : m_rank(rank)
+    , m_size(size)
+    , m_segment_bytes(max<size_t>(segment_bytes, 1))
+    , m_sockets(max(size, 0), -1)
+{
+    connect_ranks(base_port + rank,
+                  [base_port, size](int) {
+                      vector<int> ports;
+                      for (int peer = 0; peer < size; peer++)
+                      {
+                          ports.push_back(base_port + peer);
+                      }
+                      return ports;
+                  },
+                  host);
+    m_thread = thread(&Ring::run_queue, this);
+}
+
+distributed::Ring::Ring(int rank,
+                        int size,
+                        const PortExchange& exchange_ports,
+                        const string& host,
+                        size_t segment_bytes)
+    : m_rank(rank)
+    , m_size(size)
+    , m_segment_bytes(max<size_t>(segment_bytes, 1))
+    , m_sockets(max(size, 0), -1)
+{
+    connect_ranks(0, exchange_ports, host);
+    m_thread = thread(&Ring::run_queue, this);
+}
+
+void distributed::Ring::connect_ranks(int listen_port,
+                                      const PortExchange& exchange_ports,
+                                      const string& host)
+{
+    int rank = m_rank;
+    int size = m_size;
+    if (size < 1 || rank < 0 || rank >= size)
+    {
+        throw ngraph_error("Ring rank " + to_string(rank) + " is not in a ring of size " +
+                           to_string(size));
+    }
+    if (size > 1)
+    {
+        in_addr address;
+        if (inet_pton(AF_INET, host.c_str(), &address) != 1)
+        {
+            throw ngraph_error("Ring host '" + host + "' is not an IPv4 address");
+        }
+        auto make_address = [&](int port) {
+            sockaddr_in result;
+            memset(&result, 0, sizeof(result));
+            result.sin_family = AF_INET;
+            result.sin_addr = address;
+            result.sin_port = htons(static_cast<uint16_t>(port));
+            return result;
+        };
+
+        int listener = socket(AF_INET, SOCK_STREAM, 0);
+        int one = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in listen_address = make_address(listen_port);
+        auto listen_sockaddr = reinterpret_cast<sockaddr*>(&listen_address);
+        socklen_t listen_length = sizeof(listen_address);
+        if (listener < 0 || ::bind(listener, listen_sockaddr, sizeof(listen_address)) != 0 ||
+            listen(listener, size) != 0 ||
+            getsockname(listener, listen_sockaddr, &listen_length) != 0)
+        {
+            string message = errno_message("Ring rank " + to_string(rank) + " cannot listen on " +
+                                           host + ":" + to_string(listen_port));
+            if (listener >= 0)
+            {
+                close(listener);
+            }
+            throw ngraph_error(message);
+        }
+
+        // With listen_port 0 the system picked the port, so the peers learn it only now
+        vector<int> ports;
+        try
+        {
+            ports = exchange_ports(ntohs(listen_address.sin_port));
+        }
+        catch (...)
+        {
+            close(listener);
+            throw;
+        }
+        if (ports.size() != static_cast<size_t>(size))
+        {
+            close(listener);
+            throw ngraph_error("Ring rank " + to_string(rank) + " received " +
+                               to_string(ports.size()) + " ports for a ring of size " +
+                               to_string(size));
+        }
+
+        // Connect to the lower ranks, which may still be starting up
+        for (int peer = 0; peer < rank; peer++)
+        {
+            sockaddr_in peer_address = make_address(ports[peer]);
+            auto peer_sockaddr = reinterpret_cast<sockaddr*>(&peer_address);
+            auto deadline = chrono::steady_clock::now() + chrono::seconds(60);
+            int fd = -1;
+            while (fd < 0)
+            {
+                fd = socket(AF_INET, SOCK_STREAM, 0);
+                if (connect(fd, peer_sockaddr, sizeof(peer_address)) != 0)
+                {
+                    close(fd);
+                    fd = -1;
+                    if (chrono::steady_clock::now() > deadline)
+                    {
+                        close(listener);
+                        throw ngraph_error(errno_message("Ring rank " + to_string(rank) +
+                                                         " cannot connect to rank " +
+                                                         to_string(peer)));
+                    }
+                    this_thread::sleep_for(chrono::milliseconds(10));
+                }
+            }
+            m_sockets[peer] = fd;
+            int32_t id = rank;
+            send_bytes(peer, &id, sizeof(id));
+        }
+
+        // Accept the higher ranks, which identify themselves in their first message
+        for (int accepted = rank + 1; accepted < size; accepted++)
+        {
+            int fd = accept(listener, nullptr, nullptr);
+            if (fd < 0)
+            {
+                close(listener);
+                throw ngraph_error(errno_message("Ring rank " + to_string(rank) + " accept"));
+            }
+            int32_t id = -1;
+            size_t received = 0;
+            while (received < sizeof(id))
+            {
+                ssize_t n =
+                    ::recv(fd, reinterpret_cast<char*>(&id) + received, sizeof(id) - received, 0);
+                if (n <= 0)
+                {
+                    break;
+                }
+                received += n;
+            }
+            if (received != sizeof(id) || id <= rank || id >= size || m_sockets[id] >= 0)
+            {
+                close(fd);
+                close(listener);
+                throw ngraph_error("Ring rank " + to_string(rank) +
+                                   " received an invalid handshake");
+            }
+            m_sockets[id] = fd;
+        }
+        close(listener);
+
+        for (int fd : m_sockets)
+        {
+            if (fd >= 0)
+            {
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            }
+        }
+    }
+}
+
+distributed::Ring::~Ring()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+    for (int fd : m_sockets)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+}
+
+void distributed::Ring::send_bytes(int peer, const void* data, size_t bytes)
+{
+    const char* p = static_cast<const char*>(data);
+    while (bytes > 0)
+    {
+        ssize_t n = ::send(m_sockets[peer], p, bytes, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            throw ngraph_error(errno_message("Ring send to rank " + to_string(peer)));
+        }
+        p += n;
+        bytes -= n;
+    }
+}
+
+void distributed::Ring::recv_bytes(int peer, void* data, size_t bytes)
+{
+    char* p = static_cast<char*>(data);
+    while (bytes > 0)
+    {
+        ssize_t n = ::recv(m_sockets[peer], p, bytes, 0);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            throw ngraph_error(errno_message("Ring receive from rank " + to_string(peer)));
+        }
+        p += n;
+        bytes -= n;
+    }
+}
+
+// Send to the next rank while receiving from the previous one. Both directions make progress
+// together, so neither side stalls on a full socket buffer.
+void distributed::Ring::exchange(const void* send_data,
+                                 size_t send_size,
+                                 void* recv_data,
+                                 size_t recv_size)
+{
+    int next = m_sockets[(m_rank + 1) % m_size];
+    int prev = m_sockets[(m_rank + m_size - 1) % m_size];
+    const char* out = static_cast<const char*>(send_data);
+    char* in = static_cast<char*>(recv_data);
+    while (send_size > 0 || recv_size > 0)
+    {
+        pollfd fds[2];
+        nfds_t nfds = 0;
+        if (send_size > 0)
+        {
+            fds[nfds++] = {next, POLLOUT, 0};
+        }
+        if (recv_size > 0)
+        {
+            fds[nfds++] = {prev, POLLIN, 0};
+        }
+        if (poll(fds, nfds, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw ngraph_error(errno_message("Ring poll"));
+        }
+        for (nfds_t i = 0; i < nfds; i++)
+        {
+            if (fds[i].revents == 0)
+            {
+                continue;
+            }
+            if (fds[i].events == POLLOUT)
+            {
+                ssize_t n = ::send(next, out, send_size, MSG_NOSIGNAL | MSG_DONTWAIT);
+                if (n > 0)
+                {
+                    out += n;
+                    send_size -= n;
+                }
+                else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    throw ngraph_error(errno_message("Ring send to next rank"));
+                }
+            }
+            else
+            {
+                ssize_t n = ::recv(prev, in, recv_size, MSG_DONTWAIT);
+                if (n > 0)
+                {
+                    in += n;
+                    recv_size -= n;
+                }
+                else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    throw ngraph_error(errno_message("Ring receive from previous rank"));
+                }
+            }
+        }
+    }
+}
+
+#else
+
+distributed::Ring::Ring(int, int, int, const string&, size_t)
+{
+    throw ngraph_error("Ring distributed interface is not supported on Windows");
+}
+
+distributed::Ring::Ring(int, int, const PortExchange&, const string&, size_t)
+{
+    throw ngraph_error("Ring distributed interface is not supported on Windows");
+}
+
+void distributed::Ring::connect_ranks(int, const PortExchange&, const string&)
+{
+}
+
+distributed::Ring::~Ring()
+{
+}
+
+void distributed::Ring::send_bytes(int, const void*, size_t)
+{
+}
+
+void distributed::Ring::recv_bytes(int, void*, size_t)
+{
+}
+
+void distributed::Ring::exchange(const void*, size_t, void*, size_t)
+{
+}
+
+#endif
+
+unique_ptr<DistributedInterface> distributed::Ring::create_from_environment()
+{
+    int size = getenv_int("NGRAPH_RING_SIZE");
+    if (size < 1)
+    {
+        size = 1;
+    }
+    int rank = max(getenv_int("NGRAPH_RING_RANK"), 0);
+    int port = getenv_int("NGRAPH_RING_PORT");
+    if (port <= 0)
+    {
+        port = 29500;
+    }
+    string host = getenv_string("NGRAPH_RING_HOST");
+    if (host.empty())
+    {
+        host = "127.0.0.1";
+    }
+    int segment_bytes = getenv_int("NGRAPH_RING_SEGMENT_BYTES");
+    return unique_ptr<DistributedInterface>(
+        new Ring(rank,
+                 size,
+                 port,
+                 host,
+                 segment_bytes > 0 ? static_cast<size_t>(segment_bytes) : default_segment_bytes));
+}
+
+const string& distributed::Ring::get_name() const
+{
+    return m_name;
+}
+
+int distributed::Ring::get_size()
+{
+    return m_size;
+}
+
+int distributed::Ring::get_rank()
+{
+    return m_rank;
+}
+
+shared_ptr<distributed::Ring::Request> distributed::Ring::enqueue(function<void()> task)
+{
+    auto request = make_shared<Request>(move(task));
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(request);
+    }
+    m_condition.notify_one();
+    return request;
+}
+
+void distributed::Ring::run_queue()
+{
+    while (true)
+    {
+        shared_ptr<Request> request;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                return;
+            }
+            request = m_queue.front();
+            m_queue.pop_front();
+        }
+        request->run();
+    }
+}
+
+void distributed::Ring::ring_all_reduce(char* data,
+                                        size_t count,
+                                        element::Type_t element_type,
+                                        reduction::Type reduce_type)
+{
+    size_t element_size = element::Type(element_type).size();
+    size_t size = static_cast<size_t>(m_size);
+    size_t rank = static_cast<size_t>(m_rank);
+    auto chunk_begin = [&](size_t chunk) { return chunk * count / size; };
+    auto chunk_count = [&](size_t chunk) { return chunk_begin(chunk + 1) - chunk_begin(chunk); };
+    m_scratch.resize((count + size - 1) / size * element_size);
+
+    // Reduce-scatter: after step s this rank holds the sum over s + 2 ranks of chunk
+    // rank - s - 1. At the end it owns the fully reduced chunk rank + 1.
+    for (size_t step = 0; step < size - 1; step++)
+    {
+        size_t send_chunk = (rank + size - step) % size;
+        size_t recv_chunk = (rank + 2 * size - step - 1) % size;
+        exchange(data + chunk_begin(send_chunk) * element_size,
+                 chunk_count(send_chunk) * element_size,
+                 m_scratch.data(),
+                 chunk_count(recv_chunk) * element_size);
+        reduce(data + chunk_begin(recv_chunk) * element_size,
+               m_scratch.data(),
+               chunk_count(recv_chunk),
+               element_type,
+               reduce_type);
+    }
+
+    // All-gather: pass the reduced chunks once around the ring
+    for (size_t step = 0; step < size - 1; step++)
+    {
+        size_t send_chunk = (rank + size - step + 1) % size;
+        size_t recv_chunk = (rank + size - step) % size;
+        exchange(data + chunk_begin(send_chunk) * element_size,
+                 chunk_count(send_chunk) * element_size,
+                 data + chunk_begin(recv_chunk) * element_size,
+                 chunk_count(recv_chunk) * element_size);
+    }
+}
+
+void distributed::Ring::all_reduce(void* in,
+                                   void* out,
+                                   element::Type_t element_type,
+                                   reduction::Type reduce_type,
+                                   size_t count)
+{
+    all_reduce_async(in, out, element_type, reduce_type, count)->wait();
+}
+
+shared_ptr<DistributedRequest> distributed::Ring::all_reduce_async(void* in,
+                                                                   void* out,
+                                                                   element::Type_t element_type,
+                                                                   reduction::Type reduce_type,
+                                                                   size_t count)
+{
+    return enqueue([this, in, out, element_type, reduce_type, count]() {
+        size_t element_size = element::Type(element_type).size();
+        if (in != out)
+        {
+            memcpy(out, in, count * element_size);
+        }
+        if (m_size == 1)
+        {
+            return;
+        }
+        // Segment large tensors so the scratch buffer stays bounded and each exchange stays
+        // within a few socket buffers
+        size_t segment_count = max<size_t>(m_segment_bytes / element_size, 1);
+        char* data = static_cast<char*>(out);
+        for (size_t offset = 0; offset < count; offset += segment_count)
+        {
+            ring_all_reduce(data + offset * element_size,
+                            min(segment_count, count - offset),
+                            element_type,
+                            reduce_type);
+        }
+    });
+}
+
+void distributed::Ring::broadcast(void* in, element::Type_t element_type, size_t count, int root_id)
+{
+    enqueue([this, in, element_type, count, root_id]() {
+        size_t bytes = count * element::Type(element_type).size();
+        if (m_rank == root_id)
+        {
+            for (int peer = 0; peer < m_size; peer++)
+            {
+                if (peer != m_rank)
+                {
+                    send_bytes(peer, in, bytes);
+                }
+            }
+        }
+        else
+        {
+            recv_bytes(root_id, in, bytes);
+        }
+    })->wait();
+}
+
+void distributed::Ring::recv(void* in, element::Type_t element_type, size_t count, int src_id)
+{
+    enqueue([this, in, element_type, count, src_id]() {
+        recv_bytes(src_id, in, count * element::Type(element_type).size());
+    })->wait();
+}
+
+void distributed::Ring::send(const void* in,
+                             element::Type_t element_type,
+                             size_t count,
+                             int dest_id)
+{
+    enqueue([this, in, element_type, count, dest_id]() {
+        send_bytes(dest_id, in, count * element::Type(element_type).size());
+    })->wait();
+}
@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief Ring allreduce between processes (or threads) of one machine over TCP
+        ///        loopback.
+        ///
+        /// Rank r listens on base_port + r, or on a port the system picks, and keeps one
+        /// connection to every other rank.
+        /// all_reduce splits each buffer into segments of at most segment_bytes and runs a
+        /// reduce-scatter followed by an all-gather around the ring on every segment, so each
+        /// rank sends 2 * (size - 1) / size of the data whatever the number of ranks.
+        ///
+        /// All operations run in order on a communication thread. all_reduce_async returns as
+        /// soon as the operation is queued, which lets the caller keep computing while the
+        /// reduction is in flight.
+        class NGRAPH_API Ring : public DistributedInterface
+        {
+        public:
+            static constexpr size_t default_segment_bytes = 4 * 1024 * 1024;
+
+            /// \brief Receives the port this rank listens on and returns the listening ports of
+            ///        all ranks, indexed by rank
+            using PortExchange = std::function<std::vector<int>(int port)>;
+
+            /// \brief Connect to the other ranks; blocks until all of them are reachable
+            Ring(int rank,
+                 int size,
+                 int base_port,
+                 const std::string& host = "127.0.0.1",
+                 size_t segment_bytes = default_segment_bytes);
+            /// \brief Connect to the other ranks, listening on a port picked by the system.
+            ///        exchange_ports shares that port with the other ranks, e.g. through the
+            ///        launcher, so no fixed port range has to be free.
+            Ring(int rank,
+                 int size,
+                 const PortExchange& exchange_ports,
+                 const std::string& host = "127.0.0.1",
+                 size_t segment_bytes = default_segment_bytes);
+            ~Ring() override;
+
+            /// \brief Ring configured by NGRAPH_RING_RANK, NGRAPH_RING_SIZE, NGRAPH_RING_PORT
+            ///        (default 29500), NGRAPH_RING_HOST (default 127.0.0.1) and
+            ///        NGRAPH_RING_SEGMENT_BYTES
+            static std::unique_ptr<DistributedInterface> create_from_environment();
+
+            const std::string& get_name() const override;
+            int get_size() override;
+            int get_rank() override;
+
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+            std::shared_ptr<DistributedRequest>
+                all_reduce_async(void* in,
+                                 void* out,
+                                 element::Type_t element_type,
+                                 reduction::Type reduce_type,
+                                 size_t count) override;
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+        private:
+            class Request;
+
+            void connect_ranks(int listen_port,
+                               const PortExchange& exchange_ports,
+                               const std::string& host);
+            std::shared_ptr<Request> enqueue(std::function<void()> task);
+            void run_queue();
+            void ring_all_reduce(char* data,
+                                 size_t count,
+                                 element::Type_t element_type,
+                                 reduction::Type reduce_type);
+            void send_bytes(int peer, const void* data, size_t bytes);
+            void recv_bytes(int peer, void* data, size_t bytes);
+            void exchange(const void* send_data,
+                          size_t send_size,
+                          void* recv_data,
+                          size_t recv_size);
+
+            std::string m_name{"RING"};
+            int m_rank;
+            int m_size;
+            size_t m_segment_bytes;
+            // Socket connected to each rank, -1 for this rank
+            std::vector<int> m_sockets;
+            std::vector<char> m_scratch;
+
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::shared_ptr<Request>> m_queue;
+            bool m_stop = false;
+            std::thread m_thread;
+        };
+    }
+}
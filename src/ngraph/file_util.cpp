@@ -20,6 +20,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -36,6 +37,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 
 #ifdef _WIN32
 #define RMDIR(a) RemoveDirectoryA(a)
@@ -229,6 +231,40 @@ vector<char> file_util::read_file_contents(const string& path)
     return data;
 }
 
+shared_ptr<runtime::AlignedBuffer> file_util::map_file(const string& path)
+{
+    size_t file_size = get_file_size(path);
+#ifdef _WIN32
+    auto buffer = make_shared<runtime::AlignedBuffer>(file_size);
+    vector<char> data = read_file_contents(path);
+    memcpy(buffer->get_ptr(), data.data(), file_size);
+    return buffer;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw runtime_error("error opening file '" + path + "'");
+    }
+    void* addr = nullptr;
+    if (file_size > 0)
+    {
+        addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        throw runtime_error("error mapping file '" + path + "'");
+    }
+    shared_ptr<void> mapping(addr, [file_size](void* p) {
+        if (p)
+        {
+            munmap(p, file_size);
+        }
+    });
+    return make_shared<runtime::SharedBuffer>(static_cast<char*>(addr), file_size, mapping);
+#endif
+}
+
 string file_util::read_file_to_string(const string& path)
 {
     ifstream f(path);
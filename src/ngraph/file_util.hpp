@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,11 @@
 
 namespace ngraph
 {
+    namespace runtime
+    {
+        class AlignedBuffer;
+    }
+
     namespace file_util
     {
         /// \brief Returns the name with extension for a given path
@@ -92,6 +98,16 @@ namespace ngraph
         NGRAPH_API
         std::string read_file_to_string(const std::string& path);
 
+        /// \brief Maps the contents of a file into memory
+        ///
+        /// Pages are loaded on first access and are copy-on-write, so modifying the buffer never
+        /// changes the file. Where memory mapping is not available the file is read instead.
+        /// \param path The path of the file to map
+        /// \return A buffer that keeps the mapping alive for as long as it, or any buffer sharing
+        ///         it, exists
+        NGRAPH_API
+        std::shared_ptr<runtime::AlignedBuffer> map_file(const std::string& path);
+
         /// \brief Iterate through files and optionally directories. Symbolic links are skipped.
         /// \param path The path to iterate over
         /// \param func A callback function called with each file or directory encountered
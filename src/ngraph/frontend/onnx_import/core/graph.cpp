@@ -14,11 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
 #include <functional>
 #include <numeric>
+#include <set>
 #include <sstream>
+#include <thread>
 
 #include "graph.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "node.hpp"
 #include "provenance.hpp"
 #include "utils/common.hpp"
@@ -75,6 +83,24 @@ namespace ngraph
                     strings.begin() + 1, strings.end(), strings.begin()->get(), concat_with_comma);
             }
 
+            static bool has_subgraph(const ONNX_NAMESPACE::NodeProto& node_proto)
+            {
+                for (const auto& attribute : node_proto.attribute())
+                {
+                    if (attribute.type() == ONNX_NAMESPACE::AttributeProto_AttributeType_GRAPH ||
+                        attribute.type() == ONNX_NAMESPACE::AttributeProto_AttributeType_GRAPHS)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /// \brief Stand-ins for the inputs of the node that this thread is converting, see
+            ///        Graph::convert_nodes_parallel.
+            thread_local const std::map<std::string, Output<ngraph::Node>>* t_input_placeholders =
+                nullptr;
+
             static std::string build_input_provenance_tag(const std::string& input_name,
                                                           const PartialShape& shape)
             {
@@ -98,6 +124,17 @@ namespace ngraph
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
+            // Initializers are only materialized when some node or graph output uses them
+            std::set<std::string> used_names;
+            for (const auto& node_proto : m_graph_proto->node())
+            {
+                used_names.insert(std::begin(node_proto.input()), std::end(node_proto.input()));
+            }
+            for (const auto& output : m_graph_proto->output())
+            {
+                used_names.insert(output.name());
+            }
+
             // Process all initializers in the graph
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
@@ -105,9 +142,13 @@ namespace ngraph
                 {
                     Tensor tensor = Tensor{initializer_tensor};
                     m_initializers.emplace(initializer_tensor.name(), tensor);
+                    if (used_names.count(initializer_tensor.name()) == 0)
+                    {
+                        continue;
+                    }
 
                     // For each initializer, create a Constant node and store in cache
-                    auto ng_constant = tensor.get_ng_constant();
+                    auto ng_constant = make_ng_constant(tensor);
                     add_provenance_tag_to_initializer(tensor, ng_constant);
                     m_ng_node_cache.emplace(initializer_tensor.name(), std::move(ng_constant));
                 }
@@ -118,8 +159,8 @@ namespace ngraph
             {
                 m_inputs.emplace_back(input);
 
-                // Check if a Constant node was already created from an initializer
-                if (m_ng_node_cache.count(input.name()) > 0)
+                // Check if the input is given by an initializer
+                if (m_initializers.count(input.name()) > 0)
                 {
                     continue;
                 }
@@ -170,20 +211,247 @@ namespace ngraph
                          detail::to_string(unknown_operators));
 
             // Process ONNX graph nodes, convert to nGraph nodes
+            m_nodes.reserve(m_graph_proto->node_size());
             for (const auto& node_proto : m_graph_proto->node())
             {
                 m_nodes.emplace_back(node_proto, *this);
-                const Node& node{m_nodes.back()};
+            }
+
+            const std::size_t thread_count = static_cast<std::size_t>(
+                std::max(getenv_int("NGRAPH_ONNX_IMPORT_THREADS", 1), 1));
+            if (thread_count > 1)
+            {
+                convert_nodes_parallel(thread_count);
+            }
+            else
+            {
+                for (const Node& node : m_nodes)
+                {
+                    add_to_cache(node, node.get_ng_nodes());
+                }
+            }
+        }
+
+        void Graph::add_to_cache(const Node& node, const OutputVector& ng_nodes)
+        {
+            // Iterate over the number of outputs for given node in graph.
+            // Some of them may be optional and trimmed. See:
+            // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
+            for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
+            {
+                m_ng_node_cache[node.output(i)] = ng_nodes.at(i);
+            }
+        }
+
+        void Graph::convert_nodes_parallel(std::size_t thread_count)
+        {
+            // Group the nodes into levels, a node only depends on nodes of lower levels. ONNX
+            // requires the nodes to be sorted topologically, so producers are seen first.
+            std::map<std::string, std::size_t> producer_level;
+            std::vector<std::vector<std::size_t>> levels;
+            for (std::size_t i = 0; i < m_nodes.size(); ++i)
+            {
+                const auto& node_proto = m_graph_proto->node(i);
+                std::size_t level = 0;
+                for (const auto& name : node_proto.input())
+                {
+                    const auto it = producer_level.find(name);
+                    if (it != std::end(producer_level))
+                    {
+                        level = std::max(level, it->second + 1);
+                    }
+                }
+                if (level == levels.size())
+                {
+                    levels.emplace_back();
+                }
+                levels[level].push_back(i);
+                for (const auto& name : node_proto.output())
+                {
+                    producer_level[name] = level;
+                }
+            }
+
+            for (const auto& level : levels)
+            {
+                // Only the operator factories run concurrently. They read the node cache, which
+                // is not modified until all nodes of the level have been converted. Each node is
+                // built on stand-ins for its inputs, so concurrently built nodes never share an
+                // argument, and it is linked to the real inputs on this thread afterwards.
+                std::vector<OutputVector> ng_nodes(level.size());
+                std::vector<InputPlaceholders> placeholders(level.size());
+                std::vector<std::exception_ptr> errors(level.size());
+                auto convert = [&](std::size_t i, bool use_placeholders) {
+                    try
+                    {
+                        const Node& node = m_nodes[level[i]];
+                        if (use_placeholders)
+                        {
+                            const auto& node_proto = m_graph_proto->node(level[i]);
+                            placeholders[i] = make_input_placeholders(node_proto);
+                            detail::t_input_placeholders = &placeholders[i];
+                        }
+                        ng_nodes[i] = m_model->get_operator(node.op_type(), node.domain())(node);
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                    detail::t_input_placeholders = nullptr;
+                };
+                std::atomic<std::size_t> next{0};
+                auto worker = [&]() {
+                    for (std::size_t i = next++; i < level.size(); i = next++)
+                    {
+                        if (!detail::has_subgraph(m_graph_proto->node(level[i])))
+                        {
+                            convert(i, true);
+                        }
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (std::size_t t = 1; t < std::min(thread_count, level.size()); ++t)
+                {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                // Subgraphs are imported with the Model, which is not safe to share
+                for (std::size_t i = 0; i < level.size(); ++i)
+                {
+                    if (detail::has_subgraph(m_graph_proto->node(level[i])))
+                    {
+                        convert(i, false);
+                    }
+                }
+
+                // Report the first failure in model order, as the serial import would
+                for (std::size_t i = 0; i < level.size(); ++i)
+                {
+                    if (errors[i])
+                    {
+                        std::rethrow_exception(errors[i]);
+                    }
+                }
+                for (std::size_t i = 0; i < level.size(); ++i)
+                {
+                    const Node& node = m_nodes[level[i]];
+                    link_input_placeholders(node, placeholders[i], ng_nodes[i]);
+                    set_friendly_names(node, ng_nodes[i]);
+                    add_provenance_tags(node, ng_nodes[i]);
+                    add_to_cache(node, ng_nodes[i]);
+                }
+            }
+        }
+
+        Graph::InputPlaceholders
+            Graph::make_input_placeholders(const ONNX_NAMESPACE::NodeProto& node_proto) const
+        {
+            // Constants are copied, sharing their data, because operator factories may read them
+            InputPlaceholders placeholders;
+            for (const auto& name : node_proto.input())
+            {
+                if (name.empty() || placeholders.count(name) > 0)
+                {
+                    continue;
+                }
+                const Output<ngraph::Node> source = m_ng_node_cache.at(name);
+                if (source.get_node()->is_constant())
+                {
+                    placeholders[name] = source.get_node()->copy_with_new_inputs({})->output(0);
+                }
+                else
+                {
+                    placeholders[name] = std::make_shared<default_opset::Parameter>(
+                        source.get_element_type(), source.get_partial_shape());
+                }
+            }
+            return placeholders;
+        }
+
+        void Graph::link_input_placeholders(const Node& onnx_node,
+                                            const InputPlaceholders& placeholders,
+                                            OutputVector& ng_nodes) const
+        {
+            if (placeholders.empty())
+            {
+                return;
+            }
+            for (const auto& placeholder : placeholders)
+            {
+                const Output<ngraph::Node> source = m_ng_node_cache.at(placeholder.first);
+                for (auto& input : placeholder.second.get_target_inputs())
+                {
+                    input.replace_source_output(source);
+                }
+                // Operators like Identity return their inputs
+                std::replace(std::begin(ng_nodes), std::end(ng_nodes), placeholder.second, source);
+            }
 
-                OutputVector ng_nodes{node.get_ng_nodes()};
-                // Iterate over the number of outputs for given node in graph.
-                // Some of them may be optional and trimmed. See:
-                // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
-                for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
+            // Types were inferred from the placeholders, infer them again from the real inputs
+            NodeVector nodes;
+            traverse_nodes(ng_nodes,
+                           [&nodes](std::shared_ptr<ngraph::Node> node) { nodes.push_back(node); },
+                           onnx_node.get_ng_inputs());
+            validate_nodes_and_infer_types(nodes);
+        }
+
+        Output<ngraph::Node> Graph::get_ng_node_from_cache(const std::string& name) const
+        {
+            if (detail::t_input_placeholders != nullptr)
+            {
+                const auto it = detail::t_input_placeholders->find(name);
+                if (it != std::end(*detail::t_input_placeholders))
                 {
-                    m_ng_node_cache[node.output(i)] = ng_nodes.at(i);
+                    return it->second;
                 }
             }
+            return m_ng_node_cache.at(name);
+        }
+
+        std::shared_ptr<default_opset::Constant> Graph::make_ng_constant(const Tensor& tensor)
+        {
+            if (!tensor.has_external_data())
+            {
+                return tensor.get_ng_constant();
+            }
+
+            // The data is used in place from the memory-mapped file when it is suitably aligned
+            const auto external_data = tensor.get_external_data();
+            const auto file = m_model->get_external_data(external_data.location);
+            const element::Type& type = tensor.get_ng_type();
+            const std::size_t byte_size = shape_size(tensor.get_shape()) * type.size();
+            NGRAPH_CHECK(external_data.length == 0 || external_data.length == byte_size,
+                         "External data of tensor ",
+                         tensor.get_name(),
+                         " has ",
+                         external_data.length,
+                         " bytes, expected ",
+                         byte_size);
+            NGRAPH_CHECK(external_data.offset + byte_size <= file->size(),
+                         "External data of tensor ",
+                         tensor.get_name(),
+                         " exceeds the size of ",
+                         external_data.location);
+
+            char* data = file->get_ptr<char>() + external_data.offset;
+            std::shared_ptr<runtime::AlignedBuffer> buffer;
+            if (reinterpret_cast<std::uintptr_t>(data) % type.size() == 0)
+            {
+                buffer = std::make_shared<runtime::SharedBuffer>(data, byte_size, file);
+            }
+            else
+            {
+                buffer = std::make_shared<runtime::AlignedBuffer>(byte_size);
+                std::memcpy(buffer->get_ptr(), data, byte_size);
+            }
+            auto constant =
+                std::make_shared<default_opset::Constant>(type, tensor.get_shape(), buffer);
+            constant->set_friendly_name(tensor.get_name());
+            return constant;
         }
 
         OutputVector Graph::get_ng_outputs() const
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <map>
 #include <onnx/onnx_pb.h>
 #include <string>
 #include <vector>
@@ -39,10 +40,7 @@ namespace ngraph
             const std::vector<ValueInfo>& get_outputs() const { return m_outputs; }
             OutputVector get_ng_outputs() const;
             const ParameterVector& get_ng_parameters() const { return m_parameters; }
-            Output<ngraph::Node> get_ng_node_from_cache(const std::string& name) const
-            {
-                return m_ng_node_cache.at(name);
-            }
+            Output<ngraph::Node> get_ng_node_from_cache(const std::string& name) const;
             const std::string& get_name() const { return m_graph_proto->name(); }
             OutputVector make_ng_nodes(const Node& onnx_node) const;
 
@@ -60,6 +58,22 @@ namespace ngraph
                                      const OutputVector& ng_node_vector) const;
 
         private:
+            void add_to_cache(const Node& onnx_node, const OutputVector& ng_nodes);
+
+            /// \brief Convert the nodes with NGRAPH_ONNX_IMPORT_THREADS threads, nodes that do
+            ///        not depend on each other are converted concurrently.
+            void convert_nodes_parallel(std::size_t thread_count);
+
+            using InputPlaceholders = std::map<std::string, Output<ngraph::Node>>;
+            InputPlaceholders
+                make_input_placeholders(const ONNX_NAMESPACE::NodeProto& node_proto) const;
+            /// \brief Replaces the placeholders that a node was converted on with its inputs.
+            void link_input_placeholders(const Node& onnx_node,
+                                         const InputPlaceholders& placeholders,
+                                         OutputVector& ng_nodes) const;
+
+            std::shared_ptr<default_opset::Constant> make_ng_constant(const Tensor& tensor);
+
             const ONNX_NAMESPACE::GraphProto* m_graph_proto;
             std::vector<Node> m_nodes;
             std::vector<ValueInfo> m_inputs;
@@ -17,6 +17,7 @@
 #include <onnx/onnx_pb.h>
 
 #include "model.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ops_bridge.hpp"
 
@@ -24,8 +25,9 @@ namespace ngraph
 {
     namespace onnx_import
     {
-        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto)
+        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto, const std::string& model_dir)
             : m_model_proto{&model_proto}
+            , m_model_dir{model_dir}
         {
             // Walk through the elements of opset_import field and register operator sets
             // for each domain. An exception UnknownDomain() will raise if the domain is
@@ -91,5 +93,17 @@ namespace ngraph
                 m_opset.emplace(domain, opset);
             }
         }
+
+        std::shared_ptr<runtime::AlignedBuffer>
+            Model::get_external_data(const std::string& location)
+        {
+            auto it = m_external_data.find(location);
+            if (it == std::end(m_external_data))
+            {
+                const std::string path = file_util::path_join(m_model_dir, location);
+                it = m_external_data.emplace(location, file_util::map_file(path)).first;
+            }
+            return it->second;
+        }
     }
 }
@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "operator_set.hpp"
 
 namespace ngraph
@@ -31,7 +33,10 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \param model_proto  The model.
+            /// \param model_dir    The directory external tensor data is relative to.
+            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                           const std::string& model_dir = "");
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -72,9 +77,22 @@ namespace ngraph
             ///
             void enable_opset_domain(const std::string& domain);
 
+            /// \brief      Get the contents of an external data file of this model.
+            ///
+            /// \note       Every file is memory-mapped once and shared by all the tensors
+            ///             stored in it.
+            ///
+            /// \param[in]  location  The path of the file relative to the model directory.
+            ///
+            std::shared_ptr<runtime::AlignedBuffer>
+                get_external_data(const std::string& location);
+
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
+            std::string m_model_dir;
+            std::unordered_map<std::string, std::shared_ptr<runtime::AlignedBuffer>>
+                m_external_data;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Model& model)
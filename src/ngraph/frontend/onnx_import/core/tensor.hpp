@@ -17,6 +17,7 @@
 #pragma once
 
 #include <onnx/onnx_pb.h>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -90,6 +91,14 @@ namespace ngraph
                     {
                     }
                 };
+
+                struct unspecified_external_data_location : ngraph_error
+                {
+                    unspecified_external_data_location()
+                        : ngraph_error{"tensor has no external data location specified"}
+                    {
+                    }
+                };
             }
         }
 
@@ -383,6 +392,16 @@ namespace ngraph
                 complex128 = ONNX_NAMESPACE::TensorProto_DataType_COMPLEX128
             };
 
+            /// \brief Location of the data of a tensor stored outside of the model file
+            struct ExternalData
+            {
+                /// Path of the data file, relative to the directory of the model
+                std::string location;
+                std::size_t offset{0};
+                /// Number of bytes, zero when the data extends to the end of the file
+                std::size_t length{0};
+            };
+
             Tensor() = delete;
             explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
                 : m_tensor_proto{&tensor}
@@ -423,6 +442,38 @@ namespace ngraph
                 return m_tensor_proto->name();
             }
 
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
+            }
+
+            ExternalData get_external_data() const
+            {
+                ExternalData external_data;
+                for (const auto& entry : m_tensor_proto->external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        external_data.location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        external_data.offset = std::stoull(entry.value());
+                    }
+                    else if (entry.key() == "length")
+                    {
+                        external_data.length = std::stoull(entry.value());
+                    }
+                }
+                if (external_data.location.empty())
+                {
+                    throw error::tensor::unspecified_external_data_location{};
+                }
+                return external_data;
+            }
+
             Type get_type() const
             {
                 if (!m_tensor_proto->has_data_type())
@@ -508,8 +559,20 @@ namespace ngraph
             std::shared_ptr<ngraph::op::v0::Constant>
                 make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::v0::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::v0::Constant> constant;
+                // Raw data already has the in-memory layout of the Constant, so it is copied
+                // once instead of going through an intermediate vector
+                if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment() &&
+                    m_tensor_proto->raw_data().size() == shape_size(m_shape) * sizeof(T))
+                {
+                    constant = std::make_shared<ngraph::op::v0::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                else
+                {
+                    constant =
+                        std::make_shared<ngraph::op::v0::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
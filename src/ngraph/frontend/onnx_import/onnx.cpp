@@ -22,6 +22,7 @@
 #include "core/graph.hpp"
 #include "core/model.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -51,32 +52,42 @@ namespace ngraph
             }
         }
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        namespace detail
         {
-            ONNX_NAMESPACE::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                        const std::string& model_dir)
             {
-                // Rewind to the beginning and clear stream state.
-                stream.clear();
-                stream.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&stream);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                ONNX_NAMESPACE::ModelProto model_proto;
+                // Try parsing input as a binary protobuf message
+                if (!model_proto.ParseFromIstream(&stream))
                 {
-                    throw detail::error::stream_parse{stream};
+                    // Rewind to the beginning and clear stream state.
+                    stream.clear();
+                    stream.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&stream);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                    {
+                        throw error::stream_parse{stream};
+                    }
                 }
-            }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
-            {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                Model model{model_proto, model_dir};
+                Graph graph{model_proto.graph(), model};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                return function;
             }
-            return function;
+        }
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return detail::import_onnx_model(stream, "");
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -86,7 +97,11 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // Paths of external tensor data are relative to the directory of the model
+            const std::string model_dir = file_path.find('/') == std::string::npos
+                                              ? ""
+                                              : file_util::get_directory(file_path);
+            return detail::import_onnx_model(ifs, model_dir);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
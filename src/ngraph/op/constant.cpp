@@ -20,6 +20,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -155,7 +156,17 @@ op::v0::Constant::Constant(const element::Type& type,
         {
             throw std::runtime_error("deserialize unsupported type dynamic");
         }
-        case element::Type_t::u1: { throw std::runtime_error("deserialize unsupported type u1");
+        case element::Type_t::i4:
+        case element::Type_t::u4:
+        case element::Type_t::u1:
+        {
+            int64_t value = parse_string<int64_t>(values[0]);
+            auto target = get_data_ptr_nc();
+            for (size_t i = 0; i < shape_size(m_shape); i++)
+            {
+                packed::set(m_element_type, target, i, value);
+            }
+            break;
         }
         }
         m_all_elements_bitwise_identical = true;
@@ -175,20 +186,14 @@ op::v0::Constant::Constant(const element::Type& type,
         {
             vector<float> value = parse_string<float>(values);
             auto target = get_data_ptr_nc<element::Type_t::bf16>();
-            for (size_t i = 0; i < value.size(); i++)
-            {
-                target[i] = value[i];
-            }
+            bfloat16::from_float(value.data(), target, value.size());
             break;
         }
         case element::Type_t::f16:
         {
             vector<float> value = parse_string<float>(values);
             auto target = get_data_ptr_nc<element::Type_t::f16>();
-            for (size_t i = 0; i < value.size(); i++)
-            {
-                target[i] = value[i];
-            }
+            float16::from_float(value.data(), target, value.size());
             break;
         }
         case element::Type_t::f32:
@@ -265,7 +270,18 @@ op::v0::Constant::Constant(const element::Type& type,
             throw std::runtime_error("deserialize unsupported type undefined");
         case element::Type_t::dynamic:
             throw std::runtime_error("deserialize unsupported type dynamic");
-        case element::Type_t::u1: throw std::runtime_error("deserialize unsupported type u1");
+        case element::Type_t::i4:
+        case element::Type_t::u4:
+        case element::Type_t::u1:
+        {
+            vector<int64_t> value = parse_string<int64_t>(values);
+            auto target = get_data_ptr_nc();
+            for (size_t i = 0; i < value.size(); i++)
+            {
+                packed::set(m_element_type, target, i, value[i]);
+            }
+            break;
+        }
         }
         m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
     }
@@ -281,20 +297,44 @@ op::v0::Constant::Constant(const element::Type& type, const Shape& shape)
 
 void* op::v0::Constant::allocate_buffer()
 {
-    m_data = make_shared<runtime::AlignedBuffer>(shape_size(m_shape) * m_element_type.size(),
-                                                 host_alignment());
+    m_data = make_shared<runtime::AlignedBuffer>(
+        packed::byte_size(m_element_type, shape_size(m_shape)), host_alignment());
+    if (packed::is_packed(m_element_type))
+    {
+        // Elements are written a few bits at a time, so the padding bits must start out clear
+        std::memset(get_data_ptr_nc(), 0, m_data->size());
+    }
     return get_data_ptr_nc();
 }
 
 op::v0::Constant::Constant(const element::Type& type, const Shape& shape, const void* data)
     : Constant(type, shape)
 {
-    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    size_t size = packed::byte_size(m_element_type, shape_size(m_shape));
     std::memcpy(get_data_ptr_nc(), data, size);
     constructor_validate_and_infer_types();
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::v0::Constant::Constant(const element::Type& type,
+                           const Shape& shape,
+                           const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = packed::byte_size(m_element_type, shape_size(m_shape));
+    NODE_VALIDATION_CHECK(this,
+                          m_data != nullptr && m_data->size() >= size,
+                          "Buffer of ",
+                          (m_data ? m_data->size() : 0),
+                          " bytes is too small for a constant of ",
+                          size,
+                          " bytes");
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::v0::Constant::Constant(const Constant& other)
     : Constant(other.m_element_type, other.m_shape)
 {
@@ -328,8 +368,10 @@ string op::v0::Constant::convert_value_to_string(size_t index) const
     case element::Type_t::i16: rc = to_string(get_vector<int16_t>()[index]); break;
     case element::Type_t::i32: rc = to_string(get_vector<int32_t>()[index]); break;
     case element::Type_t::i64: rc = to_string(get_vector<int64_t>()[index]); break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
-        rc = to_string((get_vector<uint8_t>()[index / 8] >> (7 - (index % 8))) & 1);
+        rc = to_string(packed::get(get_output_element_type(0), get_data_ptr(), index));
         break;
     case element::Type_t::u8: rc = to_string(get_vector<uint8_t>()[index]); break;
     case element::Type_t::u16: rc = to_string(get_vector<uint16_t>()[index]); break;
@@ -433,7 +475,14 @@ vector<string> op::v0::Constant::get_value_strings() const
             rc.push_back(to_string(value));
         }
         break;
-    case element::Type_t::u1: throw runtime_error("unsupported type");
+    case element::Type_t::i4:
+    case element::Type_t::u4:
+    case element::Type_t::u1:
+        for (size_t i = 0; i < shape_size(m_shape); i++)
+        {
+            rc.push_back(to_string(packed::get(m_element_type, get_data_ptr(), i)));
+        }
+        break;
     case element::Type_t::undefined: throw runtime_error("unsupported type");
     case element::Type_t::dynamic: throw runtime_error("unsupported type");
     }
@@ -581,6 +630,8 @@ bool op::v0::Constant::are_all_data_elements_bitwise_identical() const
         rc = test_bitwise_identical<uint64_t>(this);
         break;
     }
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::undefined:
     case element::Type_t::dynamic: break;
@@ -26,6 +26,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/element_type_traits.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -205,7 +206,14 @@ namespace ngraph
                                 typename element_type_traits<element::Type_t::u64>::value_type>(
                                 value));
                         break;
-                    case element::Type_t::u1: throw std::runtime_error("unsupported type");
+                    case element::Type_t::i4:
+                    case element::Type_t::u4:
+                    case element::Type_t::u1:
+                        for (size_t i = 0; i < size; i++)
+                        {
+                            packed::set(type, get_data_ptr_nc(), i, static_cast<int64_t>(value));
+                        }
+                        break;
                     case element::Type_t::undefined: throw std::runtime_error("unsupported type");
                     case element::Type_t::dynamic: throw std::runtime_error("unsupported type");
                     }
@@ -233,6 +241,15 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that uses the supplied buffer in place
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data The buffer holding the constant data. It is shared, not copied.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -323,6 +340,16 @@ namespace ngraph
                 template <typename T>
                 std::vector<T> get_vector() const
                 {
+                    if (packed::is_packed(m_element_type))
+                    {
+                        // One T per element of a u1, u4 or i4 constant
+                        std::vector<T> rc(shape_size(m_shape));
+                        for (size_t i = 0; i < rc.size(); i++)
+                        {
+                            rc[i] = static_cast<T>(packed::get(m_element_type, get_data_ptr(), i));
+                        }
+                        return rc;
+                    }
                     if (sizeof(T) > m_element_type.size() && shape_size(m_shape) > 0)
                     {
                         throw ngraph_error("Buffer over-read");
@@ -485,13 +512,30 @@ namespace ngraph
                 template <typename T, typename U>
                 void write_buffer(void* target, const std::vector<U>& source, size_t count)
                 {
-                    T* p = reinterpret_cast<T*>(target);
+                    convert_buffer(reinterpret_cast<T*>(target), source, count);
+                }
+
+                template <typename T, typename U>
+                static void convert_buffer(T* p, const std::vector<U>& source, size_t count)
+                {
                     for (size_t i = 0; i < count; i++)
                     {
                         p[i] = static_cast<T>(source[i]);
                     }
                 }
 
+                static void
+                    convert_buffer(bfloat16* p, const std::vector<float>& source, size_t count)
+                {
+                    bfloat16::from_float(source.data(), p, count);
+                }
+
+                static void
+                    convert_buffer(float16* p, const std::vector<float>& source, size_t count)
+                {
+                    float16::from_float(source.data(), p, count);
+                }
+
                 template <typename T>
                 void write_to_buffer(const element::Type& target_type,
                                      const Shape& /* target_shape */,
@@ -549,7 +593,15 @@ namespace ngraph
                     case element::Type_t::u64:
                         write_buffer<uint64_t, T>(target, source, target_element_count);
                         break;
-                    case element::Type_t::u1: throw std::runtime_error("unsupported type");
+                    case element::Type_t::i4:
+                    case element::Type_t::u4:
+                    case element::Type_t::u1:
+                        for (size_t i = 0; i < target_element_count; i++)
+                        {
+                            packed::set(
+                                target_type, target, i, static_cast<int64_t>(source[i]));
+                        }
+                        break;
                     case element::Type_t::undefined: throw std::runtime_error("unsupported type");
                     case element::Type_t::dynamic: throw std::runtime_error("unsupported type");
                     }
@@ -87,6 +87,8 @@ shared_ptr<Node> op::v0::Max::get_default_value() const
         return make_constant_from_string(to_string(numeric_limits<uint64_t>::min()),
                                          get_output_element_type(0),
                                          get_output_shape(0));
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
@@ -216,6 +216,8 @@ void op::v0::Range::validate_and_infer_types()
     case element::Type_t::u32: result_shape = infer_output_shape<uint32_t>(this, result_et); break;
     case element::Type_t::u64: result_shape = infer_output_shape<uint64_t>(this, result_et); break;
     case element::Type_t::dynamic: result_shape = PartialShape::dynamic(1); break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::undefined:
     case element::Type_t::boolean:
@@ -46,6 +46,8 @@ namespace
         {
         case element::Type_t::undefined: rc = false; break;
         case element::Type_t::dynamic: rc = false; break;
+        case element::Type_t::i4:
+        case element::Type_t::u4:
         case element::Type_t::u1:
             rc = false;
             break;
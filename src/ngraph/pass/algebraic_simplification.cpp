@@ -292,6 +292,8 @@ static bool is_uniform_constant(const op::v0::Constant* constant, int value)
             rc = *static_cast<const int64_t*>(constant->get_data_ptr()) ==
                  static_cast<int64_t>(value);
             break;
+        case ngraph::element::Type_t::i4:
+        case ngraph::element::Type_t::u4:
         case ngraph::element::Type_t::u1: throw runtime_error("is_value type not supported");
         case ngraph::element::Type_t::u8:
             rc = *static_cast<const uint8_t*>(constant->get_data_ptr()) ==
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t pass::AllReduceBucketing::default_bucket_bytes;
+
+static void fuse_bucket(const vector<shared_ptr<op::v0::AllReduce>>& bucket)
+{
+    OutputVector flat_args;
+    for (auto& all_reduce : bucket)
+    {
+        auto arg = all_reduce->input_value(0);
+        flat_args.push_back(make_shared<op::v0::Reshape>(
+            arg, get_default_order(arg.get_shape()), Shape{shape_size(arg.get_shape())}));
+    }
+    auto fused = make_shared<op::v0::AllReduce>(make_shared<op::v0::Concat>(flat_args, 0),
+                                                bucket.front()->get_reduce_type());
+    NGRAPH_DEBUG << "Fused " << bucket.size() << " AllReduces into " << fused->get_name();
+
+    size_t offset = 0;
+    for (auto& all_reduce : bucket)
+    {
+        const Shape& shape = all_reduce->get_output_shape(0);
+        size_t size = shape_size(shape);
+        auto slice =
+            make_shared<op::v0::Slice>(fused, Coordinate{offset}, Coordinate{offset + size});
+        auto reshape = make_shared<op::v0::Reshape>(slice, AxisVector{0}, shape);
+        replace_node(all_reduce, reshape);
+        offset += size;
+    }
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> function)
+{
+    // Nodes computed from the result of some AllReduce. Fusing an AllReduce of such a node
+    // with one it depends on would create a cycle, so they are left alone.
+    unordered_set<Node*> after_all_reduce;
+    vector<shared_ptr<op::v0::AllReduce>> candidates;
+    for (auto& node : function->get_ordered_ops())
+    {
+        bool depends = false;
+        for (auto& input : node->inputs())
+        {
+            if (after_all_reduce.count(input.get_source_output().get_node()))
+            {
+                depends = true;
+                break;
+            }
+        }
+        auto all_reduce = as_type_ptr<op::v0::AllReduce>(node);
+        if (all_reduce)
+        {
+            if (!depends && shape_size(all_reduce->get_output_shape(0)) > 0)
+            {
+                candidates.push_back(all_reduce);
+            }
+            depends = true;
+        }
+        if (depends)
+        {
+            after_all_reduce.insert(node.get());
+        }
+    }
+
+    // Open bucket and its size in bytes per element type and reduction
+    map<pair<element::Type, reduction::Type>,
+        pair<vector<shared_ptr<op::v0::AllReduce>>, size_t>>
+        open_buckets;
+    bool modified = false;
+    auto flush = [&modified](vector<shared_ptr<op::v0::AllReduce>>& bucket) {
+        if (bucket.size() > 1)
+        {
+            fuse_bucket(bucket);
+            modified = true;
+        }
+        bucket.clear();
+    };
+    for (auto& all_reduce : candidates)
+    {
+        const element::Type& type = all_reduce->get_output_element_type(0);
+        size_t bytes = shape_size(all_reduce->get_output_shape(0)) * type.size();
+        auto& bucket = open_buckets[make_pair(type, all_reduce->get_reduce_type())];
+        if (!bucket.first.empty() && bucket.second + bytes > m_bucket_bytes)
+        {
+            flush(bucket.first);
+            bucket.second = 0;
+        }
+        bucket.first.push_back(all_reduce);
+        bucket.second += bytes;
+    }
+    for (auto& bucket : open_buckets)
+    {
+        flush(bucket.second.first);
+    }
+    return modified;
+}
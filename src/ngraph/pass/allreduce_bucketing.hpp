@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Fuse small AllReduces into buckets of up to bucket_bytes.
+        ///
+        /// AllReduces with the same element type and reduction whose arguments do not depend on
+        /// any AllReduce (such as the gradients of a data-parallel training step) are grouped
+        /// in topological order. Each group of two or more is replaced by one AllReduce of the
+        /// concatenated, flattened arguments, followed by a Slice and Reshape per original
+        /// output. This trades a few copies for far fewer collectives, which dominate when
+        /// tensors are small.
+        class NGRAPH_API AllReduceBucketing : public FunctionPass
+        {
+        public:
+            static constexpr size_t default_bucket_bytes = 25 * 1024 * 1024;
+
+            AllReduceBucketing(size_t bucket_bytes = default_bucket_bytes)
+                : FunctionPass()
+                , m_bucket_bytes(bucket_bytes)
+            {
+                set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+            }
+            bool run_on_function(std::shared_ptr<Function> function) override;
+
+        private:
+            size_t m_bucket_bytes;
+        };
+    }
+}
@@ -17,6 +17,7 @@
 #include <sstream>
 
 #include "common_function_collection.hpp"
+#include "ngraph/structural_hash.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -42,6 +43,13 @@ bool pass::CommonFunctionCollection::run_on_module(vector<shared_ptr<Function>>&
     unordered_map<string, Node*> match_function_map;
     stringstream ss;
     const string function_name = "__f__";
+
+    // Two ops can only emit the same code if they are the same op with the same attributes
+    // applied to inputs of the same types and shapes. Bucket the candidates by that structural
+    // key first so that only ops with a potential match are emitted and compared as text.
+    StructuralHash structural_hash;
+    vector<pair<shared_ptr<Node>, size_t>> candidates;
+    unordered_map<size_t, size_t> key_counts;
     for (const shared_ptr<Function>& current_function : functions)
     {
         for (const shared_ptr<Node>& n : current_function->get_ordered_ops())
@@ -62,43 +70,62 @@ bool pass::CommonFunctionCollection::run_on_module(vector<shared_ptr<Function>>&
                 }
             }
 
-            Node& node = *n;
-
-            // First emit the op as a function, something like this:
-            // static void __f__(float* _arg0, float *_out1)
-            // {
-            //     op specific code here
-            // }
-            //
-            // Then do a simple string compare in match_function_map to see if there is
-            // another op that emits the exact same code.
-            // If a match is found then the current node is mapped to call the original node's
-            // function and the original node is *also* mapped to call the original node's function.
-            // We also emit the static function declaration to m_emitted_functions when the match
-            // is found the first time.
-            string match_function = m_emit_op_as_function(node, function_name);
-            auto it = match_function_map.find(match_function);
-            if (it != match_function_map.end())
+            size_t key = structural_hash.get_attribute_hash(n);
+            for (auto& input : n->inputs())
             {
-                m_node_function_map.insert({&node, it->second});
-                if (m_node_function_map.find(it->second) == m_node_function_map.end())
-                {
-                    m_node_function_map.insert({it->second, it->second});
-
-                    // All of the functions are created with the same name `__f__` so here
-                    // we rename it to something unique so we can compile everything when done.
-                    auto offset = match_function.find(function_name);
-                    string emitted_function = match_function;
-                    string match_function_name = create_function_name(*it->second);
-                    emitted_function.replace(offset, function_name.size(), match_function_name);
-                    ss << emitted_function << "\n";
-                }
+                const string& type = input.get_element_type().c_type_string();
+                key = stable_hash(type.data(), type.size(), key);
+                const Shape& shape = input.get_shape();
+                key = stable_hash(shape.data(), shape.size() * sizeof(size_t), key);
             }
-            else
+            candidates.push_back(make_pair(n, key));
+            key_counts[key]++;
+        }
+    }
+
+    for (auto& candidate : candidates)
+    {
+        if (key_counts.at(candidate.second) < 2)
+        {
+            continue;
+        }
+
+        Node& node = *candidate.first;
+
+        // First emit the op as a function, something like this:
+        // static void __f__(float* _arg0, float *_out1)
+        // {
+        //     op specific code here
+        // }
+        //
+        // Then do a simple string compare in match_function_map to see if there is
+        // another op that emits the exact same code.
+        // If a match is found then the current node is mapped to call the original node's
+        // function and the original node is *also* mapped to call the original node's function.
+        // We also emit the static function declaration to m_emitted_functions when the match
+        // is found the first time.
+        string match_function = m_emit_op_as_function(node, function_name);
+        auto it = match_function_map.find(match_function);
+        if (it != match_function_map.end())
+        {
+            m_node_function_map.insert({&node, it->second});
+            if (m_node_function_map.find(it->second) == m_node_function_map.end())
             {
-                match_function_map.insert({match_function, &node});
+                m_node_function_map.insert({it->second, it->second});
+
+                // All of the functions are created with the same name `__f__` so here
+                // we rename it to something unique so we can compile everything when done.
+                auto offset = match_function.find(function_name);
+                string emitted_function = match_function;
+                string match_function_name = create_function_name(*it->second);
+                emitted_function.replace(offset, function_name.size(), match_function_name);
+                ss << emitted_function << "\n";
             }
         }
+        else
+        {
+            match_function_map.insert({match_function, &node});
+        }
     }
     m_emitted_functions = ss.str();
     return false;
@@ -130,6 +130,8 @@ static Output<Node> fold_constant_arithmetic_reduction(shared_ptr<op::v0::Consta
         NGRAPH_CHECK(false,
                      "Encountered 'dynamic' element type in fold_constant_arithmetic_reduction");
         break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
         NGRAPH_CHECK(false, "Encountered 'u1' element type in fold_constant_arithmetic_reduction");
         break;
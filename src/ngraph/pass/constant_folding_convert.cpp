@@ -58,6 +58,8 @@ Output<Node> fold_constant_convert_helper0(shared_ptr<op::v0::Constant> constant
     case element::Type_t::dynamic:
         NGRAPH_CHECK(false, "Encountered 'dynamic' element type in fold_constant_convert");
         break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
         NGRAPH_CHECK(false, "Encountered 'dynamic' element type in fold_constant_convert");
         break;
@@ -118,6 +120,8 @@ static Output<Node> fold_constant_convert(shared_ptr<op::v0::Constant> constant,
     case element::Type_t::dynamic:
         NGRAPH_CHECK(false, "Encountered 'dynamic' element type in fold_constant_convert");
         break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
         NGRAPH_CHECK(false, "Encountered 'u1' element type in fold_constant_convert");
         break;
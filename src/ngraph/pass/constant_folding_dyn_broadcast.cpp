@@ -86,6 +86,8 @@ void pass::ConstantFolding::construct_constant_dyn_broadcast()
             NGRAPH_CHECK(false,
                          "Encountered 'dynamic' element type in constant_dyn_broadcast_callback");
             break;
+        case element::Type_t::i4:
+        case element::Type_t::u4:
         case element::Type_t::u1:
             NGRAPH_CHECK(false, "Encountered 'u1' element type in constant_dyn_broadcast_callback");
             break;
@@ -48,6 +48,8 @@ std::shared_ptr<Node> do_fold(R dyn_reshape_match, shared_ptr<op::v0::Constant>
     case element::Type_t::dynamic:
         NGRAPH_CHECK(false, "Encountered 'dynamic' element type in constant_dyn_reshape_callback");
         break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
         NGRAPH_CHECK(false, "Encountered 'u1' element type in constant_dyn_reshape_callback");
         break;
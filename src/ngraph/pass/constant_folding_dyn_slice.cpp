@@ -120,6 +120,8 @@ void pass::ConstantFolding::construct_constant_dyn_slice()
         case element::Type_t::dynamic:
             NGRAPH_CHECK(false, "Encountered 'dynamic' element type in fold_constant_dyn_slice");
             break;
+        case element::Type_t::i4:
+        case element::Type_t::u4:
         case element::Type_t::u1:
             NGRAPH_CHECK(false, "Encountered 'u1' element type in fold_constant_dyn_slice");
             break;
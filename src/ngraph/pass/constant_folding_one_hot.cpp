@@ -56,6 +56,8 @@ shared_ptr<op::v0::Constant> fold_constant_one_hot(const shared_ptr<op::v0::Cons
     {
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::boolean:
     case element::Type_t::bf16:
@@ -142,6 +144,8 @@ void pass::ConstantFolding::construct_constant_one_hot()
         case element::Type_t::dynamic:
             NGRAPH_CHECK(false, "Encountered 'dynamic' element type in one_hot_callback");
             break;
+        case element::Type_t::i4:
+        case element::Type_t::u4:
         case element::Type_t::u1:
             NGRAPH_CHECK(false, "Encountered 'u1' element type in one_hot_callback");
             break;
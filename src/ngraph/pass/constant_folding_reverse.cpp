@@ -54,6 +54,8 @@ static Output<Node> fold_constant_reverse(shared_ptr<op::v0::Constant> constant,
     case element::Type_t::dynamic:
         NGRAPH_CHECK(false, "Encountered 'dynamic' element type in fold_constant_convert");
         break;
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
         NGRAPH_CHECK(false, "Encountered 'u1' element type in fold_constant_convert");
         break;
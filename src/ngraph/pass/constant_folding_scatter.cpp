@@ -100,6 +100,8 @@ static shared_ptr<op::v0::Constant>
     case element::Type_t::f16:
     case element::Type_t::f32:
     case element::Type_t::f64:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     default:
         NGRAPH_CHECK(false,
@@ -152,6 +154,8 @@ static shared_ptr<op::v0::Constant>
     case element::Type_t::f16:
     case element::Type_t::f32:
     case element::Type_t::f64:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     default:
         NGRAPH_CHECK(false,
@@ -216,6 +220,8 @@ void pass::ConstantFolding::construct_constant_scatter_elements_update()
             NGRAPH_CHECK(
                 false, "Encountered 'boolean' element type in constant_scatter_elem_updt_callback");
             break;
+        case element::Type_t::i4:
+        case element::Type_t::u4:
         case element::Type_t::u1:
             NGRAPH_CHECK(false,
                          "Encountered 'u1' element type in constant_scatter_elem_updt_callback");
@@ -26,10 +26,12 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/asin.hpp"
 #include "ngraph/op/atan.hpp"
 #include "ngraph/op/atan2.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
 #include "ngraph/op/ceiling.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/cos.hpp"
@@ -58,6 +60,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/structural_hash.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -165,7 +168,8 @@ static bool cse_one_hot(shared_ptr<Node> a, shared_ptr<Node> b)
            (a->get_output_shape(0) == b->get_output_shape(0));
 }
 
-// To enable CSE for a new op, add a mapping between the op and a cse handler function to the map
+// Ops that implement visit_attributes are compared generically through StructuralHash. To enable
+// CSE for an op that does not, add a mapping between the op and a cse handler function to the map
 // below. If the op doesn't map to an existing handler, create a new handler to check if
 // all inputs and attributes for two nodes are exactly same.
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
@@ -216,27 +220,36 @@ class NodeKey
 public:
     NodeKey(const shared_ptr<Node>& n,
             unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-                backend_handlers)
+                backend_handlers,
+            StructuralHash& structural_hash)
         : m_node(n)
         , m_node_ref(*n)
         , m_ti(TI(m_node_ref))
         , m_backend_handlers(backend_handlers)
+        , m_structural_hash(structural_hash)
+        , m_hash(compute_hash())
     {
     }
 
     shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
     bool operator==(const NodeKey& other) const
     {
         if (m_ti == other.m_ti)
         {
-            auto eh = ops_to_cse_handlers.find(m_ti);
-            if (eh != ops_to_cse_handlers.end())
+            auto eh = m_backend_handlers.find(m_ti);
+            if (eh != m_backend_handlers.end())
             {
                 return eh->second(m_node, other.m_node);
             }
 
-            eh = m_backend_handlers.find(m_ti);
-            if (eh != m_backend_handlers.end())
+            if (m_structural_hash.is_hashable(m_node))
+            {
+                return structurally_equal(other);
+            }
+
+            eh = ops_to_cse_handlers.find(m_ti);
+            if (eh != ops_to_cse_handlers.end())
             {
                 return eh->second(m_node, other.m_node);
             }
@@ -246,12 +259,82 @@ public:
     }
 
 private:
+    // The attribute hash covers the op type, attributes and output types. Inputs are identified
+    // by their producing node so that the hash agrees with the input comparisons below.
+    size_t compute_hash() const
+    {
+        vector<size_t> arg_ids;
+        arg_ids.push_back(m_structural_hash.get_attribute_hash(m_node));
+
+        OutputVector cargs;
+        for (auto input : m_node->inputs())
+        {
+            cargs.push_back(input.get_source_output());
+        }
+
+        if (m_node->is_commutative())
+        {
+            sort(begin(cargs), end(cargs));
+        }
+
+        for (auto arg : cargs)
+        {
+            arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
+            arg_ids.push_back(arg.get_index());
+        }
+
+        return ngraph::hash_combine(arg_ids);
+    }
+
+    bool structurally_equal(const NodeKey& other) const
+    {
+        if (!m_structural_hash.attributes_equal(m_node, other.m_node))
+        {
+            return false;
+        }
+
+        OutputVector args;
+        OutputVector other_args;
+        for (auto input : m_node->inputs())
+        {
+            args.push_back(input.get_source_output());
+        }
+        for (auto input : other.m_node->inputs())
+        {
+            other_args.push_back(input.get_source_output());
+        }
+        if (m_node->is_commutative())
+        {
+            sort(begin(args), end(args));
+            sort(begin(other_args), end(other_args));
+        }
+        if (args != other_args)
+        {
+            return false;
+        }
+
+        // Backends may already have assigned layouts to the outputs
+        for (size_t i = 0; i < m_node->get_output_size(); i++)
+        {
+            auto layout = m_node->get_output_tensor(i).get_tensor_layout();
+            auto other_layout = other.m_node->get_output_tensor(i).get_tensor_layout();
+            if ((layout == nullptr) != (other_layout == nullptr) ||
+                (layout != nullptr && *layout != *other_layout))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     shared_ptr<Node> m_node;
     // m_node_ref is only to allow getting the type_index in the ctor
     Node& m_node_ref;
     std::type_index m_ti;
     unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
         m_backend_handlers;
+    StructuralHash& m_structural_hash;
+    size_t m_hash;
 };
 
 namespace std
@@ -259,56 +342,34 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            OutputVector cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
-                arg_ids.push_back(arg.get_index());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
+// Ops whose results must not be shared even if they look identical. NodeKey ignores control
+// dependencies, so an op ordered after others on purpose, such as a forward op recomputed by
+// autodiff::rematerialize, would otherwise be merged into its unordered twin.
+static bool is_cse_candidate(const shared_ptr<Node>& n)
+{
+    return !(n->is_output() || n->is_parameter() || n->has_state() ||
+             !n->get_control_dependencies().empty() || is_type<op::v0::AllReduce>(n) ||
+             is_type<op::v0::BroadcastDistributed>(n));
+}
+
 bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ngraph::Function> f)
 {
     bool replaced = false;
+    StructuralHash structural_hash;
     unordered_map<NodeKey, shared_ptr<Node>> expressions{};
 
     for (auto n : f->get_ordered_ops())
     {
-        if (n->is_output() || n->is_parameter())
+        if (!is_cse_candidate(n))
         {
             continue;
         }
 
-        NodeKey n_key(n, m_backend_cse_handlers);
+        NodeKey n_key(n, m_backend_cse_handlers, structural_hash);
         if (expressions.count(n_key))
         {
             ngraph::replace_node(n, expressions.at(n_key));
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "graph_rewrite.hpp"
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 
@@ -173,6 +174,7 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                     if (m->match(node))
                     {
                         NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
+                        event::Duration matcher_span(m->get_name(), "Matcher");
                         return callback(*m.get());
                     }
                     return false;
@@ -197,6 +199,7 @@ void pass::RecurrentGraphRewrite::add_matcher(
                 [m, callback](const std::shared_ptr<Node>& node) {
                     if (m->match(node))
                     {
+                        event::Duration matcher_span("Recurrent matcher", "Matcher");
                         return callback(*m.get());
                     }
                     return false;
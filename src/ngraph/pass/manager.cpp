@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstdlib>
 #ifdef _WIN32
 #else
 #include <cxxabi.h>
@@ -23,6 +24,7 @@
 #include <iostream>
 #include <memory>
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -57,8 +59,25 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    event::Duration passes_span("run_passes", "Pass");
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        string pass_name;
+        if (profile_enabled || event::Manager::is_tracing_enabled())
+        {
+            PassBase* p = pass.get();
+            pass_name = typeid(*p).name();
+#ifndef _WIN32
+            int status;
+            char* demangled = abi::__cxa_demangle(pass_name.c_str(), nullptr, nullptr, &status);
+            if (demangled)
+            {
+                pass_name = demangled;
+                free(demangled);
+            }
+#endif
+        }
+        event::Duration pass_span(pass_name, "Pass");
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -154,13 +173,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         pass_timer.stop();
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass_name << "\n";
         }
     }
     if (profile_enabled)
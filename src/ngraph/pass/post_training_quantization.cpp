@@ -0,0 +1,248 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_quantizable_convolution(const shared_ptr<Node>& node)
+{
+    if (auto conv = as_type_ptr<op::v0::Convolution>(node))
+    {
+        for (auto s : conv->get_data_dilation_strides())
+        {
+            if (s != 1)
+            {
+                return false;
+            }
+        }
+    }
+    else if (!is_type<op::v1::Convolution>(node))
+    {
+        return false;
+    }
+    return node->get_output_element_type(0) == element::f32 && !node->is_dynamic() &&
+           is_type<op::v0::Constant>(node->input_value(1).get_node());
+}
+
+static float get_quantization_scale(const pass::PostTrainingQuantization::Range& range,
+                                    const element::Type& type)
+{
+    float limit = type == element::u8 ? 255.0f : 127.0f;
+    float bound = max(fabs(range.min), fabs(range.max));
+    return bound > 0 ? bound / limit : 1.0f;
+}
+
+static Output<Node> make_fake_quantize(const Output<Node>& value,
+                                       const pass::PostTrainingQuantization::Range& range,
+                                       const element::Type& type)
+{
+    auto scale =
+        op::v0::Constant::create(element::f32, Shape{}, {get_quantization_scale(range, type)});
+    auto zero_point = op::v0::Constant::create(type, Shape{}, {0});
+    auto quantize = make_shared<op::v0::Quantize>(
+        value,
+        scale,
+        zero_point,
+        type,
+        AxisSet{},
+        op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+    return make_shared<op::v0::Dequantize>(quantize, scale, zero_point, element::f32, AxisSet{});
+}
+
+// Symmetric i8 quantization with one scale per output channel (filter axis 0)
+static Output<Node> make_quantized_filters(const shared_ptr<op::v0::Constant>& filters)
+{
+    auto shape = filters->get_output_shape(0);
+    size_t channels = shape[0];
+    size_t channel_size = shape_size(shape) / channels;
+    auto values = filters->get_vector<float>();
+
+    vector<float> scales(channels);
+    vector<int8_t> quantized(values.size());
+    for (size_t c = 0; c < channels; c++)
+    {
+        auto begin = values.begin() + c * channel_size;
+        float bound = 0;
+        for (auto it = begin; it != begin + channel_size; ++it)
+        {
+            bound = max(bound, fabs(*it));
+        }
+        scales[c] = bound > 0 ? bound / 127.0f : 1.0f;
+        for (size_t i = c * channel_size; i < (c + 1) * channel_size; i++)
+        {
+            auto q = nearbyint(values[i] / scales[c]);
+            quantized[i] = static_cast<int8_t>(min(127.0f, max(-127.0f, q)));
+        }
+    }
+
+    auto filters_q = op::v0::Constant::create(element::i8, shape, quantized);
+    auto scale = op::v0::Constant::create(element::f32, Shape{channels}, scales);
+    auto zero_point =
+        op::v0::Constant::create(element::i8, Shape{channels}, vector<int8_t>(channels, 0));
+    return make_shared<op::v0::Dequantize>(
+        filters_q, scale, zero_point, element::f32, AxisSet{0});
+}
+
+string pass::PostTrainingQuantization::get_calibration_key(const Output<Node>& output)
+{
+    return output.get_node()->get_friendly_name() + ":" + to_string(output.get_index());
+}
+
+bool pass::PostTrainingQuantization::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    // Convolutions sharing an input share its Quantize/Dequantize pair
+    map<pair<Node*, size_t>, Output<Node>> quantized_data;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (!is_quantizable_convolution(node) || m_fp32_nodes.count(node->get_friendly_name()))
+        {
+            continue;
+        }
+
+        auto data = node->input_value(0);
+        auto filters = as_type_ptr<op::v0::Constant>(node->get_argument(1));
+        shared_ptr<Node> replacement;
+        if (m_precision == Precision::BF16)
+        {
+            auto values = filters->get_vector<float>();
+            auto filters_bf16 =
+                make_shared<op::v0::Constant>(element::bf16,
+                                              filters->get_output_shape(0),
+                                              vector<bfloat16>(values.begin(), values.end()));
+            auto conv = node->copy_with_new_inputs(
+                OutputVector{make_shared<op::v0::Convert>(data, element::bf16), filters_bf16});
+            replacement = make_shared<op::v0::Convert>(conv, element::f32);
+        }
+        else
+        {
+            // Converted outputs carry the friendly name of the convolution they replaced, so
+            // a consumer's data input still finds the range recorded for the original
+            auto data_range = m_table.find(get_calibration_key(data));
+            auto output_range = m_table.find(get_calibration_key(node->output(0)));
+            if (data_range == m_table.end() || output_range == m_table.end())
+            {
+                NGRAPH_DEBUG << "No calibration data for " << node->get_friendly_name();
+                continue;
+            }
+
+            auto data_key = make_pair(data.get_node(), data.get_index());
+            if (quantized_data.count(data_key) == 0)
+            {
+                auto data_type = data_range->second.min >= 0 ? element::u8 : element::i8;
+                quantized_data[data_key] = make_fake_quantize(data, data_range->second, data_type);
+            }
+            auto conv = node->copy_with_new_inputs(
+                OutputVector{quantized_data[data_key], make_quantized_filters(filters)});
+            replacement =
+                make_fake_quantize(conv, output_range->second, element::i8).get_node_shared_ptr();
+        }
+        replace_node(node, replacement);
+        modified = true;
+    }
+    return modified;
+}
+
+pass::PostTrainingQuantization::CalibrationTable pass::PostTrainingQuantization::calibrate(
+    const shared_ptr<Function>& f,
+    runtime::Backend& backend,
+    const vector<vector<shared_ptr<runtime::Tensor>>>& samples)
+{
+    // The values run_on_function looks up: each convolution's data input and output
+    vector<Output<Node>> observed;
+    set<pair<Node*, size_t>> seen;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (!is_quantizable_convolution(node))
+        {
+            continue;
+        }
+        for (auto output : {node->input_value(0), node->output(0)})
+        {
+            if (seen.insert(make_pair(output.get_node(), output.get_index())).second)
+            {
+                observed.push_back(output);
+            }
+        }
+    }
+
+    CalibrationTable table;
+    if (observed.empty())
+    {
+        return table;
+    }
+
+    NodeMap node_map;
+    auto clone = clone_function(*f, node_map);
+    ResultVector results = clone->get_results();
+    size_t first_observed = results.size();
+    for (auto& output : observed)
+    {
+        results.push_back(make_shared<op::v0::Result>(
+            node_map.at(output.get_node())->output(output.get_index())));
+    }
+    auto exec = backend.compile(make_shared<Function>(results, clone->get_parameters()));
+
+    for (auto& inputs : samples)
+    {
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        for (auto& result : results)
+        {
+            outputs.push_back(backend.create_tensor(result->get_output_element_type(0),
+                                                    result->get_output_shape(0)));
+        }
+        exec->call_with_validate(outputs, inputs);
+
+        for (size_t i = 0; i < observed.size(); i++)
+        {
+            auto& tensor = outputs[first_observed + i];
+            vector<float> values(shape_size(tensor->get_shape()));
+            if (values.empty())
+            {
+                continue;
+            }
+            tensor->read(values.data(), values.size() * sizeof(float));
+            auto bounds = minmax_element(values.begin(), values.end());
+            auto key = get_calibration_key(observed[i]);
+            auto it = table.find(key);
+            if (it == table.end())
+            {
+                table[key] = Range{*bounds.first, *bounds.second};
+            }
+            else
+            {
+                it->second.min = min(it->second.min, *bounds.first);
+                it->second.max = max(it->second.max, *bounds.second);
+            }
+        }
+    }
+    return table;
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Tensor;
+    }
+
+    namespace pass
+    {
+        class NGRAPH_API PostTrainingQuantization : public FunctionPass
+        {
+        public:
+            enum class Precision
+            {
+                // u8/i8 activations, per-output-channel i8 weights; needs a calibration table
+                INT8,
+                // bf16 activations and weights; no calibration needed
+                BF16
+            };
+
+            struct Range
+            {
+                float min;
+                float max;
+            };
+
+            /// \brief Observed value ranges keyed by get_calibration_key() of an output
+            using CalibrationTable = std::map<std::string, Range>;
+
+            /// \brief Rewrites f32 convolutions with constant filters to run in `precision`.
+            ///
+            /// For INT8, Quantize/Dequantize pairs are inserted around each convolution whose
+            /// data input and output ranges are present in `table`; filters are quantized per
+            /// output channel in place. For BF16, Converts are inserted around the
+            /// convolution. Every other op, and any convolution whose friendly name is in
+            /// `fp32_nodes`, is left in f32. Backends are expected to fold the resulting
+            /// pattern into low precision kernels; elsewhere it runs as simulated quantization.
+            PostTrainingQuantization(Precision precision,
+                                     const CalibrationTable& table = CalibrationTable{},
+                                     const std::set<std::string>& fp32_nodes = {})
+                : FunctionPass()
+                , m_precision(precision)
+                , m_table(table)
+                , m_fp32_nodes(fp32_nodes)
+            {
+            }
+
+            bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+            /// \brief Runs a clone of `f` on `backend` for each set of sample inputs and records
+            ///        the ranges of every value the INT8 rewrite of `f` will quantize.
+            static CalibrationTable calibrate(
+                const std::shared_ptr<Function>& f,
+                runtime::Backend& backend,
+                const std::vector<std::vector<std::shared_ptr<runtime::Tensor>>>& samples);
+
+            /// \return "<friendly name>:<output index>"
+            static std::string get_calibration_key(const Output<Node>& output);
+
+        private:
+            Precision m_precision;
+            CalibrationTable m_table;
+            std::set<std::string> m_fp32_nodes;
+        };
+    }
+}
@@ -98,6 +98,16 @@ runtime::AlignedBuffer& runtime::AlignedBuffer::operator=(AlignedBuffer&& other)
     return *this;
 }
 
+runtime::SharedBuffer::SharedBuffer(char* data,
+                                    size_t byte_size,
+                                    const shared_ptr<void>& owner)
+    : m_owner(owner)
+{
+    // m_allocated_buffer stays null so ~AlignedBuffer does not free memory owned by m_owner
+    m_aligned_buffer = data;
+    m_byte_size = byte_size;
+}
+
 namespace ngraph
 {
     constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>::type_info;
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 
 #include "ngraph/runtime/allocator.hpp"
 
@@ -25,6 +26,7 @@ namespace ngraph
     namespace runtime
     {
         class AlignedBuffer;
+        class SharedBuffer;
     }
 }
 
@@ -40,7 +42,7 @@ public:
     AlignedBuffer(size_t byte_size, size_t alignment = 64, Allocator* allocator = nullptr);
 
     AlignedBuffer();
-    ~AlignedBuffer();
+    virtual ~AlignedBuffer();
 
     AlignedBuffer(AlignedBuffer&& other);
     AlignedBuffer& operator=(AlignedBuffer&& other);
@@ -70,12 +72,24 @@ private:
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
+protected:
     Allocator* m_allocator;
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
 };
 
+/// \brief An AlignedBuffer over memory that belongs to some other object, such as a memory-mapped
+/// file. The buffer never frees the memory; it keeps the owner alive until it is destroyed.
+class NGRAPH_API ngraph::runtime::SharedBuffer : public ngraph::runtime::AlignedBuffer
+{
+public:
+    SharedBuffer(char* data, size_t byte_size, const std::shared_ptr<void>& owner);
+
+private:
+    std::shared_ptr<void> m_owner;
+};
+
 namespace ngraph
 {
     template <>
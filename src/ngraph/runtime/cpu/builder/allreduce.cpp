@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
@@ -40,6 +42,8 @@ namespace ngraph
                 const ngraph::op::v0::AllReduce* allreduce =
                     static_cast<const ngraph::op::v0::AllReduce*>(node);
                 auto reduce_type = allreduce->get_reduce_type();
+                auto bytes = out[0].get_size() * data_type.size();
+                auto request_slot = external_function->add_distributed_request(node);
 
                 auto external_function_name = external_function->get_function_name();
                 NGRAPH_DEBUG << "AllReduce Queued[" << call_seq
@@ -50,15 +54,21 @@ namespace ngraph
                                      : node->get_friendly_name())
                              << " Size: " << count;
 
-                auto functor =
-                    [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        get_distributed_interface()->all_reduce(ctx->buffer_data[arg_buffer_index],
-                                                                ctx->buffer_data[out_buffer_index],
-                                                                data_type,
-                                                                reduce_type,
-                                                                count);
-                    };
+                // The collective runs in the background while independent ops execute; the
+                // consumers of the output wait on request_slot. It reduces in place in the output
+                // buffer, since the input buffer may be reused as soon as this functor returns.
+                auto functor = [count, reduce_type, data_type, bytes, request_slot,
+                                arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    void* out_data = ctx->buffer_data[out_buffer_index];
+                    if (ctx->buffer_data[arg_buffer_index] != out_data)
+                    {
+                        memcpy(out_data, ctx->buffer_data[arg_buffer_index], bytes);
+                    }
+                    ctx->distributed_requests[request_slot] =
+                        get_distributed_interface()->all_reduce_async(
+                            out_data, out_data, data_type, reduce_type, count);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_autotuner.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Times cblas sgemm against the Eigen contraction for C(m x n) = op(A) * op(B) and
+            // returns true if Eigen is faster. Only consulted when autotuning is enabled.
+            inline bool autotune_prefers_eigen_sgemm(
+                size_t m, size_t n, size_t k, bool transpose_a, bool transpose_b)
+            {
+                std::vector<float> a(m * k, 1.0f);
+                std::vector<float> b(k * n, 1.0f);
+                std::vector<float> c(m * n);
+
+                auto sgemm = [&]() {
+                    cblas::cblas_sgemm(
+                        cblas::Layout::RowMajor,
+                        transpose_a ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                        transpose_b ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                        m,
+                        n,
+                        k,
+                        1.0f,
+                        a.data(),
+                        std::max<size_t>(1, transpose_a ? m : k),
+                        b.data(),
+                        std::max<size_t>(1, transpose_b ? k : n),
+                        0.0f,
+                        c.data(),
+                        std::max<size_t>(1, n));
+                };
+                auto eigen = [&]() {
+                    kernel::matmul<float>(
+                        a.data(), b.data(), c.data(), m, n, k, transpose_a, transpose_b, 0);
+                };
+
+                std::stringstream signature;
+                signature << "Gemm_f32_" << (transpose_a ? "T" : "N") << (transpose_b ? "T" : "N")
+                          << "_" << m << "x" << n << "x" << k;
+                return CPUAutotuner::get().select(signature.str(), {sgemm, eigen}) == 1;
+            }
+        }
+    }
+}
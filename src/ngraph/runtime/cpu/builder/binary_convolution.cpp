@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/binary_convolution.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::BinaryConvolution)
+            {
+                auto conv = static_cast<const ngraph::op::v1::BinaryConvolution*>(node);
+                auto& functors = external_function->get_functors();
+
+                if (args[0].get_element_type() != element::f32 ||
+                    args[1].get_element_type() != element::u1)
+                {
+                    throw ngraph_error("BinaryConvolution is only supported for f32 data and u1 "
+                                       "filters");
+                }
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto data_shape = args[0].get_shape();
+                auto filters_shape = args[1].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto strides = conv->get_strides();
+                auto dilations = conv->get_dilations();
+                auto pads_begin = conv->get_pads_begin();
+                auto pad_value = conv->get_pad_value();
+
+                auto functor = [&,
+                                data_shape,
+                                filters_shape,
+                                out_shape,
+                                strides,
+                                dilations,
+                                pads_begin,
+                                pad_value,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    runtime::reference::binary_convolution<float>(
+                        static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<uint8_t*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        data_shape,
+                        filters_shape,
+                        out_shape,
+                        strides,
+                        dilations,
+                        pads_begin,
+                        pad_value);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_binary_convolution_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v1::BinaryConvolution);
+            }
+        }
+    }
+}
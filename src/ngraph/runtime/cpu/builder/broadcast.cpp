@@ -19,6 +19,7 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/broadcast.hpp"
+#include "ngraph/runtime/cpu/kernel/rank_generic.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -155,10 +156,16 @@ namespace ngraph
                     }
                 }
 
-                SELECT_KERNEL_ET_RANK(kernel,
-                                      broadcast->get_input_element_type(0),
-                                      out_rank,
-                                      runtime::cpu::kernel::broadcast)
+                auto& element_type = broadcast->get_input_element_type(0);
+                if (is_optimized_et_and_rank(element_type, out_rank))
+                {
+                    SELECT_ETS_AND_RANK7(
+                        kernel, element_type, out_rank, runtime::cpu::kernel::broadcast);
+                }
+                else
+                {
+                    SELECT_KERNEL_BY_SIZE(kernel, element_type, runtime::cpu::kernel::tile_generic)
+                }
             }
 
             template <>
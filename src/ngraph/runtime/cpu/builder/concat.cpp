@@ -19,6 +19,7 @@
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/kernel/concat.hpp"
+#include "ngraph/runtime/cpu/kernel/rank_generic.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -152,10 +153,17 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::concat<float, 1>)> kernel;
 
-                    SELECT_KERNEL_ET_RANK(kernel,
-                                          out[0].get_element_type(),
-                                          out[0].get_shape().size(),
-                                          runtime::cpu::kernel::concat)
+                    auto& element_type = out[0].get_element_type();
+                    if (is_optimized_et_and_rank(element_type, out_shape.size()))
+                    {
+                        SELECT_ETS_AND_RANK7(
+                            kernel, element_type, out_shape.size(), runtime::cpu::kernel::concat);
+                    }
+                    else
+                    {
+                        SELECT_KERNEL_BY_SIZE(
+                            kernel, element_type, runtime::cpu::kernel::concat_generic)
+                    }
 
                     auto functor = [&,
                                     kernel,
@@ -50,6 +50,11 @@ namespace ngraph
                 {
                     kernel = runtime::cpu::kernel::convert_to_float32<bfloat16>;
                 }
+                else if (args[0].get_element_type() == element::f16 &&
+                         out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::convert_to_float32<float16>;
+                }
                 else if (out[0].get_element_type() == element::f32)
                 {
                     SELECT_KERNEL(kernel,
@@ -107,6 +112,11 @@ namespace ngraph
                 {
                     kernel = runtime::cpu::kernel::convert_to_bf16<float>;
                 }
+                else if (args[0].get_element_type() == element::f32 &&
+                         out[0].get_element_type() == element::f16)
+                {
+                    kernel = runtime::cpu::kernel::convert_to_f16<float>;
+                }
                 else
                 {
                     NGRAPH_CHECK(false,
@@ -18,6 +18,7 @@
 #include <cstring>
 
 #include "ngraph/op/dot.hpp"
+#include "ngraph/runtime/cpu/builder/autotune_gemm.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
@@ -191,6 +192,37 @@ namespace ngraph
                     return;
                 }
 
+                if (out[0].get_element_type() == element::f32 && (arg0_shape.size() == 2) &&
+                    (arg1_shape.size() == 2) && reduction_axes_count == 1 &&
+                    CPUAutotuner::is_enabled() &&
+                    autotune_prefers_eigen_sgemm(
+                        arg0_shape[0], arg1_shape[1], arg0_shape[1], false, false))
+                {
+                    auto m = arg0_shape[0];
+                    auto n = arg1_shape[1];
+                    auto k = arg0_shape[1];
+                    auto functor = [&,
+                                    m,
+                                    n,
+                                    k,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::matmul<float>(ctx->buffer_data[arg0_buffer_index],
+                                                            ctx->buffer_data[arg1_buffer_index],
+                                                            ctx->buffer_data[out_buffer_index],
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            false,
+                                                            false,
+                                                            ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 if (out[0].get_element_type() == element::f32 && (arg0_shape.size() == 2) &&
                     (arg1_shape.size() == 2) && reduction_axes_count == 1)
                 {
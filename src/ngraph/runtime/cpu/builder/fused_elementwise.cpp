@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto& functors = external_function->get_functors();
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for FusedElementwise");
+                }
+
+                vector<size_t> arg_buffer_indices;
+                vector<size_t> input_sizes;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                    input_sizes.push_back(arg.get_size());
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto instructions = fused->get_instructions();
+                auto expression_size = shape_size(fused->get_expression_shape());
+                auto reduction_size = expression_size / std::max<size_t>(out[0].get_size(), 1);
+
+                auto functor = [&,
+                                arg_buffer_indices,
+                                input_sizes,
+                                instructions,
+                                expression_size,
+                                reduction_size,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    vector<void*> inputs(arg_buffer_indices.size());
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
+                    {
+                        inputs[i] = ctx->buffer_data[arg_buffer_indices[i]];
+                    }
+                    runtime::cpu::kernel::fused_elementwise<float>(
+                        inputs,
+                        input_sizes,
+                        ctx->buffer_data[out_buffer_index],
+                        instructions,
+                        expression_size,
+                        reduction_size,
+                        ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_fused_elementwise_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::FusedElementwise);
+            }
+        }
+    }
+}
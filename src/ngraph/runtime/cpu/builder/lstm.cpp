@@ -119,7 +119,10 @@ namespace ngraph
                         ctx, deps[7], ctx->buffer_data[dst_iter_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[8], ctx->buffer_data[dst_iter_c_buffer_index]);
-                    cpu::dnnl_utils::set_memory_ptr(ctx, deps[9], ctx->dnnl_workspaces[deps[10]]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx,
+                        deps[9],
+                        cpu::dnnl_utils::get_workspace_ptr(ctx, lstm_index, deps[10]));
 
                     cpu::dnnl_utils::dnnl_invoke_primitive(
                         ctx, lstm_index, deps, cpu::dnnl_utils::OpType::LSTM, scratchpad_size);
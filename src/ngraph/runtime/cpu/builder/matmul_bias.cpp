@@ -18,6 +18,7 @@
 
 #include "ngraph/op/batch_mat_mul_transpose.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/runtime/cpu/builder/autotune_gemm.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 
@@ -72,21 +73,21 @@ namespace ngraph
 
                 const float beta = 0.0f;
 
-                auto mm_functor = [&,
-                                   transpose_A,
-                                   transpose_B,
-                                   m,
-                                   n,
-                                   k,
-                                   lda,
-                                   ldb,
-                                   beta,
-                                   arg2_shape,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out0_buffer_index,
-                                   element_type](CPURuntimeContext* ctx,
-                                                 CPUExecutionContext* /* ectx */) {
+                CPUKernelFunctor mm_functor = [&,
+                                               transpose_A,
+                                               transpose_B,
+                                               m,
+                                               n,
+                                               k,
+                                               lda,
+                                               ldb,
+                                               beta,
+                                               arg2_shape,
+                                               arg0_buffer_index,
+                                               arg1_buffer_index,
+                                               out0_buffer_index,
+                                               element_type](CPURuntimeContext* ctx,
+                                                             CPUExecutionContext* /* ectx */) {
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-enum"
@@ -134,6 +135,31 @@ namespace ngraph
 #endif
                 };
 
+                if (element_type == element::f32 && CPUAutotuner::is_enabled() &&
+                    autotune_prefers_eigen_sgemm(m, n, k, transpose_A, transpose_B))
+                {
+                    mm_functor = [&,
+                                  transpose_A,
+                                  transpose_B,
+                                  m,
+                                  n,
+                                  k,
+                                  arg0_buffer_index,
+                                  arg1_buffer_index,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::matmul<float>(ctx->buffer_data[arg0_buffer_index],
+                                                            ctx->buffer_data[arg1_buffer_index],
+                                                            ctx->buffer_data[out0_buffer_index],
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            transpose_A,
+                                                            transpose_B,
+                                                            ectx->arena);
+                    };
+                }
+
                 CPUKernelFunctor bias_functor = [](CPURuntimeContext* /* ctx */,
                                                    CPUExecutionContext* /* ectx */) {};
 
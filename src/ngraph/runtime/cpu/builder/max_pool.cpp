@@ -169,7 +169,9 @@ namespace ngraph
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, fdeps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
-                            ctx, fdeps[2], ctx->dnnl_workspaces[fdeps[3]]);
+                            ctx,
+                            fdeps[2],
+                            cpu::dnnl_utils::get_workspace_ptr(ctx, fwd_pool_index, fdeps[3]));
                         cpu::dnnl_utils::dnnl_invoke_primitive(
                             ctx,
                             fwd_pool_index,
@@ -190,7 +192,9 @@ namespace ngraph
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, bdeps[0], ctx->buffer_data[delta_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
-                            ctx, bdeps[1], ctx->dnnl_workspaces[bdeps[3]]);
+                            ctx,
+                            bdeps[1],
+                            cpu::dnnl_utils::get_workspace_ptr(ctx, bwd_pool_index, bdeps[3]));
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, bdeps[2], ctx->buffer_data[out_buffer_index]);
                         cpu::dnnl_utils::dnnl_invoke_primitive(
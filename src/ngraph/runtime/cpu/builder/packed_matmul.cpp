@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/packed_matmul.hpp"
+#include "ngraph/runtime/cpu/op/packed_matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::PackedMatmul)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto arg3_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto& weights_shape = args[1].get_shape();
+                size_t channels = weights_shape[0];
+                size_t depth = weights_shape[1];
+                size_t rows = args[0].get_size() / depth;
+                bool per_channel_scale = args[2].get_size() > 1;
+                bool per_channel_zero_point = args[3].get_size() > 1;
+
+                auto kernel = runtime::cpu::kernel::packed_matmul<false>;
+                if (args[1].get_element_type() == element::i4)
+                {
+                    kernel = runtime::cpu::kernel::packed_matmul<true>;
+                }
+
+                auto functor = [&,
+                                kernel,
+                                rows,
+                                depth,
+                                channels,
+                                per_channel_scale,
+                                per_channel_zero_point,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                arg3_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                           static_cast<uint8_t*>(ctx->buffer_data[arg1_buffer_index]),
+                           static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
+                           static_cast<uint8_t*>(ctx->buffer_data[arg3_buffer_index]),
+                           static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                           rows,
+                           depth,
+                           channels,
+                           per_channel_scale,
+                           per_channel_zero_point,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_packed_matmul_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::PackedMatmul);
+            }
+        }
+    }
+}
@@ -50,9 +50,10 @@ namespace ngraph
                 auto padding_above = pad->get_padding_above();
                 auto pad_mode = pad->get_pad_mode();
 
+                CPUKernelFunctor functor;
                 if ((pad_mode == ngraph::op::PadMode::CONSTANT ||
                      pad_mode == ngraph::op::PadMode::REFLECT) &&
-                    is_optimized_et(args[0].get_element_type()))
+                    is_optimized_et_and_rank(args[0].get_element_type(), arg_shape.size()))
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_and_slice<float, 1>)> kernel;
 
@@ -61,7 +62,7 @@ namespace ngraph
                                          arg_shape.size(),
                                          runtime::cpu::kernel::pad_and_slice);
 
-                    auto functor = [&,
+                    functor = [&,
                                     kernel,
                                     arg_shape,
                                     out_shape,
@@ -82,7 +83,6 @@ namespace ngraph
                                pad_mode,
                                ectx->arena);
                     };
-                    functors.emplace_back(functor);
                 }
                 else
                 {
@@ -90,7 +90,7 @@ namespace ngraph
 
                     SELECT_KERNEL(kernel, args[0].get_element_type(), runtime::cpu::kernel::pad_ref)
 
-                    auto functor = [&,
+                    functor = [&,
                                     kernel,
                                     arg_shape,
                                     out_shape,
@@ -111,8 +111,53 @@ namespace ngraph
                                pad_mode,
                                ectx->arena);
                     };
-                    functors.emplace_back(functor);
                 }
+
+                // The argument wrote its output into the middle of the output buffer, only the
+                // padding is left to fill
+                auto op_annotations = pad->get_op_annotations();
+                if (op_annotations && op_annotations->get_in_place_oi_pairs().size() > 0)
+                {
+                    size_t below = 0, above = 0, accumulated = 1;
+                    for (int i = arg_shape.size() - 1; i >= 0; i--)
+                    {
+                        below += padding_below[i] * accumulated;
+                        above += padding_above[i] * accumulated;
+                        accumulated *= arg_shape[i];
+                    }
+                    auto interior = shape_size(arg_shape);
+                    auto below_bytes = below * args[0].get_element_type().size();
+
+                    std::function<decltype(runtime::cpu::kernel::pad_borders<float>)>
+                        border_kernel;
+                    SELECT_KERNEL(border_kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::pad_borders)
+
+                    functor = [&,
+                               functor,
+                               border_kernel,
+                               below,
+                               interior,
+                               above,
+                               below_bytes,
+                               arg_buffer_index,
+                               padding_value_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        auto out = static_cast<char*>(ctx->buffer_data[out_buffer_index]);
+                        if (ctx->buffer_data[arg_buffer_index] == out + below_bytes)
+                        {
+                            border_kernel(
+                                out, ctx->buffer_data[padding_value_index], below, interior, above);
+                        }
+                        else
+                        {
+                            functor(ctx, ectx);
+                        }
+                    };
+                }
+                functors.emplace_back(functor);
             }
 
             template <>
@@ -128,7 +173,7 @@ namespace ngraph
 
                 if ((pad_mode == ngraph::op::PadMode::CONSTANT ||
                      pad_mode == ngraph::op::PadMode::REFLECT) &&
-                    is_optimized_et(pad->get_input_element_type(0)))
+                    is_optimized_et_and_rank(pad->get_input_element_type(0), arg_shape.size()))
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_and_slice<float, 1>)> kernel;
 
@@ -112,6 +112,8 @@ namespace ngraph
                     NGRAPH_CHECK(false,
                                  "Encountered 'dynamic' element type in fold_constant_convert");
                     break;
+                case element::Type_t::i4:
+                case element::Type_t::u4:
                 case element::Type_t::u1:
                     NGRAPH_CHECK(false, "Encountered 'u1' element type in fold_constant_convert");
                     break;
@@ -41,7 +41,8 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == arg_rank && is_optimized_et(args[0].get_element_type()))          \
+    if (reduction_axes.size() == arg_rank &&                                                       \
+        is_optimized_et_and_rank(args[0].get_element_type(), arg_rank))                            \
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
         SELECT_ETS_AND_RANK7(                                                                      \
@@ -58,7 +59,8 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == 1 && is_optimized_et(args[0].get_element_type()))                 \
+    if (reduction_axes.size() == 1 &&                                                              \
+        is_optimized_et_and_rank(args[0].get_element_type(), arg_rank))                            \
     {                                                                                              \
         if (*reduction_axes.begin() == arg_rank - 1)                                               \
         {                                                                                          \
@@ -72,7 +72,8 @@ namespace ngraph
                     return;
                 }
 
-                if (strided && is_optimized_et(args[0].get_element_type()))
+                if (strided &&
+                    is_optimized_et_and_rank(args[0].get_element_type(), arg0_shape.size()))
                 {
                     std::function<decltype(runtime::cpu::kernel::strided_replace_slice<float, 2>)>
                         kernel;
@@ -105,7 +106,7 @@ namespace ngraph
                     };
                     functors.emplace_back(functor);
                 }
-                else if (is_optimized_et(args[0].get_element_type()))
+                else if (is_optimized_et_and_rank(args[0].get_element_type(), arg0_shape.size()))
                 {
                     std::function<decltype(runtime::cpu::kernel::replace_slice<float, 2>)> kernel;
 
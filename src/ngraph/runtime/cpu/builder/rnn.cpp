@@ -29,6 +29,83 @@ namespace ngraph
     {
         namespace cpu
         {
+            template <typename RNN_PRIM>
+            static void build_gru(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const std::vector<TensorWrapper>& args,
+                                  const std::vector<TensorWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto src_layer_buffer_index =
+                    external_function->get_buffer_index(args[0].get_name());
+                auto src_iter_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto weights_layer_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto weights_iter_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto bias_buffer_index = external_function->get_buffer_index(args[4].get_name());
+                auto dst_layer_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto dst_iter_buffer_index = external_function->get_buffer_index(out[1].get_name());
+
+                auto& dnnl_emitter = external_function->get_dnnl_emitter();
+
+                // GRU needs 9 primitives: src_layer, src_iter, weights_layer, weights_iter, bias,
+                // dst_layer, dst_iter, workspace, and gru_forward.
+                // It needs a new workspace.
+                auto rnn_index = dnnl_emitter->reserve_primitive_space(
+                    9, false /* fwd and bwd */, true /* new workspace */);
+                auto& deps = dnnl_emitter->get_primitive_deps(rnn_index);
+                auto gru_desc =
+                    dnnl_emitter->get_gru_forward_desc<ngraph::op::Rnn, RNN_PRIM>(node, args, out);
+                size_t scratchpad_size =
+                    dnnl_emitter->query_scratchpad_gru_forward<RNN_PRIM>(gru_desc);
+
+                auto functor = [&,
+                                gru_desc,
+                                rnn_index,
+                                scratchpad_size,
+                                src_layer_buffer_index,
+                                src_iter_buffer_index,
+                                weights_layer_buffer_index,
+                                weights_iter_buffer_index,
+                                bias_buffer_index,
+                                dst_layer_buffer_index,
+                                dst_iter_buffer_index](CPURuntimeContext* ctx,
+                                                       CPUExecutionContext* /* ectx */) {
+                    if (ctx->first_iteration)
+                    {
+                        dnnl_emitter->build_gru_forward<RNN_PRIM>(ctx->dnnl_memories,
+                                                                  ctx->dnnl_primitives,
+                                                                  ctx->dnnl_scratchpad_mds,
+                                                                  ctx->dnnl_workspaces,
+                                                                  gru_desc,
+                                                                  deps,
+                                                                  rnn_index);
+                    }
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[src_layer_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[src_iter_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[weights_layer_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[3], ctx->buffer_data[weights_iter_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[4], ctx->buffer_data[bias_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[5], ctx->buffer_data[dst_layer_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[6], ctx->buffer_data[dst_iter_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[7], cpu::dnnl_utils::get_workspace_ptr(ctx, rnn_index, deps[8]));
+                    cpu::dnnl_utils::dnnl_invoke_primitive(
+                        ctx, rnn_index, deps, cpu::dnnl_utils::OpType::GRU, scratchpad_size);
+                };
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Rnn)
             {
@@ -110,7 +187,9 @@ namespace ngraph
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[6], ctx->buffer_data[dst_iter_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
-                            ctx, deps[7], ctx->dnnl_workspaces[deps[8]]);
+                            ctx,
+                            deps[7],
+                            cpu::dnnl_utils::get_workspace_ptr(ctx, rnn_index, deps[8]));
                         cpu::dnnl_utils::dnnl_invoke_primitive(ctx,
                                                                rnn_index,
                                                                deps,
@@ -119,6 +198,14 @@ namespace ngraph
                     };
                     functors.emplace_back(functor);
                 }
+                else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru))
+                {
+                    build_gru<dnnl::gru_forward>(external_function, node, args, out);
+                }
+                else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru))
+                {
+                    build_gru<dnnl::lbr_gru_forward>(external_function, node, args, out);
+                }
                 else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm))
                 {
                     auto src_iter_c_buffer_index =
@@ -131,13 +218,18 @@ namespace ngraph
                         external_function->get_buffer_index(args[5].get_name());
                     auto dst_iter_c_buffer_index =
                         external_function->get_buffer_index(out[2].get_name());
+                    bool with_peephole = rnn_op->has_peephole();
+                    auto weights_peephole_buffer_index =
+                        with_peephole ? external_function->get_buffer_index(args[6].get_name())
+                                      : 0;
 
                     // Rnn needs 11 primitives: src_layer, src_iter, src_iter_c, weights_layer,
                     // weights_iter, bias,
                     // dst_layer, dst_iter, dst_iter_c, workspace, and lstm_forward.
+                    // Peephole LSTMs also need weights_peephole.
                     // It needs a new workspace.
                     auto rnn_index = dnnl_emitter->reserve_primitive_space(
-                        11, false /* fwd and bwd */, true /* new workspace */);
+                        with_peephole ? 12 : 11, false /* fwd and bwd */, true /* new workspace */);
                     auto& deps = dnnl_emitter->get_primitive_deps(rnn_index);
                     auto rnn_desc =
                         dnnl_emitter->get_rnn_forward_desc<ngraph::op::Rnn>(node, args, out);
@@ -155,8 +247,10 @@ namespace ngraph
                                     bias_buffer_index,
                                     dst_layer_buffer_index,
                                     dst_iter_buffer_index,
-                                    dst_iter_c_buffer_index](CPURuntimeContext* ctx,
-                                                             CPUExecutionContext* ectx) {
+                                    dst_iter_c_buffer_index,
+                                    with_peephole,
+                                    weights_peephole_buffer_index](CPURuntimeContext* ctx,
+                                                                   CPUExecutionContext* ectx) {
                         if (ctx->first_iteration)
                         {
                             dnnl_emitter->build_rnn_forward(ctx->dnnl_memories,
@@ -185,11 +279,33 @@ namespace ngraph
                             ctx, deps[7], ctx->buffer_data[dst_iter_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[8], ctx->buffer_data[dst_iter_c_buffer_index]);
-                        cpu::dnnl_utils::set_memory_ptr(
-                            ctx, deps[9], ctx->dnnl_workspaces[deps[10]]);
-
-                        cpu::dnnl_utils::dnnl_invoke_primitive(
-                            ctx, rnn_index, deps, cpu::dnnl_utils::OpType::RNN, scratchpad_size);
+                        if (with_peephole)
+                        {
+                            cpu::dnnl_utils::set_memory_ptr(
+                                ctx, deps[10], ctx->buffer_data[weights_peephole_buffer_index]);
+                            cpu::dnnl_utils::set_memory_ptr(
+                                ctx,
+                                deps[9],
+                                cpu::dnnl_utils::get_workspace_ptr(ctx, rnn_index, deps[11]));
+                            cpu::dnnl_utils::dnnl_invoke_primitive(
+                                ctx,
+                                rnn_index,
+                                deps,
+                                cpu::dnnl_utils::OpType::RNN_PEEPHOLE,
+                                scratchpad_size);
+                        }
+                        else
+                        {
+                            cpu::dnnl_utils::set_memory_ptr(
+                                ctx,
+                                deps[9],
+                                cpu::dnnl_utils::get_workspace_ptr(ctx, rnn_index, deps[10]));
+                            cpu::dnnl_utils::dnnl_invoke_primitive(ctx,
+                                                                   rnn_index,
+                                                                   deps,
+                                                                   cpu::dnnl_utils::OpType::RNN,
+                                                                   scratchpad_size);
+                        }
                     };
                     functors.emplace_back(functor);
                 }
@@ -139,7 +139,8 @@ namespace ngraph
                 }
                 else
                 {
-                    if (is_strided(strides) && is_optimized_et(args[0].get_element_type()))
+                    if (is_strided(strides) &&
+                        is_optimized_et_and_rank(args[0].get_element_type(), arg_shape.size()))
                     {
                         std::function<decltype(runtime::cpu::kernel::strided_slice<float, 2>)>
                             kernel;
@@ -170,7 +171,7 @@ namespace ngraph
                         };
                         functors.emplace_back(functor);
                     }
-                    else if (is_optimized_et(args[0].get_element_type()))
+                    else if (is_optimized_et_and_rank(args[0].get_element_type(), arg_shape.size()))
                     {
                         std::function<decltype(runtime::cpu::kernel::slice<float, 2>)> kernel;
 
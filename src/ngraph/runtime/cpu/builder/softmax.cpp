@@ -85,7 +85,7 @@ namespace ngraph
                     functors.emplace_back(functor);
                     return;
                 }
-                else if (is_optimized_et(args[0].get_element_type()))
+                else if (is_optimized_et_and_rank(args[0].get_element_type(), arg_shape.size()))
                 {
                     if (axes.size() == arg_shape.size())
                     {
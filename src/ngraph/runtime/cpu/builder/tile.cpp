@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/runtime/cpu/kernel/rank_generic.hpp"
 #include "ngraph/runtime/cpu/kernel/tile.hpp"
 #include "ngraph/op/tile.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
@@ -62,8 +63,17 @@ namespace ngraph
                     auto out_rank = out_shape.size();
                     arg_shape.insert(arg_shape.begin(), out_rank - arg_rank, 1);
                     std::function<decltype(runtime::cpu::kernel::tile<float, 2>)> kernel;
-                    SELECT_KERNEL_ET_RANK(
-                        kernel, out[0].get_element_type(), out_rank, runtime::cpu::kernel::tile);
+                    auto& element_type = out[0].get_element_type();
+                    if (is_optimized_et_and_rank(element_type, out_rank))
+                    {
+                        SELECT_ETS_AND_RANK7(
+                            kernel, element_type, out_rank, runtime::cpu::kernel::tile);
+                    }
+                    else
+                    {
+                        SELECT_KERNEL_BY_SIZE(
+                            kernel, element_type, runtime::cpu::kernel::tile_generic)
+                    }
                     auto functor =
                         [&, kernel, arg_shape, out_shape, arg_buffer_index, out_buffer_index](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_autotuner.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Timed runs per candidate after one warm-up run. The fastest run counts.
+static const size_t s_timed_runs = 3;
+
+static string read_cpu_model()
+{
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0)
+        {
+            auto pos = line.find(':');
+            if (pos != string::npos && pos + 2 <= line.size())
+            {
+                return line.substr(pos + 2);
+            }
+        }
+    }
+    return "unknown";
+}
+
+runtime::cpu::CPUAutotuner& runtime::cpu::CPUAutotuner::get()
+{
+    static CPUAutotuner s_autotuner;
+    return s_autotuner;
+}
+
+bool runtime::cpu::CPUAutotuner::is_enabled()
+{
+    return getenv_bool("NGRAPH_CPU_AUTOTUNE");
+}
+
+runtime::cpu::CPUAutotuner::CPUAutotuner()
+    : m_cpu_model(read_cpu_model())
+{
+}
+
+// Kernels are timed with the intra-op thread count the executor was configured with, so a choice
+// made for one count does not carry over to another
+string runtime::cpu::CPUAutotuner::get_key(const string& signature) const
+{
+    stringstream ss;
+    ss << m_cpu_model << "/" << executor::GetCPUExecutor().get_num_cores() << "|" << signature;
+    return ss.str();
+}
+
+// The cache file holds one "<key>\t<choice>" line per tuned signature
+void runtime::cpu::CPUAutotuner::load(const string& path)
+{
+    ifstream in(path);
+    string line;
+    while (getline(in, line))
+    {
+        auto tab = line.rfind('\t');
+        if (tab == string::npos)
+        {
+            continue;
+        }
+        try
+        {
+            m_choices[line.substr(0, tab)] = stoul(line.substr(tab + 1));
+        }
+        catch (const exception&)
+        {
+            NGRAPH_WARN << "Ignoring malformed tuning cache entry in " << path;
+        }
+    }
+    m_loaded_path = path;
+}
+
+void runtime::cpu::CPUAutotuner::save(const string& path, const string& key, size_t choice)
+{
+    ofstream out(path, ios::app);
+    if (!out)
+    {
+        NGRAPH_WARN << "Cannot write tuning cache " << path;
+        return;
+    }
+    out << key << "\t" << choice << "\n";
+}
+
+size_t runtime::cpu::CPUAutotuner::select(const string& signature,
+                                          const vector<function<void()>>& candidates)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto path = getenv_string("NGRAPH_CPU_TUNING_CACHE");
+    if (!path.empty() && path != m_loaded_path)
+    {
+        load(path);
+    }
+
+    auto& counts = m_selection_counts[signature];
+    counts.resize(max(counts.size(), candidates.size()));
+
+    auto key = get_key(signature);
+    auto it = m_choices.find(key);
+    if (it != m_choices.end() && it->second < candidates.size())
+    {
+        counts[it->second]++;
+        return it->second;
+    }
+
+    size_t best = 0;
+    auto best_time = chrono::nanoseconds::max();
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        candidates[i]();
+        auto fastest = chrono::nanoseconds::max();
+        for (size_t run = 0; run < s_timed_runs; run++)
+        {
+            auto start = chrono::steady_clock::now();
+            candidates[i]();
+            fastest = min(fastest,
+                          chrono::duration_cast<chrono::nanoseconds>(
+                              chrono::steady_clock::now() - start));
+        }
+        NGRAPH_DEBUG << "Autotuning " << signature << ": candidate " << i << " takes "
+                     << fastest.count() << " ns";
+        if (fastest < best_time)
+        {
+            best = i;
+            best_time = fastest;
+        }
+    }
+
+    m_choices[key] = best;
+    if (!path.empty())
+    {
+        save(path, key, best);
+    }
+    counts[best]++;
+    return best;
+}
+
+size_t runtime::cpu::CPUAutotuner::get_selection_count(const string& signature, size_t choice)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_selection_counts.find(signature);
+    if (it == m_selection_counts.end() || choice >= it->second.size())
+    {
+        return 0;
+    }
+    return it->second[choice];
+}
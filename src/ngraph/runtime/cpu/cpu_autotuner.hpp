@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Picks between alternative kernels for an op by timing them on the op's
+            ///        actual shapes.
+            ///
+            /// Tuning is off unless NGRAPH_CPU_AUTOTUNE is set, in which case builders ask the
+            /// autotuner instead of applying their static rules. Results are keyed by the op
+            /// signature, the CPU model and the intra-op thread count. When
+            /// NGRAPH_CPU_TUNING_CACHE names a file they are loaded from and appended to it, so
+            /// later compilations and processes skip the measurements.
+            class CPU_BACKEND_API CPUAutotuner
+            {
+            public:
+                static CPUAutotuner& get();
+
+                static bool is_enabled();
+
+                /// \brief Returns the index of the fastest of `candidates` for `signature`.
+                ///        Each candidate runs one full kernel invocation on scratch buffers.
+                size_t select(const std::string& signature,
+                              const std::vector<std::function<void()>>& candidates);
+
+                /// \brief Returns how many times select() has picked `choice` for `signature`.
+                size_t get_selection_count(const std::string& signature, size_t choice);
+
+            private:
+                CPUAutotuner();
+                void load(const std::string& path);
+                void save(const std::string& path, const std::string& key, size_t choice);
+                std::string get_key(const std::string& signature) const;
+
+                std::mutex m_mutex;
+                std::string m_cpu_model;
+                std::string m_loaded_path;
+                std::unordered_map<std::string, size_t> m_choices;
+                std::unordered_map<std::string, std::vector<size_t>> m_selection_counts;
+            };
+        }
+    }
+}
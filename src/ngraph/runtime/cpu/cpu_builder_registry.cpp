@@ -29,6 +29,7 @@ namespace ngraph
                 register_builders_argmin_cpp();
                 register_builders_avg_pool_cpp();
                 register_builders_batch_norm_cpp();
+                register_builders_binary_convolution_cpp();
                 register_builders_bounded_relu_cpp();
                 register_builders_broadcast_cpp();
                 register_builders_broadcast_distributed_cpp();
@@ -41,6 +42,7 @@ namespace ngraph
                 register_builders_dropout_cpp();
                 register_builders_embedding_lookup_cpp();
                 register_builders_erf_cpp();
+                register_builders_fused_elementwise_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
@@ -52,6 +54,7 @@ namespace ngraph
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
                 register_builders_one_hot_cpp();
+                register_builders_packed_matmul_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
                 register_builders_quantization_cpp();
@@ -74,6 +77,7 @@ namespace ngraph
                 register_builders_slice_cpp();
                 register_builders_softmax_cpp();
                 register_builders_sum_cpp();
+                register_builders_tensor_iterator_cpp();
                 register_builders_tile_cpp();
                 register_builders_topk_cpp();
                 register_builders_update_slice_cpp();
@@ -28,6 +28,7 @@ namespace ngraph
             void register_builders_argmin_cpp();
             void register_builders_avg_pool_cpp();
             void register_builders_batch_norm_cpp();
+            void register_builders_binary_convolution_cpp();
             void register_builders_bounded_relu_cpp();
             void register_builders_broadcast_cpp();
             void register_builders_broadcast_distributed_cpp();
@@ -40,6 +41,7 @@ namespace ngraph
             void register_builders_dropout_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
+            void register_builders_fused_elementwise_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
             void register_builders_gelu_cpp();
@@ -51,6 +53,7 @@ namespace ngraph
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
             void register_builders_one_hot_cpp();
+            void register_builders_packed_matmul_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
             void register_builders_quantization_cpp();
@@ -73,6 +76,7 @@ namespace ngraph
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
             void register_builders_sum_cpp();
+            void register_builders_tensor_iterator_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
             void register_builders_update_slice_cpp();
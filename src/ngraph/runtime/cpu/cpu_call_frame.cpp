@@ -24,6 +24,7 @@
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -147,6 +148,8 @@ void runtime::cpu::CPU_CallFrame::call(
         }
         m_prev_ctx = id;
         m_num_ctx_available--;
+        m_context_bytes_in_use += get_context_bytes(m_ctx_vec[id]);
+        m_peak_context_bytes = std::max(m_peak_context_bytes, m_context_bytes_in_use);
     }
 
     m_ctx_vec[id]->pc = 0;
@@ -156,10 +159,57 @@ void runtime::cpu::CPU_CallFrame::call(
     m_mutex.lock();
     m_id_pool[id] = true;
     m_num_ctx_available++;
+    m_context_bytes_in_use -= get_context_bytes(m_ctx_vec[id]);
     m_mutex.unlock();
     m_cv.notify_one();
 }
 
+size_t runtime::cpu::CPU_CallFrame::get_intermediate_bytes(CPURuntimeContext* ctx) const
+{
+    size_t bytes = 0;
+    for (auto buffer : ctx->memory_buffers)
+    {
+        bytes += buffer->size();
+    }
+    return bytes;
+}
+
+size_t runtime::cpu::CPU_CallFrame::get_scratchpad_bytes(CPURuntimeContext* ctx) const
+{
+    if (m_external_function->is_direct_execution() && ctx->scratchpad_buffer)
+    {
+        return ctx->scratchpad_buffer->size();
+    }
+    return 0;
+}
+
+size_t runtime::cpu::CPU_CallFrame::get_context_bytes(CPURuntimeContext* ctx) const
+{
+    return get_intermediate_bytes(ctx) + get_scratchpad_bytes(ctx);
+}
+
+runtime::MemoryReport runtime::cpu::CPU_CallFrame::get_memory_report()
+{
+    MemoryReport report = m_external_function->get_op_memory_report();
+    report.add(MemoryReport::constants, m_external_function->get_constant_bytes());
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    for (auto ctx : m_ctx_vec)
+    {
+        report.add(MemoryReport::intermediates, get_intermediate_bytes(ctx));
+        report.add(MemoryReport::scratchpad, get_scratchpad_bytes(ctx));
+    }
+    report.add(MemoryReport::workspaces,
+               m_external_function->get_dnnl_emitter()->get_workspace_bytes());
+    report.add_saved(MemoryReport::scratchpad, m_external_function->get_saved_scratchpad_bytes());
+    report.add_saved(MemoryReport::workspaces, m_external_function->get_saved_workspace_bytes());
+
+    size_t shared_bytes = report.get_bytes(MemoryReport::constants) +
+                          report.get_bytes(MemoryReport::workspaces);
+    report.set_peak_bytes(shared_bytes + m_peak_context_bytes);
+    return report;
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -197,8 +247,10 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
         ctx->first_iteration = true;
+        ctx->sample_ops = false;
 
         ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+        ctx->distributed_requests.resize(m_external_function->get_distributed_request_count());
 
         // Create temporary buffer pools
         size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
@@ -209,11 +261,11 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         }
         const auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
         // Create scratchpad
-        auto scratchpad_size = dnnl_emitter->get_max_scratchpad_size();
+        auto scratchpad_size = m_external_function->get_dnnl_scratchpad_buffer_size();
         if (m_external_function->is_direct_execution())
         {
-            ctx->dnnl_primitives =
-                std::vector<dnnl::primitive*>(dnnl_emitter->get_dnnl_primitives().size());
+            auto primitive_count = dnnl_emitter->get_dnnl_primitives().size();
+            ctx->dnnl_primitives = std::vector<dnnl::primitive*>(primitive_count);
             ctx->dnnl_memories =
                 std::vector<dnnl::memory*>(dnnl_emitter->get_dnnl_memories().size());
             ctx->dnnl_scratchpad_mds =
@@ -226,6 +278,29 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
             {
                 ctx->scratchpad_buffer = nullptr;
             }
+
+            // Scratchpads and workspaces planned into the intermediate memory pool
+            auto pool = ctx->memory_buffers.empty()
+                            ? nullptr
+                            : static_cast<char*>(ctx->memory_buffers[0]->get_ptr());
+            const auto& scratchpad_offsets = m_external_function->get_dnnl_scratchpad_offsets();
+            const auto& workspace_offsets = m_external_function->get_dnnl_workspace_offsets();
+            if (pool && !scratchpad_offsets.empty())
+            {
+                ctx->dnnl_scratchpad_ptrs = std::vector<char*>(primitive_count, nullptr);
+                for (auto& p : scratchpad_offsets)
+                {
+                    ctx->dnnl_scratchpad_ptrs[p.first] = pool + p.second;
+                }
+            }
+            if (pool && !workspace_offsets.empty())
+            {
+                ctx->dnnl_workspace_ptrs = std::vector<char*>(primitive_count, nullptr);
+                for (auto& p : workspace_offsets)
+                {
+                    ctx->dnnl_workspace_ptrs[p.first] = pool + p.second;
+                }
+            }
         }
         else
         {
@@ -259,9 +334,14 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 
         delete[] ctx->op_durations;
         delete[] ctx->p_en;
+        auto& primitive_cache = DNNLPrimitiveCache::get();
         for (auto p : ctx->dnnl_primitives)
         {
-            delete p;
+            // Primitives shared through the process-wide cache outlive this context
+            if (!primitive_cache.owns(p))
+            {
+                delete p;
+            }
         }
         for (auto m : ctx->dnnl_memories)
         {
@@ -27,6 +27,7 @@
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/memory_report.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 class CPURuntimeContextCG;
@@ -73,6 +74,13 @@ namespace ngraph
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
+                /// \brief Memory held by the execution contexts and the compiled function.
+                ///
+                /// Every context owns its intermediate and scratchpad buffers. The peak is the
+                /// largest sum of those buffers over the contexts that were executing at the same
+                /// time.
+                MemoryReport get_memory_report();
+
                 void setup_runtime_context(runtime::Allocator* allocator);
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
@@ -87,6 +95,10 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                size_t get_intermediate_bytes(CPURuntimeContext* ctx) const;
+                size_t get_scratchpad_bytes(CPURuntimeContext* ctx) const;
+                size_t get_context_bytes(CPURuntimeContext* ctx) const;
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
                 std::mutex m_mutex;
@@ -94,6 +106,8 @@ namespace ngraph
                 volatile size_t m_num_ctx_available = 0;
                 size_t m_prev_ctx = 0;
                 size_t m_num_ctx = 1;
+                size_t m_context_bytes_in_use = 0;
+                size_t m_peak_context_bytes = 0;
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
@@ -16,11 +16,15 @@
 
 #include "cpu_cse.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/conv_fused.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/group_conv.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/structural_hash.hpp"
 
 using namespace dnnl;
 using namespace ngraph;
@@ -52,6 +56,43 @@ static bool cse_convertlayout(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
     return is_args_same && is_output_mem_desc_same;
 }
 
+// Convolutions may carry fused post-ops in their annotations, which the generic structural
+// comparison does not see
+static bool cse_post_op_producer(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_post_op_producer for " << a->get_name() << " and " << b->get_name();
+
+    auto get_post_ops = [](std::shared_ptr<Node> node) {
+        static const std::vector<runtime::cpu::PostOp> no_post_ops;
+        auto op_annotations = std::static_pointer_cast<runtime::cpu::CPUOpAnnotations>(
+            std::static_pointer_cast<ngraph::op::Op>(node)->get_op_annotations());
+        return op_annotations ? op_annotations->get_post_ops() : no_post_ops;
+    };
+    if (get_post_ops(a) != get_post_ops(b) ||
+        runtime::cpu::dnnl_utils::use_dnnl_kernel(a.get()) !=
+            runtime::cpu::dnnl_utils::use_dnnl_kernel(b.get()))
+    {
+        return false;
+    }
+
+    StructuralHash structural_hash;
+    if (!structural_hash.attributes_equal(a, b) || a->input_values() != b->input_values())
+    {
+        return false;
+    }
+
+    auto a_layout_desc = static_cast<ngraph::runtime::cpu::LayoutDescriptor*>(
+        a->get_output_tensor(0).get_tensor_layout().get());
+    auto b_layout_desc = static_cast<ngraph::runtime::cpu::LayoutDescriptor*>(
+        b->get_output_tensor(0).get_tensor_layout().get());
+    if (!a_layout_desc || !b_layout_desc)
+    {
+        return a_layout_desc == b_layout_desc;
+    }
+    return runtime::cpu::dnnl_utils::compare_dnnl_mds(a_layout_desc->get_dnnl_md(),
+                                                      b_layout_desc->get_dnnl_md());
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -66,7 +107,11 @@ namespace ngraph
                 const static std::unordered_map<
                     std::type_index,
                     std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
-                    cse_map{{TI(runtime::cpu::op::ConvertLayout), cse_convertlayout}};
+                    cse_map{{TI(runtime::cpu::op::ConvertLayout), cse_convertlayout},
+                            {TI(ngraph::op::v0::Convolution), cse_post_op_producer},
+                            {TI(ngraph::op::v0::ConvolutionBias), cse_post_op_producer},
+                            {TI(ngraph::op::v0::ConvolutionBiasAdd), cse_post_op_producer},
+                            {TI(ngraph::op::v0::GroupConvolution), cse_post_op_producer}};
                 return cse_map;
             }
         }
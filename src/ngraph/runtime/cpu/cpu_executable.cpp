@@ -20,6 +20,7 @@
 
 #include "cpu_backend_visibility.h"
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -63,6 +64,7 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executabl
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    event::Duration d1("call", "CPU");
     m_call_frame->call(outputs, inputs);
 
     return true;
@@ -111,6 +113,41 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     return rc;
 }
 
+vector<runtime::cpu::SampledOpLatency>
+    runtime::cpu::CPU_Executable::get_sampled_performance_data() const
+{
+    OpSampler* sampler = m_external_function->get_op_sampler();
+    return sampler ? sampler->snapshot() : vector<SampledOpLatency>{};
+}
+
+void runtime::cpu::CPU_Executable::reset_sampled_performance_data()
+{
+    if (OpSampler* sampler = m_external_function->get_op_sampler())
+    {
+        sampler->reset();
+    }
+}
+
+size_t runtime::cpu::CPU_Executable::get_constant_bytes() const
+{
+    return m_external_function->get_constant_bytes();
+}
+
+size_t runtime::cpu::CPU_Executable::get_released_constant_bytes() const
+{
+    return m_external_function->get_released_constant_bytes();
+}
+
+vector<runtime::cpu::LayoutReorder> runtime::cpu::CPU_Executable::get_layout_reorders() const
+{
+    return m_external_function->get_layout_reorders();
+}
+
+runtime::MemoryReport runtime::cpu::CPU_Executable::get_memory_report() const
+{
+    return m_call_frame->get_memory_report();
+}
+
 shared_ptr<ngraph::op::v0::Parameter>
     runtime::cpu::CPU_Executable::get_parameter(size_t index) const
 {
@@ -19,11 +19,14 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_reorder.hpp"
+#include "ngraph/runtime/cpu/cpu_op_sampler.hpp"
 #include "ngraph/runtime/executable.hpp"
 
 namespace ngraph
@@ -50,6 +53,23 @@ namespace ngraph
 
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Per-op latency collected from one in NGRAPH_CPU_PERF_SAMPLE_PERIOD
+                ///        calls. Safe to call while other threads execute the executable.
+                std::vector<SampledOpLatency> get_sampled_performance_data() const;
+                /// \brief Clear the sampled per-op latency
+                void reset_sampled_performance_data();
+
+                /// \brief Bytes of constant data used by the executable
+                size_t get_constant_bytes() const;
+                /// \brief Bytes of constant data of the compiled Function that the executable
+                ///        replaced by its own copies during compilation
+                size_t get_released_constant_bytes() const;
+                /// \brief Layout conversions (reorders) executed by every call, with the bytes
+                ///        each one moves
+                std::vector<LayoutReorder> get_layout_reorders() const;
+
+                MemoryReport get_memory_report() const override;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
@@ -14,14 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 
 #if defined(NGRAPH_TBB_ENABLE)
 #define TBB_PREVIEW_FLOW_GRAPH_TRACE 1
@@ -39,8 +42,10 @@
 #include "contrib/mlir/core/pass/mlir_subgraph_extraction.hpp"
 #endif
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
@@ -92,6 +97,7 @@
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_equal.hpp"
 #include "ngraph/op/group_conv.hpp"
+#include "ngraph/op/gru_cell.hpp"
 #include "ngraph/op/less.hpp"
 #include "ngraph/op/less_equal.hpp"
 #include "ngraph/op/log.hpp"
@@ -101,6 +107,7 @@
 #include "ngraph/op/logical_xor.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/lstm_cell.hpp"
+#include "ngraph/op/lstm_sequence.hpp"
 #include "ngraph/op/matmul.hpp"
 #include "ngraph/op/max.hpp"
 #include "ngraph/op/max_pool.hpp"
@@ -125,6 +132,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/rnn_cell.hpp"
 #include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/op/select.hpp"
@@ -140,9 +148,11 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
 #include "ngraph/op/tile.hpp"
 #include "ngraph/op/topk.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -196,6 +206,7 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_dnnl_primitive_build.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
@@ -204,6 +215,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_post_op_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 
@@ -266,6 +278,297 @@ runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
     }
 }
 
+// Bytes of constant data in the nodes, storage shared by several Constants is counted once
+static size_t get_constant_storage_bytes(const NodeVector& nodes)
+{
+    unordered_set<const void*> buffers;
+    size_t bytes = 0;
+    for (auto& node : nodes)
+    {
+        if (auto constant = as_type_ptr<ngraph::op::v0::Constant>(node))
+        {
+            if (buffers.insert(constant->get_data_ptr()).second)
+            {
+                bytes += constant->get_output_tensor(0).size();
+            }
+        }
+    }
+    return bytes;
+}
+
+// Trace event args with the shape, type and bytes of each input and output of an op
+static string get_trace_args(const vector<runtime::cpu::TensorTracerAttributes>& inputs,
+                             const vector<runtime::cpu::TensorTracerAttributes>& outputs)
+{
+    stringstream ss;
+    auto append = [&ss](const string& key,
+                        const vector<runtime::cpu::TensorTracerAttributes>& tensors) {
+        ss << "\"" << key << "\":[";
+        for (size_t i = 0; i < tensors.size(); i++)
+        {
+            const runtime::cpu::TensorTracerAttributes& tensor = tensors[i];
+            ss << (i == 0 ? "" : ",") << R"({"shape":"{)" << join(tensor.m_t_shape)
+               << R"(}","type":")" << tensor.m_type_of_element.get_type_name()
+               << R"(","bytes":)"
+               << tensor.m_number_of_elements * tensor.m_type_of_element.size() << "}";
+        }
+        ss << "]";
+    };
+    ss << "{";
+    append("inputs", inputs);
+    ss << ",";
+    append("outputs", outputs);
+    ss << "}";
+    return ss.str();
+}
+
+// Record the constant storage and the intermediate outputs of every op. Intermediates share the
+// memory pool, so the bytes attributed to ops may add up to more than the pool size.
+void runtime::cpu::CPU_ExternalFunction::record_op_memory()
+{
+    unordered_set<const void*> buffers;
+    for (auto& node : m_active_constants)
+    {
+        auto constant = static_pointer_cast<ngraph::op::v0::Constant>(node);
+        if (buffers.insert(constant->get_data_ptr()).second)
+        {
+            m_op_memory_report.add_op(node->get_name(),
+                                      MemoryReport::constants,
+                                      node->get_output_tensor(0).size());
+        }
+    }
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        for (auto& output : node->outputs())
+        {
+            auto& tensor = output.get_tensor();
+            auto role = m_tensor_roles.find(tensor.get_name());
+            if (role != m_tensor_roles.end() && role->second == TensorRole::INTERMEDIATE)
+            {
+                m_op_memory_report.add_op(
+                    node->get_name(), MemoryReport::intermediates, tensor.size());
+            }
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::record_layout_reorders()
+{
+    size_t total_bytes = 0;
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (!is_type<runtime::cpu::op::ConvertLayout>(node))
+        {
+            continue;
+        }
+        auto& input = node->get_input_tensor(0);
+        auto& output = node->get_output_tensor(0);
+        size_t bytes = input.get_tensor_layout()->get_allocated_size() +
+                       output.get_tensor_layout()->get_allocated_size();
+        auto producer = node->get_input_node_ptr(0)->get_name();
+        NGRAPH_DEBUG << "Layout reorder " << node->get_name() << " of " << producer << " moves "
+                     << bytes << " bytes";
+        m_layout_reorders.push_back({node->get_name(), producer, bytes});
+        total_bytes += bytes;
+    }
+    NGRAPH_DEBUG << m_function_name << " runs " << m_layout_reorders.size()
+                 << " layout reorders moving " << total_bytes << " bytes";
+}
+
+// Place the DNNL scratchpads and workspaces of each op in the intermediate memory pool. They are
+// only used while their op runs, so they can share pool memory with any intermediate tensor that
+// is not live at that point. Intermediates of cacheable ops keep their values between calls, as
+// do all intermediates when memory reuse is off, so they are treated as live throughout.
+void runtime::cpu::CPU_ExternalFunction::plan_dnnl_temporaries(
+    const vector<OpTemporaries>& op_temporaries, bool reuse_memory)
+{
+    // Until they are planned, every scratchpad uses the shared scratchpad buffer
+    m_shared_scratchpad_size = m_dnnl_emitter->get_max_scratchpad_size();
+#if defined(NGRAPH_TBB_ENABLE)
+    // The flow graph runs independent ops concurrently, so their temporaries may overlap in time
+    if (m_use_tbb)
+    {
+        return;
+    }
+#endif
+    if (op_temporaries.empty())
+    {
+        return;
+    }
+
+    auto ops = m_function->get_ordered_ops();
+    unordered_map<const Node*, size_t> positions;
+    unordered_map<const descriptor::Tensor*, pair<size_t, size_t>> live_ranges;
+    unordered_set<const descriptor::Tensor*> persistent;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        auto& node = ops[i];
+        positions[node.get()] = i;
+        for (auto& input : node->inputs())
+        {
+            auto it = live_ranges.find(&input.get_tensor());
+            if (it != live_ranges.end())
+            {
+                it->second.second = i;
+            }
+        }
+        bool cacheable = false;
+        if (node->is_op())
+        {
+            auto op_annotations = static_pointer_cast<ngraph::op::Op>(node)->get_op_annotations();
+            cacheable = op_annotations && op_annotations->is_cacheable();
+        }
+        for (auto& output : node->outputs())
+        {
+            live_ranges[&output.get_tensor()] = make_pair(i, i);
+            if (!reuse_memory || cacheable)
+            {
+                persistent.insert(&output.get_tensor());
+            }
+        }
+    }
+
+    struct Block
+    {
+        size_t first;
+        size_t last;
+        size_t begin;
+        size_t end;
+    };
+    vector<Block> blocks;
+    for (auto& ele : bufferID_to_tensorSets)
+    {
+        if (ele.second.first != TensorRole::INTERMEDIATE)
+        {
+            continue;
+        }
+        for (auto tensor : ele.second.second)
+        {
+            auto it = live_ranges.find(tensor);
+            size_t first = 0;
+            size_t last = ops.size();
+            if (it != live_ranges.end() && persistent.count(tensor) == 0)
+            {
+                first = it->second.first;
+                last = it->second.second;
+            }
+            auto begin = tensor->get_pool_offset();
+            blocks.push_back({first, last, begin, begin + tensor->size()});
+        }
+    }
+
+    auto alignment = s_memory_pool_alignment;
+    auto align = [alignment](size_t offset) {
+        return (offset + alignment - 1) / alignment * alignment;
+    };
+    size_t pool_size = m_memory_buffer_sizes.empty() ? 0 : m_memory_buffer_sizes[0];
+    size_t pool_end = pool_size;
+    // First fit below the blocks live at `position`, or on top of them
+    auto place = [&](size_t position, size_t size, const vector<pair<size_t, size_t>>& taken) {
+        vector<pair<size_t, size_t>> ranges = taken;
+        for (auto& block : blocks)
+        {
+            if (block.first <= position && position <= block.last)
+            {
+                ranges.push_back(make_pair(block.begin, block.end));
+            }
+        }
+        sort(ranges.begin(), ranges.end());
+        size_t offset = 0;
+        for (auto& range : ranges)
+        {
+            if (offset + size <= range.first)
+            {
+                break;
+            }
+            offset = max(offset, align(range.second));
+        }
+        pool_end = max(pool_end, offset + size);
+        return offset;
+    };
+
+    // Workspaces first, then scratchpads, so the growth of the pool can be attributed to each
+    size_t workspace_bytes = 0;
+    vector<size_t> workspace_offsets(op_temporaries.size(), 0);
+    for (size_t i = 0; i < op_temporaries.size(); i++)
+    {
+        auto& temporaries = op_temporaries[i];
+        if (temporaries.workspace_size == 0)
+        {
+            continue;
+        }
+        workspace_offsets[i] =
+            place(positions[temporaries.node], temporaries.workspace_size, {});
+        workspace_bytes += temporaries.workspace_size;
+        for (auto p = temporaries.first_primitive; p < temporaries.end_primitive; p++)
+        {
+            m_dnnl_workspace_offsets.push_back(make_pair(p, workspace_offsets[i]));
+            m_dnnl_emitter->set_workspace_planned(p);
+        }
+        m_op_memory_report.add_op(
+            temporaries.node->get_name(), MemoryReport::workspaces, temporaries.workspace_size);
+    }
+    size_t workspace_growth = pool_end - pool_size;
+
+    // Scratchpads queried outside of any op, or by an op that reserved no primitive for them,
+    // cannot be planned
+    m_shared_scratchpad_size = m_dnnl_emitter->get_unscoped_scratchpad_size();
+    size_t scratchpad_bytes = 0;
+    for (size_t i = 0; i < op_temporaries.size(); i++)
+    {
+        auto& temporaries = op_temporaries[i];
+        if (temporaries.scratchpad_size == 0)
+        {
+            continue;
+        }
+        if (temporaries.first_primitive == temporaries.end_primitive)
+        {
+            m_shared_scratchpad_size = max(m_shared_scratchpad_size, temporaries.scratchpad_size);
+            continue;
+        }
+        vector<pair<size_t, size_t>> taken;
+        if (temporaries.workspace_size)
+        {
+            taken.push_back(make_pair(workspace_offsets[i],
+                                      workspace_offsets[i] + temporaries.workspace_size));
+        }
+        auto offset = place(positions[temporaries.node], temporaries.scratchpad_size, taken);
+        scratchpad_bytes = max(scratchpad_bytes, temporaries.scratchpad_size);
+        for (auto p = temporaries.first_primitive; p < temporaries.end_primitive; p++)
+        {
+            m_dnnl_scratchpad_offsets.push_back(make_pair(p, offset));
+        }
+        m_op_memory_report.add_op(
+            temporaries.node->get_name(), MemoryReport::scratchpad, temporaries.scratchpad_size);
+    }
+    size_t scratchpad_growth = pool_end - pool_size - workspace_growth;
+
+    if (pool_end > pool_size)
+    {
+        if (m_memory_buffer_sizes.empty())
+        {
+            m_memory_buffer_sizes.push_back(pool_end);
+        }
+        else
+        {
+            m_memory_buffer_sizes[0] = pool_end;
+        }
+    }
+
+    m_saved_workspace_bytes =
+        workspace_bytes > workspace_growth ? workspace_bytes - workspace_growth : 0;
+    m_saved_scratchpad_bytes =
+        scratchpad_bytes > scratchpad_growth ? scratchpad_bytes - scratchpad_growth : 0;
+    NGRAPH_DEBUG << m_function_name << " places " << workspace_bytes << " workspace and "
+                 << scratchpad_bytes << " scratchpad bytes in the memory pool, which grows from "
+                 << pool_size << " to " << pool_end << " bytes";
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_dnnl_scratchpad_buffer_size() const
+{
+    return m_shared_scratchpad_size;
+}
+
 class StaticInitializers
 {
 public:
@@ -503,8 +806,10 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
     {
         return;
     }
+    event::Duration compile_span("compile", "CPU", R"({"function":")" + m_function_name + "\"}");
 
     m_dnnl_emitter.reset(new DNNLEmitter());
+    const size_t source_constant_bytes = get_constant_storage_bytes(m_function->get_ops());
 
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager, pass_config);
@@ -706,6 +1011,9 @@ using namespace ngraph;
             }
         }
     }
+    m_constant_bytes = get_constant_storage_bytes(m_active_constants);
+    m_released_constant_bytes =
+        source_constant_bytes > m_constant_bytes ? source_constant_bytes - m_constant_bytes : 0;
 
     generate_class_declarations(writer);
 
@@ -880,6 +1188,8 @@ using namespace ngraph;
             }
         }
     }
+    record_op_memory();
+    record_layout_reorders();
 
     // Add outputs to the variable name map
     for (size_t i = 0; i < m_function->get_output_size(); ++i)
@@ -1237,17 +1547,21 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
             }
         }
 #endif
-        // this checks averts the decomposition of LSTMCell
-        // we will map LSTMCell to LSTM CPU op in the later
-        // graph pass
-        if (typeid(ngraph::op::v0::LSTMCell) == typeid(node))
-        {
-            // DNNL version < 1.0 doesnt support peephole for LSTM, we will skip if the LSTMCell
-            // has peephole. LSTMCell with no peephole support is constant initialized to zero
-            // TODO (pthoreho) : For DNNL > V1.0, change dnnl kernel integration to compute for
-            // LSTMCell with peephole as well.
-            // Not supported on codegen
-            return m_direct_execution && is_type<ngraph::op::v0::Constant>(node.get_argument(6));
+        // this checks averts the decomposition of the recurrent cell and sequence ops
+        // we will map them to the Rnn CPU op in the later graph passes
+        // Not supported on codegen
+        if (typeid(ngraph::op::v0::LSTMCell) == typeid(node) ||
+            typeid(ngraph::op::v3::GRUCell) == typeid(node) ||
+            typeid(ngraph::op::v0::RNNCell) == typeid(node) ||
+            typeid(ngraph::op::v0::LSTMSequence) == typeid(node))
+        {
+            return m_direct_execution && runtime::cpu::pass::RNNOpFusion::is_supported(node);
+        }
+        // TensorIterator loops are fused into Rnn where possible and otherwise run their
+        // compiled body once per iteration
+        else if (typeid(ngraph::op::v0::TensorIterator) == typeid(node))
+        {
+            return m_direct_execution;
         }
         else if (typeid(ngraph::op::v0::GeluBackpropFactor) == typeid(node))
         {
@@ -1293,6 +1607,8 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(ImplicitBroadcastElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass)
+    REGISTER_KNOBBED_PASS(TensorIteratorRNNFusion, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(RNNOpFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(VanillaRNNFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass)
@@ -1321,6 +1637,13 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    // Unset, zero and negative values all select the default bucket size
+    int32_t bucket_bytes = getenv_int("NGRAPH_ALLREDUCE_BUCKET_BYTES");
+    size_t allreduce_bucket_bytes = bucket_bytes > 0
+                                        ? static_cast<size_t>(bucket_bytes)
+                                        : ngraph::pass::AllReduceBucketing::default_bucket_bytes;
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        AllReduceBucketing, true, ngraph::pass, allreduce_bucket_bytes)
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
     if (m_execution_mode == EXECUTION_MODE::MLIR)
@@ -1333,12 +1656,18 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU())
+    REGISTER_KNOBBED_PASS(CPUPostOpFusion, true, runtime::cpu::pass)
+    // Fused elementwise chains only have a DEX builder
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUElementwiseFusion, true, runtime::cpu::pass)
+    }
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
     REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUConvertLayoutConstantFolding, true, runtime::cpu::pass)
-    REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS_WITH_ARGS(CPUMemoryOptimization, true, runtime::cpu::pass, !m_use_tbb)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
@@ -1412,6 +1741,8 @@ static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_trace
     case element::Type_t::f64:
     case element::Type_t::i16:
     case element::Type_t::i64:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::u16:
     case element::Type_t::u32:
@@ -1460,6 +1791,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     {
         return;
     }
+    event::Duration build_span("build", "CPU", R"({"function":")" + m_function_name + "\"}");
+
+    const size_t source_constant_bytes = get_constant_storage_bytes(m_function->get_ops());
 
 #if defined(NGRAPH_TBB_ENABLE)
     if (m_use_tbb && (runtime::cpu::IsTracingEnabled() || m_emit_timing))
@@ -1551,6 +1885,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     {
         if (node->is_constant())
         {
+            m_active_constants.push_back(node);
             auto output_tensor = &node->get_output_tensor(0);
             m_buffer_indices[output_tensor->get_name()] = buffer_index;
             constant_tensor_data.emplace_back(
@@ -1572,6 +1907,14 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         }
     }
 
+    m_constant_bytes = get_constant_storage_bytes(m_active_constants);
+    m_released_constant_bytes =
+        source_constant_bytes > m_constant_bytes ? source_constant_bytes - m_constant_bytes : 0;
+    NGRAPH_DEBUG << "Constants of " << m_function_name << " use " << m_constant_bytes
+                 << " bytes, released " << m_released_constant_bytes << " bytes";
+    record_op_memory();
+    record_layout_reorders();
+
     // Inputs
     size_t arg_index = 0;
     for (auto& param : m_function->get_parameters())
@@ -1618,6 +1961,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
+                        pass_config.get_pass_attribute("ReuseMemory");
+    vector<OpTemporaries> op_temporaries;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1657,11 +2003,49 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names, t_out_attrs, t_in_attrs);
         op_names.push_back(node->get_name());
-        handler->second(this, node.get(), in, out);
+        m_op_trace_args.push_back(get_trace_args(t_in_attrs, t_out_attrs));
+        auto first_primitive = m_dnnl_emitter->get_dnnl_primitives().size();
+        m_dnnl_emitter->begin_op_temporaries();
+        {
+            event::Duration builder_span(node->get_name(), "Builder");
+            handler->second(this, node.get(), in, out);
+        }
+        m_dnnl_emitter->end_op_temporaries();
+        // Wait for the asynchronous collectives producing the inputs of this node
+        set<size_t> request_slots;
+        for (Input<Node> input : node->inputs())
+        {
+            auto it = m_distributed_request_slots.find(input.get_source_output().get_node());
+            if (it != m_distributed_request_slots.end())
+            {
+                request_slots.insert(it->second);
+            }
+        }
+        if (!request_slots.empty())
+        {
+            auto node_functor = functors.back();
+            functors.back() = [node_functor, request_slots](CPURuntimeContext* ctx,
+                                                             CPUExecutionContext* ectx) {
+                for (auto slot : request_slots)
+                {
+                    if (ctx->distributed_requests[slot])
+                    {
+                        ctx->distributed_requests[slot]->wait();
+                    }
+                }
+                node_functor(ctx, ectx);
+            };
+        }
+        if (m_dnnl_emitter->get_op_workspace_size() || m_dnnl_emitter->get_op_scratchpad_size())
+        {
+            op_temporaries.push_back({node.get(),
+                                      first_primitive,
+                                      m_dnnl_emitter->get_dnnl_primitives().size(),
+                                      m_dnnl_emitter->get_op_workspace_size(),
+                                      m_dnnl_emitter->get_op_scratchpad_size()});
+        }
 
         auto cacheable = true;
-        auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
-                            pass_config.get_pass_attribute("ReuseMemory");
         if (node->is_op())
         {
             auto op = std::static_pointer_cast<ngraph::op::Op>(node);
@@ -1734,6 +2118,19 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_perf_counters.emplace_back(node, 0, 0);
     }
+    plan_dnnl_temporaries(op_temporaries, reuse_memory);
+
+    int32_t sample_period =
+        getenv_int("NGRAPH_CPU_PERF_SAMPLE_PERIOD", s_default_perf_sample_period);
+    if (sample_period > 0)
+    {
+        vector<shared_ptr<const Node>> sampled_nodes;
+        for (const runtime::PerformanceCounter& counter : m_perf_counters)
+        {
+            sampled_nodes.push_back(counter.get_node());
+        }
+        m_op_sampler.reset(new OpSampler(sampled_nodes, sample_period));
+    }
 
     if (getenv_bool("NGRAPH_DEX_DEBUG"))
     {
@@ -1801,6 +2198,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
+        ctx->sample_ops = m_op_sampler && m_op_sampler->begin_call();
 
         if (ctx->first_iteration)
         {
@@ -1853,8 +2251,22 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
+                                    uint64_t sample_start = 0;
+                                    if (ctx->sample_ops)
+                                    {
+                                        sample_start = OpSampler::now();
+                                    }
+                                    event::Duration op_span(op_names.at(index),
+                                                            m_op_attrs.at(index).Description,
+                                                            m_op_trace_args.at(index));
                                     CPUExecutionContext ectx{0};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
+                                    op_span.write();
+                                    if (ctx->sample_ops)
+                                    {
+                                        m_op_sampler->record(index,
+                                                             OpSampler::now() - sample_start);
+                                    }
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         end_ts = cpu::Clock::now();
@@ -1985,7 +2397,20 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         this->dump_one_kernel(debug_tracer, ctx, true);
                     }
 
+                    uint64_t sample_start = 0;
+                    if (ctx->sample_ops)
+                    {
+                        sample_start = OpSampler::now();
+                    }
+                    event::Duration op_span(op_names.at(index),
+                                            m_op_attrs.at(index).Description,
+                                            m_op_trace_args.at(index));
                     executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
+                    op_span.write();
+                    if (ctx->sample_ops)
+                    {
+                        m_op_sampler->record(index, OpSampler::now() - sample_start);
+                    }
 
                     if (debug_tracer.tracing_is_enabled())
                     {
@@ -2031,6 +2456,15 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
         }
+        // Complete the collectives whose outputs nothing in the function consumed
+        for (auto& request : ctx->distributed_requests)
+        {
+            if (request)
+            {
+                request->wait();
+                request.reset();
+            }
+        }
         ctx->first_iteration = false;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -43,8 +43,11 @@
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_reorder.hpp"
+#include "ngraph/runtime/cpu/cpu_op_sampler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
+#include "ngraph/runtime/memory_report.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/state/state.hpp"
 #include "ngraph/util.hpp"
@@ -154,10 +157,27 @@ namespace ngraph
                     return m_states.size() - 1;
                 }
 
+                /// \brief Reserve a slot in the cpu_runtime_context's distributed_requests for
+                ///        the asynchronous collective of node. Consumers of node's outputs wait
+                ///        on the slot before they run.
+                size_t add_distributed_request(const Node* node)
+                {
+                    size_t slot = m_distributed_request_slots.size();
+                    m_distributed_request_slots[node] = slot;
+                    return slot;
+                }
+                size_t get_distributed_request_count() const
+                {
+                    return m_distributed_request_slots.size();
+                }
+
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
                 static constexpr size_t s_memory_pool_alignment = 4096;
+                // One in this many calls is timed per op unless NGRAPH_CPU_PERF_SAMPLE_PERIOD
+                // says otherwise
+                static constexpr int32_t s_default_perf_sample_period = 1024;
 
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
                 // return an index into the cpu_runtime_context's buffer_data vector to get the
@@ -180,6 +200,42 @@ namespace ngraph
                                    const std::string& filename);
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
+                /// \brief Sampled per-op counters, or nullptr when sampling is disabled or the
+                ///        function was not built for direct execution
+                OpSampler* get_op_sampler() const { return m_op_sampler.get(); }
+
+                /// \brief Bytes of constant data used by the compiled function. Constants that
+                ///        share their storage are counted once.
+                size_t get_constant_bytes() const { return m_constant_bytes; }
+                /// \brief Bytes of constant data of the source function that the compiled
+                ///        function no longer uses, because the backend replaced the Constants by
+                ///        its own (reordered, folded or aliased) copies. The storage is freed
+                ///        once no one else holds the source Constants.
+                size_t get_released_constant_bytes() const { return m_released_constant_bytes; }
+                /// \brief Constant and intermediate bytes of each op, recorded at compile time
+                const MemoryReport& get_op_memory_report() const { return m_op_memory_report; }
+                /// \brief Layout conversions that remain after all layout passes ran
+                const std::vector<LayoutReorder>& get_layout_reorders() const
+                {
+                    return m_layout_reorders;
+                }
+                /// \brief Scratchpads and workspaces of DNNL primitives that were placed in the
+                ///        intermediate memory pool, as (primitive index, pool offset) pairs
+                const std::vector<std::pair<size_t, size_t>>& get_dnnl_scratchpad_offsets() const
+                {
+                    return m_dnnl_scratchpad_offsets;
+                }
+                const std::vector<std::pair<size_t, size_t>>& get_dnnl_workspace_offsets() const
+                {
+                    return m_dnnl_workspace_offsets;
+                }
+                /// \brief Size of the separate scratchpad buffer each context needs for
+                ///        primitives whose scratchpad is not in the memory pool
+                size_t get_dnnl_scratchpad_buffer_size() const;
+                /// \brief Bytes each context saves by keeping scratchpads and workspaces in the
+                ///        memory pool instead of separate buffers
+                size_t get_saved_scratchpad_bytes() const { return m_saved_scratchpad_bytes; }
+                size_t get_saved_workspace_bytes() const { return m_saved_workspace_bytes; }
 
             protected:
                 void build(ngraph::pass::PassConfig& pass_config);
@@ -203,6 +259,21 @@ namespace ngraph
 
                 bool computes_result(Node* node);
                 void release_function() { m_function = nullptr; }
+                void record_op_memory();
+                void record_layout_reorders();
+
+                // DNNL scratchpad and workspace bytes an op needs while it runs, and the range of
+                // primitives its builder reserved
+                struct OpTemporaries
+                {
+                    const Node* node;
+                    size_t first_primitive;
+                    size_t end_primitive;
+                    size_t workspace_size;
+                    size_t scratchpad_size;
+                };
+                void plan_dnnl_temporaries(const std::vector<OpTemporaries>& op_temporaries,
+                                           bool reuse_memory);
 #if defined(CODEGEN_ENABLE)
                 void emit_debug_function_entry(CodeWriter& writer,
                                                Node* node,
@@ -229,11 +300,6 @@ namespace ngraph
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
 
                 std::map<std::string, size_t> m_name_index_map;
-
-                // Because we are directly accessing the constant data stored in the
-                // Constant ops we need to keep a list of shared_ptr to each Constant
-                // so they don't get freed before we are done with them
-                NodeVector m_active_constants;
 #endif
                 static bool is_codegen(const ngraph::pass::PassConfig& pc);
                 std::unordered_set<descriptor::Tensor*>&
@@ -242,6 +308,20 @@ namespace ngraph
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_emit_timing;
 
+                // Because we are directly accessing the constant data stored in the
+                // Constant ops we need to keep a list of shared_ptr to each Constant
+                // so they don't get freed before we are done with them
+                NodeVector m_active_constants;
+                size_t m_constant_bytes = 0;
+                size_t m_released_constant_bytes = 0;
+                MemoryReport m_op_memory_report;
+                std::vector<LayoutReorder> m_layout_reorders;
+                std::vector<std::pair<size_t, size_t>> m_dnnl_scratchpad_offsets;
+                std::vector<std::pair<size_t, size_t>> m_dnnl_workspace_offsets;
+                size_t m_saved_scratchpad_bytes = 0;
+                size_t m_shared_scratchpad_size = 0;
+                size_t m_saved_workspace_bytes = 0;
+
 #if defined(NGRAPH_TBB_ENABLE)
                 bool m_use_tbb;
 #endif
@@ -276,6 +356,8 @@ namespace ngraph
 
                 std::vector<CPUKernelFunctor> functors;
                 std::vector<std::string> op_names;
+                // JSON args with the tensor sizes of each op, for its execution trace events
+                std::vector<std::string> m_op_trace_args;
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
                     enable_nodename_list;
@@ -320,6 +402,9 @@ namespace ngraph
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                std::unique_ptr<OpSampler> m_op_sampler;
+                // Nodes whose collective completes asynchronously and their request slot
+                std::unordered_map<const Node*, size_t> m_distributed_request_slots;
 
                 /// Map each node with dnnl implementation to its dnnl primitive creating
                 /// string, deps, dnnl primitive index, and dnnl scratchpad size.
@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void runtime::cpu::record_kernel_use(const element::Type& type, size_t rank)
+{
+    static const string path = getenv_string("NGRAPH_CPU_KERNEL_PROFILE");
+    if (path.empty())
+    {
+        return;
+    }
+
+    static mutex recorded_mutex;
+    static set<pair<string, size_t>> recorded;
+    lock_guard<mutex> lock(recorded_mutex);
+    if (!recorded.insert(make_pair(type.get_type_name(), rank)).second)
+    {
+        return;
+    }
+
+    ofstream out(path, ios::app);
+    if (!out)
+    {
+        NGRAPH_WARN << "Unable to write kernel profile " << path;
+        return;
+    }
+    out << type.get_type_name() << " " << rank << "\n";
+}
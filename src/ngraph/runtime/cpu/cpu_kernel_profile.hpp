@@ -0,0 +1,40 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Records that a builder asked for a kernel specialized on (type, rank).
+            ///
+            /// When NGRAPH_CPU_KERNEL_PROFILE names a file, each distinct pair is appended to it
+            /// as "<type> <rank>". Configuring the build with
+            /// -DNGRAPH_CPU_KERNEL_PROFILE=<file> then specializes kernels for every combination
+            /// of a recorded type with a recorded rank, which covers the recorded pairs but may
+            /// include others. Everything else takes the reference or rank-generic path.
+            CPU_BACKEND_API void record_kernel_use(const element::Type& type, size_t rank);
+        }
+    }
+}
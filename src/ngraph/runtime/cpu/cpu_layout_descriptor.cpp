@@ -20,6 +20,7 @@
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/type/packed.hpp"
 
 #define UNDEF undef
 #define F32 data_type::f32
@@ -49,7 +50,8 @@ namespace ngraph
                     s *= shape[shape.size() - (i + 1)];
                 }
                 std::reverse(m_strides.begin(), m_strides.end());
-                m_buffer_size = shape_size(tv.get_shape()) * tv.get_element_type().size();
+                m_buffer_size =
+                    packed::byte_size(tv.get_element_type(), shape_size(tv.get_shape()));
             }
 
             size_t LayoutDescriptor::get_index_offset(const std::vector<size_t>& indices)
@@ -0,0 +1,40 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief A layout conversion (DNNL reorder) left in a compiled function
+            struct LayoutReorder
+            {
+                /// \brief Name of the ConvertLayout op
+                std::string name;
+                /// \brief Name of the op whose output is converted
+                std::string producer;
+                /// \brief Bytes read plus bytes written by one execution of the reorder
+                size_t bytes;
+            };
+        }
+    }
+}
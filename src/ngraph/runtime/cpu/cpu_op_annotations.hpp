@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "ngraph/op/util/op_annotations.hpp"
 
@@ -27,6 +28,37 @@ namespace ngraph
     {
         namespace cpu
         {
+            /// \brief Elementwise epilogue that a DNNL primitive applies to its output. Alpha and
+            /// beta carry the algorithm parameters using DNNL's eltwise conventions.
+            struct PostOp
+            {
+                enum class Algorithm
+                {
+                    Relu,
+                    BoundedRelu,
+                    Logistic,
+                    Tanh,
+                    Exp,
+                    Abs,
+                    Sqrt,
+                    Log,
+                    Gelu,
+                    Swish,
+                    Linear
+                };
+
+                Algorithm algorithm;
+                float alpha;
+                float beta;
+
+                bool operator==(const PostOp& other) const
+                {
+                    return algorithm == other.algorithm && alpha == other.alpha &&
+                           beta == other.beta;
+                }
+                bool operator!=(const PostOp& other) const { return !(*this == other); }
+            };
+
             /// \brief Annotations added to graph ops by CPU backend passes
             class CPUOpAnnotations : public ngraph::op::util::OpAnnotations
             {
@@ -34,9 +66,13 @@ namespace ngraph
                 CPUOpAnnotations() {}
                 bool is_dnnl_op() { return m_dnnl_op; }
                 void set_dnnl_op(bool val) { m_dnnl_op = val; }
+                /// \brief Post-ops appended, in order, after the op's own fused epilogue
+                const std::vector<PostOp>& get_post_ops() const { return m_post_ops; }
+                void add_post_op(const PostOp& post_op) { m_post_ops.push_back(post_op); }
 
             private:
                 bool m_dnnl_op = false;
+                std::vector<PostOp> m_post_ops;
             };
 
             std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)>
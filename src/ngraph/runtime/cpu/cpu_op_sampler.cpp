@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <thread>
+
+#include "ngraph/runtime/cpu/cpu_op_sampler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::cpu::OpSampler::num_buckets;
+
+runtime::cpu::OpSampler::OpSampler(const vector<shared_ptr<const Node>>& nodes, uint64_t period)
+    : m_nodes(nodes)
+    , m_counters(new Counters[nodes.size()])
+    , m_period(period)
+    , m_start_ticks(now())
+    , m_start_time(chrono::steady_clock::now())
+{
+    reset();
+}
+
+void runtime::cpu::OpSampler::record(size_t op_index, uint64_t ticks)
+{
+    Counters& counters = m_counters[op_index];
+    size_t bucket = 0;
+    for (uint64_t t = ticks; t > 1 && bucket < num_buckets - 1; t >>= 1)
+    {
+        bucket++;
+    }
+    counters.samples.fetch_add(1, memory_order_relaxed);
+    counters.ticks.fetch_add(ticks, memory_order_relaxed);
+    counters.buckets[bucket].fetch_add(1, memory_order_relaxed);
+}
+
+double runtime::cpu::OpSampler::get_microseconds_per_tick() const
+{
+    // Calibrate the time stamp counter against the steady clock over the sampler's lifetime.
+    // A very short lifetime gives a noisy ratio, so wait for at least a millisecond.
+    auto min_interval = chrono::milliseconds(1);
+    auto elapsed = chrono::steady_clock::now() - m_start_time;
+    if (elapsed < min_interval)
+    {
+        this_thread::sleep_for(min_interval - elapsed);
+    }
+    uint64_t ticks = now() - m_start_ticks;
+    double microseconds =
+        chrono::duration<double, micro>(chrono::steady_clock::now() - m_start_time).count();
+    return ticks == 0 ? 0 : microseconds / ticks;
+}
+
+vector<runtime::cpu::SampledOpLatency> runtime::cpu::OpSampler::snapshot() const
+{
+    double us_per_tick = get_microseconds_per_tick();
+    vector<SampledOpLatency> rc;
+    for (size_t i = 0; i < m_nodes.size(); i++)
+    {
+        const Counters& counters = m_counters[i];
+        uint64_t samples = counters.samples.load(memory_order_relaxed);
+        if (samples == 0)
+        {
+            continue;
+        }
+        SampledOpLatency latency;
+        latency.node = m_nodes[i];
+        latency.samples = samples;
+        latency.total_microseconds = counters.ticks.load(memory_order_relaxed) * us_per_tick;
+        size_t first = num_buckets;
+        size_t last = 0;
+        for (size_t b = 0; b < num_buckets; b++)
+        {
+            if (counters.buckets[b].load(memory_order_relaxed) != 0)
+            {
+                first = min(first, b);
+                last = b;
+            }
+        }
+        for (size_t b = first; b <= last; b++)
+        {
+            // Bucket b holds tick counts in [2^b, 2^(b+1))
+            latency.histogram.push_back({static_cast<double>(uint64_t(1) << (b + 1)) * us_per_tick,
+                                         counters.buckets[b].load(memory_order_relaxed)});
+        }
+        rc.push_back(latency);
+    }
+    return rc;
+}
+
+void runtime::cpu::OpSampler::reset()
+{
+    for (size_t i = 0; i < m_nodes.size(); i++)
+    {
+        Counters& counters = m_counters[i];
+        counters.samples.store(0, memory_order_relaxed);
+        counters.ticks.store(0, memory_order_relaxed);
+        for (size_t b = 0; b < num_buckets; b++)
+        {
+            counters.buckets[b].store(0, memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__amd64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Latency of one op accumulated over the sampled calls of an executable
+            struct SampledOpLatency
+            {
+                std::shared_ptr<const Node> node;
+                uint64_t samples;
+                double total_microseconds;
+                /// (upper bound in microseconds, count) for each power-of-two bucket of
+                /// time stamp counter ticks, from the shortest to the longest bucket used
+                std::vector<std::pair<double, uint64_t>> histogram;
+
+                double mean_microseconds() const
+                {
+                    return samples == 0 ? 0 : total_microseconds / samples;
+                }
+            };
+
+            /// \brief Per-op counters that time one in every N calls of an executable.
+            ///
+            /// Sampled calls read the time stamp counter around each op and update relaxed
+            /// atomics, so all runtime contexts of an executable record into the same counters
+            /// without locking. Calls that are not sampled pay for one atomic increment.
+            /// NGRAPH_CPU_PERF_SAMPLE_PERIOD sets N; 0 disables sampling.
+            class CPU_BACKEND_API OpSampler
+            {
+            public:
+                static constexpr size_t num_buckets = 48;
+
+                OpSampler(const std::vector<std::shared_ptr<const Node>>& nodes,
+                          uint64_t period);
+
+                /// \brief Returns true when the call that is starting should be timed
+                bool begin_call()
+                {
+                    return m_period != 0 &&
+                           m_calls.fetch_add(1, std::memory_order_relaxed) % m_period == 0;
+                }
+
+                static uint64_t now()
+                {
+#if defined(__x86_64__) || defined(__amd64__) || defined(__i386__)
+                    return __rdtsc();
+#else
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                        .count();
+#endif
+                }
+
+                void record(size_t op_index, uint64_t ticks);
+
+                /// \brief Counters of every op that was sampled at least once. The counters
+                ///        keep accumulating; concurrent calls may land partly in a snapshot.
+                std::vector<SampledOpLatency> snapshot() const;
+                void reset();
+
+                uint64_t get_period() const { return m_period; }
+            private:
+                struct Counters
+                {
+                    std::atomic<uint64_t> samples{0};
+                    std::atomic<uint64_t> ticks{0};
+                    std::atomic<uint64_t> buckets[num_buckets];
+                };
+
+                double get_microseconds_per_tick() const;
+
+                std::vector<std::shared_ptr<const Node>> m_nodes;
+                std::unique_ptr<Counters[]> m_counters;
+                uint64_t m_period;
+                std::atomic<uint64_t> m_calls{0};
+                uint64_t m_start_ticks;
+                std::chrono::steady_clock::time_point m_start_time;
+            };
+        }
+    }
+}
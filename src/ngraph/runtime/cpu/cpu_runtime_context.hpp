@@ -18,7 +18,9 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <set>
+#include <vector>
 
 #if defined(NGRAPH_TBB_ENABLE)
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
@@ -48,6 +50,7 @@ namespace ngraph
     {
         class AlignedBuffer;
     }
+    class DistributedRequest;
     class State;
 }
 
@@ -67,6 +70,8 @@ namespace ngraph
                 int64_t* op_durations;
                 bool* p_en;
                 bool first_iteration;
+                // set when the current call is timed by the executable's OpSampler
+                bool sample_ops;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
                 std::vector<dnnl::memory*> dnnl_memories;
@@ -75,11 +80,17 @@ namespace ngraph
                 std::vector<dnnl::memory::desc*> dnnl_scratchpad_mds;
                 AlignedBuffer* scratchpad_buffer;
                 std::vector<char*> dnnl_workspaces;
+                // Per-primitive scratchpad and workspace memory placed in memory_buffers[0], or
+                // nullptr where scratchpad_buffer and dnnl_workspaces are used instead
+                std::vector<char*> dnnl_scratchpad_ptrs;
+                std::vector<char*> dnnl_workspace_ptrs;
 #if defined(NGRAPH_TBB_ENABLE)
                 tbb::flow::graph* G;
                 tbb::global_control* c;
 #endif
                 State* const* states;
+                // Collectives in flight, indexed by the slot of the node that started them
+                std::vector<std::shared_ptr<DistributedRequest>> distributed_requests;
                 std::set<size_t> breakpoints;
                 size_t pc;
 #ifdef NGRAPH_CPU_MLIR_ENABLE
@@ -25,6 +25,7 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 
 using namespace dnnl;
@@ -47,7 +48,7 @@ runtime::cpu::CPUTensor::CPUTensor(const ngraph::element::Type& element_type,
     m_descriptor->set_tensor_layout(
         std::make_shared<runtime::cpu::LayoutDescriptor>(*m_descriptor));
 
-    buffer_size = shape_size(shape) * element_type.size();
+    buffer_size = packed::byte_size(element_type, shape_size(shape));
 
     if (memory_pointer != nullptr)
     {
@@ -104,6 +104,7 @@ size_t DNNLEmitter::insert_memory(dnnl::memory* memory)
 size_t DNNLEmitter::insert_workspace(std::unique_ptr<DNNLWorkspace>& workspace)
 {
     m_workspace_bufs.push_back(workspace.get()->buf);
+    m_workspace_bytes += workspace->size;
     m_workspaces.push_back(std::move(workspace));
     return (m_workspaces.size() - 1);
 }
@@ -134,6 +135,7 @@ size_t DNNLEmitter::insert_workspace(std::vector<char*>& dnnl_workspaces,
                                      std::unique_ptr<DNNLWorkspace>& workspace)
 {
     dnnl_workspaces.push_back(workspace.get()->buf);
+    m_workspace_bytes += workspace->size;
     m_workspaces.push_back(std::move(workspace));
     return (dnnl_workspaces.size() - 1);
 }
@@ -153,6 +155,39 @@ size_t DNNLEmitter::get_max_scratchpad_size() const
     return m_max_scratchpad_size;
 }
 
+void DNNLEmitter::record_scratchpad_size(size_t size)
+{
+    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    m_op_scratchpad_size = size > m_op_scratchpad_size ? size : m_op_scratchpad_size;
+    if (!m_in_op_temporaries)
+    {
+        m_unscoped_scratchpad_size =
+            size > m_unscoped_scratchpad_size ? size : m_unscoped_scratchpad_size;
+    }
+}
+
+void DNNLEmitter::begin_op_temporaries()
+{
+    m_op_scratchpad_size = 0;
+    m_op_workspace_size = 0;
+    m_in_op_temporaries = true;
+}
+
+void DNNLEmitter::end_op_temporaries()
+{
+    m_in_op_temporaries = false;
+}
+
+void DNNLEmitter::set_workspace_planned(size_t primitive_index)
+{
+    m_planned_workspaces.insert(primitive_index);
+}
+
+bool DNNLEmitter::is_workspace_planned(size_t primitive_index) const
+{
+    return m_planned_workspaces.count(primitive_index) != 0;
+}
+
 dnnl::memory::desc DNNLEmitter::build_blocked_memory_descriptor(const dnnl::memory::dims& dim,
                                                                 const dnnl::memory::dims& strides,
                                                                 dnnl::memory::data_type dtype) const
@@ -784,10 +819,10 @@ void DNNLEmitter::build_max_pooling_backward(std::vector<dnnl::memory*>& dnnl_me
     build_memory(dnnl_memories, pool_fwd_pd.workspace_desc(), ws_index);
     bdeps[1] = ws_index;
 
-    // Allocate workspace
+    // Allocate workspace unless it has been placed in the memory pool
     // TODO (jbobba): Might need to align memory
-    auto ws =
-        std::unique_ptr<DNNLWorkspace>(new DNNLWorkspace(pool_fwd_pd.workspace_desc().get_size()));
+    auto ws = std::unique_ptr<DNNLWorkspace>(new DNNLWorkspace(
+        is_workspace_planned(fwd_pool_index) ? 0 : pool_fwd_pd.workspace_desc().get_size()));
     auto ws_buf_index = insert_workspace(dnnl_workspaces, ws);
     fdeps[3] = ws_buf_index;
     bdeps[3] = ws_buf_index;
@@ -1135,8 +1170,8 @@ void DNNLEmitter::build_vanilla_rnn_forward(std::vector<dnnl::memory*>& dnnl_mem
     dnnl_scratchpad_mds[rnn_index] = new dnnl::memory::desc(rnn_layer_prim_desc.scratchpad_desc());
     size_t workspace_index = deps[7];
     build_memory(dnnl_memories, rnn_layer_prim_desc.workspace_desc(), workspace_index);
-    auto workspace = std::unique_ptr<DNNLWorkspace>(
-        new DNNLWorkspace(rnn_layer_prim_desc.workspace_desc().get_size()));
+    auto workspace = std::unique_ptr<DNNLWorkspace>(new DNNLWorkspace(
+        is_workspace_planned(rnn_index) ? 0 : rnn_layer_prim_desc.workspace_desc().get_size()));
     auto workspace_buf_index = insert_workspace(dnnl_workspaces, workspace);
     deps[8] = workspace_buf_index;
 
@@ -1169,6 +1204,14 @@ void DNNLEmitter::build_rnn_forward(std::vector<dnnl::memory*>& dnnl_memories,
     build_memory(dnnl_memories, rnn_desc.data.dst_iter_desc, dst_iter_index);
     size_t dst_iter_c_index = deps[8];
     build_memory(dnnl_memories, rnn_desc.data.dst_iter_c_desc, dst_iter_c_index);
+    // peephole LSTMs carry the peephole weights after the workspace
+    size_t workspace_buf_slot = 10;
+    if (rnn_desc.data.weights_peephole_desc.ndims != 0)
+    {
+        size_t weights_peephole_index = deps[10];
+        build_memory(dnnl_memories, rnn_desc.data.weights_peephole_desc, weights_peephole_index);
+        workspace_buf_slot = 11;
+    }
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
@@ -1178,14 +1221,71 @@ void DNNLEmitter::build_rnn_forward(std::vector<dnnl::memory*>& dnnl_memories,
 
     size_t workspace_index = deps[9];
     build_memory(dnnl_memories, rnn_layer_prim_desc.workspace_desc(), workspace_index);
-    auto workspace = std::unique_ptr<DNNLWorkspace>(
-        new DNNLWorkspace(rnn_layer_prim_desc.workspace_desc().get_size()));
+    auto workspace = std::unique_ptr<DNNLWorkspace>(new DNNLWorkspace(
+        is_workspace_planned(rnn_index) ? 0 : rnn_layer_prim_desc.workspace_desc().get_size()));
     auto workspace_buf_index = insert_workspace(dnnl_workspaces, workspace);
-    deps[10] = workspace_buf_index;
+    deps[workspace_buf_slot] = workspace_buf_index;
 
     dnnl_primitives[rnn_index] = new dnnl::lstm_forward(rnn_layer_prim_desc);
 }
 
+template <typename RNN_PRIM>
+void DNNLEmitter::build_gru_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                    std::vector<dnnl::primitive*>& dnnl_primitives,
+                                    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                    std::vector<char*>& dnnl_workspaces,
+                                    const typename RNN_PRIM::desc& rnn_desc,
+                                    std::vector<size_t>& deps,
+                                    size_t rnn_index)
+{
+    size_t src_layer_index = deps[0];
+    build_memory(dnnl_memories, rnn_desc.data.src_layer_desc, src_layer_index);
+    size_t src_iter_index = deps[1];
+    build_memory(dnnl_memories, rnn_desc.data.src_iter_desc, src_iter_index);
+    size_t weights_layer_index = deps[2];
+    build_memory(dnnl_memories, rnn_desc.data.weights_layer_desc, weights_layer_index);
+    size_t weights_iter_index = deps[3];
+    build_memory(dnnl_memories, rnn_desc.data.weights_iter_desc, weights_iter_index);
+    size_t bias_index = deps[4];
+    build_memory(dnnl_memories, rnn_desc.data.bias_desc, bias_index);
+    size_t dst_layer_index = deps[5];
+    build_memory(dnnl_memories, rnn_desc.data.dst_layer_desc, dst_layer_index);
+    size_t dst_iter_index = deps[6];
+    build_memory(dnnl_memories, rnn_desc.data.dst_iter_desc, dst_iter_index);
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    auto rnn_layer_prim_desc =
+        typename RNN_PRIM::primitive_desc(rnn_desc, attr, executor::global_cpu_engine);
+    dnnl_scratchpad_mds[rnn_index] = new dnnl::memory::desc(rnn_layer_prim_desc.scratchpad_desc());
+    size_t workspace_index = deps[7];
+    build_memory(dnnl_memories, rnn_layer_prim_desc.workspace_desc(), workspace_index);
+    auto workspace = std::unique_ptr<DNNLWorkspace>(new DNNLWorkspace(
+        is_workspace_planned(rnn_index) ? 0 : rnn_layer_prim_desc.workspace_desc().get_size()));
+    auto workspace_buf_index = insert_workspace(dnnl_workspaces, workspace);
+    deps[8] = workspace_buf_index;
+
+    dnnl_primitives[rnn_index] = new RNN_PRIM(rnn_layer_prim_desc);
+}
+
+template void DNNLEmitter::build_gru_forward<dnnl::gru_forward>(
+    std::vector<dnnl::memory*>& dnnl_memories,
+    std::vector<dnnl::primitive*>& dnnl_primitives,
+    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+    std::vector<char*>& dnnl_workspaces,
+    const dnnl::gru_forward::desc& rnn_desc,
+    std::vector<size_t>& deps,
+    size_t rnn_index);
+template void DNNLEmitter::build_gru_forward<dnnl::lbr_gru_forward>(
+    std::vector<dnnl::memory*>& dnnl_memories,
+    std::vector<dnnl::primitive*>& dnnl_primitives,
+    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+    std::vector<char*>& dnnl_workspaces,
+    const dnnl::lbr_gru_forward::desc& rnn_desc,
+    std::vector<size_t>& deps,
+    size_t rnn_index);
+
 void DNNLEmitter::build_concat(std::vector<dnnl::memory*>& dnnl_memories,
                                std::vector<dnnl::primitive*>& dnnl_primitives,
                                std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -1353,7 +1453,7 @@ size_t DNNLEmitter::query_scratchpad_sum(const dnnl::sum::primitive_desc pd)
 {
     dnnl::memory::desc scratchpad_md = pd.scratchpad_desc();
     auto size = scratchpad_md.get_size();
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    record_scratchpad_size(size);
     return size;
 }
 
@@ -1361,7 +1461,7 @@ size_t DNNLEmitter::query_scratchpad_concat(const dnnl::concat::primitive_desc p
 {
     dnnl::memory::desc scratchpad_md = pd.scratchpad_desc();
     auto size = scratchpad_md.get_size();
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    record_scratchpad_size(size);
     return size;
 }
 
@@ -1394,10 +1494,11 @@ size_t
         dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
     dnnl::memory::desc scratchpad_md = pd.scratchpad_desc();
     size_t size = scratchpad_md.get_size();
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    record_scratchpad_size(size);
     dnnl::memory::desc fwd_scratchpad_md = fwd_pd.scratchpad_desc();
     size_t f_size = fwd_scratchpad_md.get_size();
-    m_max_scratchpad_size = f_size > m_max_scratchpad_size ? f_size : m_max_scratchpad_size;
+    record_scratchpad_size(f_size);
+    m_op_workspace_size += fwd_pd.workspace_desc().get_size();
     return size > f_size ? size : f_size;
 }
 
@@ -1515,6 +1616,7 @@ size_t DNNLEmitter::query_scratchpad_rnn_forward(const dnnl::lstm_forward::desc&
 {
     ATTR_S
     auto pd = dnnl::lstm_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    m_op_workspace_size += pd.workspace_desc().get_size();
     GET_SIZE
 }
 
@@ -1523,9 +1625,24 @@ size_t
 {
     ATTR_S
     auto pd = dnnl::vanilla_rnn_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    m_op_workspace_size += pd.workspace_desc().get_size();
+    GET_SIZE
+}
+
+template <typename RNN_PRIM>
+size_t DNNLEmitter::query_scratchpad_gru_forward(const typename RNN_PRIM::desc& desc)
+{
+    ATTR_S
+    auto pd = typename RNN_PRIM::primitive_desc(desc, attr, executor::global_cpu_engine);
+    m_op_workspace_size += pd.workspace_desc().get_size();
     GET_SIZE
 }
 
+template size_t DNNLEmitter::query_scratchpad_gru_forward<dnnl::gru_forward>(
+    const dnnl::gru_forward::desc& desc);
+template size_t DNNLEmitter::query_scratchpad_gru_forward<dnnl::lbr_gru_forward>(
+    const dnnl::lbr_gru_forward::desc& desc);
+
 size_t DNNLEmitter::query_scratchpad_lrn_forward(const dnnl::lrn_forward::desc& desc)
 {
     ATTR_S
@@ -20,13 +20,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <dnnl.hpp>
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/coordinate_diff.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/avg_pool.hpp"
@@ -49,6 +52,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -116,9 +120,14 @@ namespace ngraph
             class DNNLWorkspace
             {
             public:
-                DNNLWorkspace(size_t size) { buf = reinterpret_cast<char*>(ngraph_malloc(size)); }
+                DNNLWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(ngraph_malloc(size));
+                }
                 ~DNNLWorkspace() { ngraph_free(buf); }
                 char* buf;
+                size_t size;
 
                 DNNLWorkspace(const DNNLWorkspace&) = delete;
                 DNNLWorkspace(DNNLWorkspace&&) = delete;
@@ -156,6 +165,25 @@ namespace ngraph
                 std::vector<size_t>& get_primitive_deps(size_t index);
                 size_t get_max_scratchpad_size() const;
 
+                /// \brief Starts collecting the scratchpad and workspace bytes queried while
+                ///        building one op, so the op's temporaries can be placed in the memory
+                ///        pool alongside its intermediate tensors.
+                void begin_op_temporaries();
+                void end_op_temporaries();
+                /// \brief Largest scratchpad queried since begin_op_temporaries()
+                size_t get_op_scratchpad_size() const { return m_op_scratchpad_size; }
+                /// \brief Workspace bytes queried since begin_op_temporaries()
+                size_t get_op_workspace_size() const { return m_op_workspace_size; }
+                /// \brief Largest scratchpad queried while no op was being built. Such a
+                ///        scratchpad cannot be planned and needs the shared scratchpad buffer.
+                size_t get_unscoped_scratchpad_size() const { return m_unscoped_scratchpad_size; }
+                /// \brief The workspace of this primitive lives in the memory pool, so building
+                ///        the primitive does not allocate one.
+                void set_workspace_planned(size_t primitive_index);
+                bool is_workspace_planned(size_t primitive_index) const;
+                /// \brief Bytes of all the workspaces inserted so far, from every context
+                size_t get_workspace_bytes() const { return m_workspace_bytes; }
+
                 size_t build_quantized_inner_product_forward(
                     const dnnl::memory::desc& input_data_desc,
                     const dnnl::memory::desc& weights_desc,
@@ -693,13 +721,17 @@ namespace ngraph
                         ops.append_eltwise(
                             ops_scale, dnnl::algorithm::eltwise_relu, ops_alpha, ops_beta);
                     }
+                    dnnl_utils::append_annotated_post_ops(node, ops);
 
                     dnnl::primitive_attr attr;
                     attr.set_post_ops(ops);
                     if (is_quantized_conv<OP>())
                     {
                         SET_ROUND_MODE
-                        attr.set_output_scales(0, get_output_scale<OP, float>(node));
+                        auto output_scales = get_output_scale<OP, float>(node);
+                        // Per output channel scales (dim 1, mask=2^1)
+                        const int mask = output_scales.size() == 1 ? 0 : 2;
+                        attr.set_output_scales(mask, output_scales);
                     }
                     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
                     return attr;
@@ -748,13 +780,17 @@ namespace ngraph
                         ops.append_eltwise(
                             ops_scale, dnnl::algorithm::eltwise_relu, ops_alpha, ops_beta);
                     }
+                    dnnl_utils::append_annotated_post_ops(node, ops);
 
                     dnnl::primitive_attr attr;
                     attr.set_post_ops(ops);
                     if (is_quantized_inner_product<OP>())
                     {
                         SET_ROUND_MODE
-                        attr.set_output_scales(0, get_output_scale<OP, float>(node));
+                        auto output_scales = get_output_scale<OP, float>(node);
+                        // Per output channel scales (dim 1, mask=2^1)
+                        const int mask = output_scales.size() == 1 ? 0 : 2;
+                        attr.set_output_scales(mask, output_scales);
                     }
                     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
                     return attr;
@@ -1300,6 +1336,28 @@ namespace ngraph
                     auto dst_iter_c_desc = build_memory_descriptor(
                         dst_iter_c_tz, out[2].get_element_type(), dnnl::memory::FORMAT::ldnc);
 
+                    if (args.size() == 7)
+                    {
+                        // peephole weights are stored in the (i, f, o) gate order
+                        Shape wei_peephole_tz{num_fused_layers, direction, 3, feature_size};
+                        auto weights_peephole_desc =
+                            build_memory_descriptor(wei_peephole_tz,
+                                                    args[6].get_element_type(),
+                                                    dnnl::memory::FORMAT::ldgo);
+                        return dnnl::lstm_forward::desc(dnnl::prop_kind::forward_training,
+                                                        get_dnnl_rnn_direction(),
+                                                        src_layer_desc,
+                                                        src_iter_desc,
+                                                        src_iter_c_desc,
+                                                        weights_layer_desc,
+                                                        weights_iter_desc,
+                                                        weights_peephole_desc,
+                                                        bias_desc,
+                                                        dst_layer_desc,
+                                                        dst_iter_desc,
+                                                        dst_iter_c_desc);
+                    }
+
                     return dnnl::lstm_forward::desc(dnnl::prop_kind::forward_training,
                                                     get_dnnl_rnn_direction(),
                                                     src_layer_desc,
@@ -1400,6 +1458,82 @@ namespace ngraph
                                                            dst_layer_desc,
                                                            dst_iter_desc);
                 }
+
+                // RNN_PRIM is dnnl::gru_forward or dnnl::lbr_gru_forward; both take the same
+                // arguments, the latter with an extra bias gate.
+                template <typename OP, typename RNN_PRIM>
+                typename RNN_PRIM::desc get_gru_forward_desc(const ngraph::Node* node,
+                                                             const std::vector<TensorWrapper>& args,
+                                                             const std::vector<TensorWrapper>& out)
+                {
+                    auto rnn_node = static_cast<const OP*>(node);
+                    auto src_sequence_length_max =
+                        static_cast<unsigned long>(rnn_node->get_src_sequence_length());
+                    auto direction = static_cast<unsigned long>(rnn_node->get_direction());
+                    auto num_fused_layers =
+                        static_cast<unsigned long>(rnn_node->get_num_fused_layers());
+                    auto feature_size =
+                        static_cast<unsigned long>(rnn_node->get_src_iter_feature_size());
+                    auto batch = static_cast<unsigned long>(rnn_node->get_batch_size());
+                    auto rnn_cell_n_gates =
+                        static_cast<unsigned long>(rnn_node->get_gates_per_cell());
+                    auto bias_n_gates =
+                        rnn_node->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru)
+                            ? rnn_cell_n_gates + 1
+                            : rnn_cell_n_gates;
+
+                    auto get_dnnl_rnn_direction = [&]() {
+                        switch (direction)
+                        {
+                        case 1: return dnnl::rnn_direction::unidirectional_left2right;
+                        case 2: return dnnl::rnn_direction::bidirectional_concat;
+                        default: throw ngraph_error("unsupported dnnl rnn direction");
+                        }
+                    };
+
+                    Shape src_layer_tz{
+                        src_sequence_length_max,
+                        batch,
+                        static_cast<unsigned long>(rnn_node->get_src_layer_feature_size())};
+                    Shape src_iter_tz{num_fused_layers, direction, batch, feature_size};
+                    Shape wei_layer_tz{
+                        num_fused_layers,
+                        direction,
+                        static_cast<unsigned long>(rnn_node->get_src_layer_feature_size()),
+                        rnn_cell_n_gates,
+                        feature_size};
+                    Shape wei_iter_tz{
+                        num_fused_layers, direction, feature_size, rnn_cell_n_gates, feature_size};
+                    Shape bias_tz{num_fused_layers, direction, bias_n_gates, feature_size};
+                    Shape dst_layer_tz{src_sequence_length_max, batch, direction * feature_size};
+                    Shape dst_iter_tz{num_fused_layers, direction, batch, feature_size};
+
+                    auto src_layer_desc = build_memory_descriptor(
+                        src_layer_tz, args[0].get_element_type(), dnnl::memory::FORMAT::tnc);
+                    auto src_iter_desc = build_memory_descriptor(
+                        src_iter_tz, args[1].get_element_type(), dnnl::memory::FORMAT::ldnc);
+                    auto weights_layer_desc = build_memory_descriptor(
+                        wei_layer_tz, args[2].get_element_type(), dnnl::memory::FORMAT::ldigo);
+                    auto weights_iter_desc = build_memory_descriptor(
+                        wei_iter_tz, args[3].get_element_type(), dnnl::memory::FORMAT::ldigo);
+                    auto bias_desc = build_memory_descriptor(
+                        bias_tz, args[4].get_element_type(), dnnl::memory::FORMAT::ldgo);
+                    auto dst_layer_desc = build_memory_descriptor(
+                        dst_layer_tz, out[0].get_element_type(), dnnl::memory::FORMAT::tnc);
+                    auto dst_iter_desc = build_memory_descriptor(
+                        dst_iter_tz, out[1].get_element_type(), dnnl::memory::FORMAT::ldnc);
+
+                    return typename RNN_PRIM::desc(dnnl::prop_kind::forward_training,
+                                                   get_dnnl_rnn_direction(),
+                                                   src_layer_desc,
+                                                   src_iter_desc,
+                                                   weights_layer_desc,
+                                                   weights_iter_desc,
+                                                   bias_desc,
+                                                   dst_layer_desc,
+                                                   dst_iter_desc);
+                }
+
                 void build_rnn_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                        std::vector<dnnl::primitive*>& dnnl_primitives,
                                        std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -1417,6 +1551,15 @@ namespace ngraph
                                               std::vector<size_t>& deps,
                                               size_t rnn_idx);
 
+                template <typename RNN_PRIM>
+                void build_gru_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                       std::vector<dnnl::primitive*>& dnnl_primitives,
+                                       std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                       std::vector<char*>& dnnl_workspaces,
+                                       const typename RNN_PRIM::desc& desc,
+                                       std::vector<size_t>& deps,
+                                       size_t rnn_idx);
+
                 template <bool with_bias>
                 void
                     build_convolution_forward(std::vector<dnnl::memory*>& dnnl_memories,
@@ -1449,12 +1592,26 @@ namespace ngraph
                     dnnl_memories[results_idx] =
                         new dnnl::memory(desc.data.dst_desc, engine, nullptr);
 
+                    auto& cache = DNNLPrimitiveCache::get();
+                    std::string key;
+                    bool cacheable = cache.make_key("convolution_forward", desc, attr, key);
+                    dnnl::primitive* prim;
+                    dnnl::memory::desc scratchpad_md;
+                    if (cacheable && cache.lookup(key, prim, scratchpad_md))
+                    {
+                        dnnl_scratchpad_mds[conv_idx] = new dnnl::memory::desc(scratchpad_md);
+                        dnnl_primitives[conv_idx] = prim;
+                        return;
+                    }
+
+                    event::Duration create_span("convolution_forward", "DNNL");
                     auto conv_pd = dnnl::convolution_forward::primitive_desc(desc, attr, engine);
                     dnnl_scratchpad_mds[conv_idx] =
                         new dnnl::memory::desc(conv_pd.scratchpad_desc());
 
-                    dnnl::primitive* prim = new dnnl::convolution_forward(conv_pd);
-                    dnnl_primitives[conv_idx] = prim;
+                    prim = new dnnl::convolution_forward(conv_pd);
+                    dnnl_primitives[conv_idx] =
+                        cacheable ? cache.insert(key, prim, conv_pd.scratchpad_desc()) : prim;
                 }
 
                 template <bool with_bias>
@@ -1489,11 +1646,25 @@ namespace ngraph
                     dnnl_memories[results_idx] =
                         new dnnl::memory(desc.data.dst_desc, engine, nullptr);
 
+                    auto& cache = DNNLPrimitiveCache::get();
+                    std::string key;
+                    bool cacheable = cache.make_key("inner_product_forward", desc, attr, key);
+                    dnnl::primitive* prim;
+                    dnnl::memory::desc scratchpad_md;
+                    if (cacheable && cache.lookup(key, prim, scratchpad_md))
+                    {
+                        dnnl_scratchpad_mds[ip_idx] = new dnnl::memory::desc(scratchpad_md);
+                        dnnl_primitives[ip_idx] = prim;
+                        return;
+                    }
+
+                    event::Duration create_span("inner_product_forward", "DNNL");
                     auto ip_pd = dnnl::inner_product_forward::primitive_desc(desc, attr, engine);
                     dnnl_scratchpad_mds[ip_idx] = new dnnl::memory::desc(ip_pd.scratchpad_desc());
 
-                    dnnl::primitive* prim = new dnnl::inner_product_forward(ip_pd);
-                    dnnl_primitives[ip_idx] = prim;
+                    prim = new dnnl::inner_product_forward(ip_pd);
+                    dnnl_primitives[ip_idx] =
+                        cacheable ? cache.insert(key, prim, ip_pd.scratchpad_desc()) : prim;
                 }
 
                 size_t query_scratchpad_sum(const dnnl::sum::primitive_desc);
@@ -1537,6 +1708,8 @@ namespace ngraph
                 size_t query_scratchpad_rnn_forward(const dnnl::lstm_forward::desc& desc);
                 size_t query_scratchpad_vanilla_rnn_forward(
                     const dnnl::vanilla_rnn_forward::desc& desc);
+                template <typename RNN_PRIM>
+                size_t query_scratchpad_gru_forward(const typename RNN_PRIM::desc& desc);
                 size_t query_scratchpad_slice(dnnl::memory::desc& input_desc,
                                               const dnnl::memory::desc& output_desc,
                                               const ngraph::Coordinate& lower_bounds,
@@ -1544,6 +1717,8 @@ namespace ngraph
                 size_t query_scratchpad_softmax_forward(const dnnl::softmax_forward::desc& desc);
 
             private:
+                void record_scratchpad_size(size_t size);
+
                 std::vector<dnnl::memory*> m_dnnl_memories;
                 std::vector<dnnl::primitive*> m_dnnl_primitives;
                 std::vector<dnnl::stream> m_dnnl_streams;
@@ -1554,6 +1729,12 @@ namespace ngraph
                 size_t m_workspaces_size = 0;
                 size_t m_dnnl_descriptors_size = 0;
                 size_t m_max_scratchpad_size = 0;
+                size_t m_op_scratchpad_size = 0;
+                size_t m_op_workspace_size = 0;
+                size_t m_unscoped_scratchpad_size = 0;
+                bool m_in_op_temporaries = false;
+                std::unordered_set<size_t> m_planned_workspaces;
+                std::atomic<size_t> m_workspace_bytes{0};
             };
         }
     }
@@ -19,6 +19,7 @@
 #include <dnnl.hpp>
 
 #include "dnnl_invoke.hpp"
+#include "ngraph/check.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
@@ -32,6 +33,18 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::set_memory_ptr(CPURuntimeConte
     memory->set_data_handle(ptr);
 }
 
+extern "C" void* ngraph::runtime::cpu::dnnl_utils::get_workspace_ptr(CPURuntimeContext* ctx,
+                                                                     size_t primitive_index,
+                                                                     size_t workspace_index)
+{
+    if (primitive_index < ctx->dnnl_workspace_ptrs.size() &&
+        ctx->dnnl_workspace_ptrs[primitive_index])
+    {
+        return ctx->dnnl_workspace_ptrs[primitive_index];
+    }
+    return ctx->dnnl_workspaces[workspace_index];
+}
+
 extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURuntimeContext* ctx,
                                                                         size_t primitive_index,
                                                                         std::vector<size_t>& deps,
@@ -160,6 +173,20 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURunti
                      {DNNL_ARG_WORKSPACE, *ctx->dnnl_memories[deps[9]]}};
 
         break;
+    case OpType::RNN_PEEPHOLE:
+        exec_args = {{DNNL_ARG_SRC_LAYER, *ctx->dnnl_memories[deps[0]]},
+                     {DNNL_ARG_SRC_ITER, *ctx->dnnl_memories[deps[1]]},
+                     {DNNL_ARG_SRC_ITER_C, *ctx->dnnl_memories[deps[2]]},
+                     {DNNL_ARG_WEIGHTS_LAYER, *ctx->dnnl_memories[deps[3]]},
+                     {DNNL_ARG_WEIGHTS_ITER, *ctx->dnnl_memories[deps[4]]},
+                     {DNNL_ARG_BIAS, *ctx->dnnl_memories[deps[5]]},
+                     {DNNL_ARG_DST_LAYER, *ctx->dnnl_memories[deps[6]]},
+                     {DNNL_ARG_DST_ITER, *ctx->dnnl_memories[deps[7]]},
+                     {DNNL_ARG_DST_ITER_C, *ctx->dnnl_memories[deps[8]]},
+                     {DNNL_ARG_WORKSPACE, *ctx->dnnl_memories[deps[9]]},
+                     {DNNL_ARG_WEIGHTS_PEEPHOLE, *ctx->dnnl_memories[deps[10]]}};
+        break;
+    case OpType::GRU:
     case OpType::VANILLA_RNN:
         exec_args = {{DNNL_ARG_SRC_LAYER, *ctx->dnnl_memories[deps[0]]},
                      {DNNL_ARG_SRC_ITER, *ctx->dnnl_memories[deps[1]]},
@@ -194,9 +221,25 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURunti
 
     if (scratchpad_size)
     {
+        void* scratchpad_ptr = nullptr;
+        if (primitive_index < ctx->dnnl_scratchpad_ptrs.size())
+        {
+            scratchpad_ptr = ctx->dnnl_scratchpad_ptrs[primitive_index];
+        }
+        if (!scratchpad_ptr)
+        {
+            NGRAPH_CHECK(ctx->scratchpad_buffer &&
+                             ctx->scratchpad_buffer->size() >= scratchpad_size,
+                         "DNNL primitive ",
+                         primitive_index,
+                         " needs a ",
+                         scratchpad_size,
+                         " byte scratchpad that was neither planned nor allocated");
+            scratchpad_ptr = ctx->scratchpad_buffer->get_ptr();
+        }
         dnnl::memory scratchpad(*ctx->dnnl_scratchpad_mds[primitive_index],
                                 executor::global_cpu_engine,
-                                ctx->scratchpad_buffer->get_ptr());
+                                scratchpad_ptr);
         exec_args.insert({DNNL_ARG_SCRATCHPAD, scratchpad});
     }
 
@@ -51,6 +51,7 @@ namespace ngraph
                     GELUBACKPROP,
                     GROUPCONVOLUTION,
                     GROUPCONVOLUTIONBIAS,
+                    GRU,
                     DECONVOLUTIONBIAS,
                     LEAKYRELU,
                     LRN,
@@ -75,6 +76,7 @@ namespace ngraph
                     RELU,
                     RELUBACKPROP,
                     RNN,
+                    RNN_PEEPHOLE,
                     VANILLA_RNN,
                     SIGMOID,
                     SIGMOIDBACKPROP,
@@ -82,6 +84,11 @@ namespace ngraph
                     SOFTMAX
                 };
                 extern "C" void set_memory_ptr(CPURuntimeContext* ctx, size_t index, void* ptr);
+                /// \brief Workspace of the primitive: its slot in the memory pool if one was
+                ///        planned, otherwise the buffer dnnl_workspaces[workspace_index].
+                extern "C" void* get_workspace_ptr(CPURuntimeContext* ctx,
+                                                   size_t primitive_index,
+                                                   size_t workspace_index);
                 extern "C" void dnnl_invoke_primitive(CPURuntimeContext* ctx,
                                                       size_t primitive_index,
                                                       std::vector<size_t>& deps,
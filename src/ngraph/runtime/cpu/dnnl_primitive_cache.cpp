@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+template <typename T>
+static void append_bytes(string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+runtime::cpu::DNNLPrimitiveCache& runtime::cpu::DNNLPrimitiveCache::get()
+{
+    static DNNLPrimitiveCache s_cache;
+    return s_cache;
+}
+
+runtime::cpu::DNNLPrimitiveCache::DNNLPrimitiveCache()
+{
+    auto capacity = getenv_int("NGRAPH_CPU_DNNL_PRIMITIVE_CACHE_CAPACITY", 1024);
+    m_capacity = capacity > 0 ? static_cast<size_t>(capacity) : 0;
+}
+
+bool runtime::cpu::DNNLPrimitiveCache::make_key(const string& kind,
+                                                const void* desc,
+                                                size_t desc_size,
+                                                const dnnl::primitive_attr& attr,
+                                                string& key) const
+{
+    if (m_capacity == 0 || attr.get_scratchpad_mode() != dnnl::scratchpad_mode::user)
+    {
+        return false;
+    }
+
+    key = kind;
+    key.push_back('\0');
+    key.append(static_cast<const char*>(desc), desc_size);
+
+    int mask;
+    vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append_bytes(key, mask);
+    for (auto scale : scales)
+    {
+        append_bytes(key, scale);
+    }
+
+    auto ops = attr.get_post_ops();
+    for (int i = 0; i < ops.len(); i++)
+    {
+        auto op_kind = ops.kind(i);
+        append_bytes(key, op_kind);
+        if (op_kind == dnnl::primitive::kind::sum)
+        {
+            float scale;
+            ops.get_params_sum(i, scale);
+            append_bytes(key, scale);
+        }
+        else if (op_kind == dnnl::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            dnnl::algorithm alg;
+            ops.get_params_eltwise(i, scale, alg, alpha, beta);
+            append_bytes(key, scale);
+            append_bytes(key, alg);
+            append_bytes(key, alpha);
+            append_bytes(key, beta);
+        }
+        else
+        {
+            // Post-ops we do not serialize are never shared
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::DNNLPrimitiveCache::lookup(const string& key,
+                                              dnnl::primitive*& primitive,
+                                              dnnl::memory::desc& scratchpad_md)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+    primitive = it->second.primitive;
+    scratchpad_md = it->second.scratchpad_md;
+    m_hits++;
+    return true;
+}
+
+dnnl::primitive* runtime::cpu::DNNLPrimitiveCache::insert(const string& key,
+                                                          dnnl::primitive* primitive,
+                                                          const dnnl::memory::desc& scratchpad_md)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        delete primitive;
+        return it->second.primitive;
+    }
+    if (m_entries.size() < m_capacity)
+    {
+        m_entries.insert({key, Entry{primitive, scratchpad_md}});
+        m_primitives.insert(primitive);
+    }
+    return primitive;
+}
+
+bool runtime::cpu::DNNLPrimitiveCache::owns(const dnnl::primitive* primitive)
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_primitives.count(primitive) != 0;
+}
+
+size_t runtime::cpu::DNNLPrimitiveCache::size()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t runtime::cpu::DNNLPrimitiveCache::hits()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_hits;
+}
@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <dnnl.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Process-wide cache of DNNL primitives shared by all compiled functions
+            ///        and all of their runtime contexts.
+            ///
+            /// Entries are keyed by the primitive kind, the operation descriptor and the
+            /// primitive attributes, so executables and shape-specialized clones that need the
+            /// same primitive reuse one instance and its JIT code. Only primitives using a user
+            /// scratchpad are cached, since those can run concurrently with different memory
+            /// arguments; the memory objects stay per context. Cached primitives live until the
+            /// process exits. NGRAPH_CPU_DNNL_PRIMITIVE_CACHE_CAPACITY bounds the number of
+            /// entries (default 1024, 0 disables the cache).
+            class CPU_BACKEND_API DNNLPrimitiveCache
+            {
+            public:
+                static DNNLPrimitiveCache& get();
+
+                /// \brief Builds the cache key for an operation descriptor and its attributes.
+                ///        Returns false if the primitive should not be cached.
+                template <typename DESC>
+                bool make_key(const std::string& kind,
+                              const DESC& desc,
+                              const dnnl::primitive_attr& attr,
+                              std::string& key) const
+                {
+                    return make_key(kind, &desc.data, sizeof(desc.data), attr, key);
+                }
+
+                /// \brief Looks up `key`. On a hit sets `primitive` and `scratchpad_md`.
+                bool lookup(const std::string& key,
+                            dnnl::primitive*& primitive,
+                            dnnl::memory::desc& scratchpad_md);
+
+                /// \brief Offers `primitive` to the cache. Returns the primitive to use: the
+                ///        cached one if another context inserted `key` first (in which case
+                ///        `primitive` is deleted), otherwise `primitive` itself.
+                dnnl::primitive* insert(const std::string& key,
+                                        dnnl::primitive* primitive,
+                                        const dnnl::memory::desc& scratchpad_md);
+
+                /// \brief True if `primitive` is owned by the cache and must not be deleted by
+                ///        a runtime context.
+                bool owns(const dnnl::primitive* primitive);
+
+                size_t size();
+                /// \brief Number of lookups that returned a cached primitive
+                size_t hits();
+
+            private:
+                DNNLPrimitiveCache();
+                bool make_key(const std::string& kind,
+                              const void* desc,
+                              size_t desc_size,
+                              const dnnl::primitive_attr& attr,
+                              std::string& key) const;
+
+                struct Entry
+                {
+                    dnnl::primitive* primitive;
+                    dnnl::memory::desc scratchpad_md;
+                };
+
+                size_t m_capacity;
+                std::mutex m_mutex;
+                std::unordered_map<std::string, Entry> m_entries;
+                std::unordered_set<const dnnl::primitive*> m_primitives;
+                size_t m_hits = 0;
+            };
+        }
+    }
+}
@@ -203,6 +203,60 @@ void runtime::cpu::dnnl_utils::assign_dnnl_kernel(Node* node)
     ngraph_op->set_op_annotations(op_annotations);
 }
 
+static const std::map<runtime::cpu::PostOp::Algorithm,
+                      std::pair<dnnl::algorithm, const std::string>>&
+    get_post_op_algorithm_map()
+{
+    using Algorithm = runtime::cpu::PostOp::Algorithm;
+    static const std::map<Algorithm, std::pair<dnnl::algorithm, const std::string>>
+        s_post_op_algorithm_map{
+            {Algorithm::Relu, {algorithm::eltwise_relu, "dnnl::algorithm::eltwise_relu"}},
+            {Algorithm::BoundedRelu,
+             {algorithm::eltwise_bounded_relu, "dnnl::algorithm::eltwise_bounded_relu"}},
+            {Algorithm::Logistic,
+             {algorithm::eltwise_logistic, "dnnl::algorithm::eltwise_logistic"}},
+            {Algorithm::Tanh, {algorithm::eltwise_tanh, "dnnl::algorithm::eltwise_tanh"}},
+            {Algorithm::Exp, {algorithm::eltwise_exp, "dnnl::algorithm::eltwise_exp"}},
+            {Algorithm::Abs, {algorithm::eltwise_abs, "dnnl::algorithm::eltwise_abs"}},
+            {Algorithm::Sqrt, {algorithm::eltwise_sqrt, "dnnl::algorithm::eltwise_sqrt"}},
+            {Algorithm::Log, {algorithm::eltwise_log, "dnnl::algorithm::eltwise_log"}},
+            {Algorithm::Gelu, {algorithm::eltwise_gelu, "dnnl::algorithm::eltwise_gelu"}},
+            {Algorithm::Swish, {algorithm::eltwise_swish, "dnnl::algorithm::eltwise_swish"}},
+            {Algorithm::Linear, {algorithm::eltwise_linear, "dnnl::algorithm::eltwise_linear"}}};
+    return s_post_op_algorithm_map;
+}
+
+dnnl::algorithm runtime::cpu::dnnl_utils::get_post_op_algorithm(PostOp::Algorithm algorithm)
+{
+    return get_post_op_algorithm_map().at(algorithm).first;
+}
+
+const std::string&
+    runtime::cpu::dnnl_utils::get_post_op_algorithm_string(PostOp::Algorithm algorithm)
+{
+    return get_post_op_algorithm_map().at(algorithm).second;
+}
+
+void runtime::cpu::dnnl_utils::append_annotated_post_ops(const ngraph::Node* node,
+                                                         dnnl::post_ops& ops)
+{
+    if (auto* op_node = dynamic_cast<const ngraph::op::Op*>(node))
+    {
+        if (auto op_annotations = std::dynamic_pointer_cast<CPUOpAnnotations>(
+                op_node->get_op_annotations()))
+        {
+            const float ops_scale = 1.f;
+            for (auto& post_op : op_annotations->get_post_ops())
+            {
+                ops.append_eltwise(ops_scale,
+                                   get_post_op_algorithm(post_op.algorithm),
+                                   post_op.alpha,
+                                   post_op.beta);
+            }
+        }
+    }
+}
+
 bool runtime::cpu::dnnl_utils::can_use_dnnl_batchnorm_fprop(const ngraph::Node* node)
 {
     auto input_rank = node->get_input_shape(2).size();
@@ -22,6 +22,7 @@
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/runtime/cpu/cpu_backend_visibility.h"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -54,7 +55,7 @@
 #define GET_SIZE                                                                                   \
     dnnl::memory::desc scratchpad_md = pd.scratchpad_desc();                                       \
     size_t size = scratchpad_md.get_size();                                                        \
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;           \
+    record_scratchpad_size(size);                                                                  \
     return size;
 
 #define DNNL_ERROR_MESSAGE std::string(e.message)
@@ -133,6 +134,11 @@ namespace ngraph
                 bool use_dnnl_kernel(const ngraph::Node* node);
                 void assign_dnnl_kernel(Node* node);
 
+                dnnl::algorithm get_post_op_algorithm(PostOp::Algorithm algorithm);
+                const std::string& get_post_op_algorithm_string(PostOp::Algorithm algorithm);
+                // Appends the post-ops recorded in the node's CPU annotations
+                void append_annotated_post_ops(const ngraph::Node* node, dnnl::post_ops& ops);
+
                 std::map<element::Type, const dnnl::memory::data_type>& get_dnnl_data_type_map();
                 std::map<element::Type, const std::string>& get_dnnl_data_type_string_map();
                 std::map<dnnl::memory::FORMAT, const std::string>& get_dnnl_format_string_map();
@@ -46,6 +46,52 @@ namespace ngraph
                         in.template cast<OutputElementType>();
                 }
 
+                // Converts between float and the half precision types with the vectorized block
+                // routines of the types, splitting the tensor across the arena's threads
+                template <typename InputElementType, typename OutputElementType>
+                void convert_blocked(void* input, void* output, size_t count, int arena)
+                {
+                    auto in = static_cast<const InputElementType*>(input);
+                    auto out = static_cast<OutputElementType*>(output);
+                    auto convert_range = [in, out](Eigen::Index first, Eigen::Index last) {
+                        runtime::reference::convert<InputElementType, OutputElementType>(
+                            in + first, out + first, last - first);
+                    };
+                    Eigen::TensorOpCost cost(
+                        sizeof(InputElementType), sizeof(OutputElementType), 1);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(count, cost, convert_range);
+                }
+
+                template <>
+                inline void
+                    convert<float, float16>(void* input, void* output, size_t count, int arena)
+                {
+                    convert_blocked<float, float16>(input, output, count, arena);
+                }
+
+                template <>
+                inline void
+                    convert<float16, float>(void* input, void* output, size_t count, int arena)
+                {
+                    convert_blocked<float16, float>(input, output, count, arena);
+                }
+
+                template <>
+                inline void
+                    convert<float, bfloat16>(void* input, void* output, size_t count, int arena)
+                {
+                    convert_blocked<float, bfloat16>(input, output, count, arena);
+                }
+
+                template <>
+                inline void
+                    convert<bfloat16, float>(void* input, void* output, size_t count, int arena)
+                {
+                    convert_blocked<bfloat16, float>(input, output, count, arena);
+                }
+
                 template <typename InputElementType>
                 void convert_to_float32(void* input, void* output, size_t count, int arena)
                 {
@@ -112,6 +158,12 @@ namespace ngraph
                     convert<InputElementType, bool>(input, output, count, arena);
                 }
 
+                template <typename InputElementType>
+                void convert_to_f16(void* input, void* output, size_t count, int arena)
+                {
+                    convert<InputElementType, float16>(input, output, count, arena);
+                }
+
                 template <typename InputElementType>
                 void convert_to_bf16(void* input, void* output, size_t count, int arena)
                 {
@@ -83,6 +83,41 @@ namespace ngraph
                         in0.contract(in1, dot_dims);
                 }
 
+                // C(m x n) = op(A) * op(B) with the Eigen tensor contraction, where op
+                // transposes a row-major matrix when requested
+                template <typename ElementType>
+                void matmul(void* a,
+                            void* b,
+                            void* c,
+                            size_t m,
+                            size_t n,
+                            size_t k,
+                            bool transpose_a,
+                            bool transpose_b,
+                            int arena)
+                {
+                    Eigen::array<Eigen::Index, 2> a_dims{
+                        {static_cast<Eigen::Index>(transpose_a ? k : m),
+                         static_cast<Eigen::Index>(transpose_a ? m : k)}};
+                    Eigen::array<Eigen::Index, 2> b_dims{
+                        {static_cast<Eigen::Index>(transpose_b ? n : k),
+                         static_cast<Eigen::Index>(transpose_b ? k : n)}};
+                    Eigen::array<Eigen::Index, 2> c_dims{
+                        {static_cast<Eigen::Index>(m), static_cast<Eigen::Index>(n)}};
+                    Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> dot_dims{
+                        {Eigen::IndexPair<Eigen::Index>(transpose_a ? 0 : 1, transpose_b ? 1 : 0)}};
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 2, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(c), c_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 2, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(a), a_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 2, Eigen::RowMajor>> in1(
+                        static_cast<ElementType*>(b), b_dims);
+
+                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        in0.contract(in1, dot_dims);
+                }
+
                 template <typename ElementType>
                 void dot_scalar(
                     void* input0, void* input1, void* output, size_t element_count, int arena)
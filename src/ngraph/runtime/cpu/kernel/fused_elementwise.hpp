@@ -0,0 +1,206 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Elements evaluated at a time. All the slots of a block stay in cache while
+                // the instructions run over them.
+                constexpr size_t fused_elementwise_block_size = 512;
+
+                // Evaluates count elements of the expression starting at element begin and
+                // returns a pointer to them. The value of the last instruction is written to
+                // dest, or to scratch if dest is null. slots has one entry per input and
+                // instruction.
+                template <typename ElementType>
+                const ElementType* fused_elementwise_block(
+                    const std::vector<void*>& inputs,
+                    const std::vector<size_t>& input_sizes,
+                    const std::vector<ngraph::op::FusedElementwise::Instruction>& instructions,
+                    size_t begin,
+                    size_t count,
+                    std::vector<const ElementType*>& slots,
+                    ElementType* scratch,
+                    ElementType* dest)
+                {
+                    using Opcode = ngraph::op::FusedElementwise::Opcode;
+                    using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                    using ConstArrayMap = Eigen::Map<const Array>;
+
+                    const size_t block = fused_elementwise_block_size;
+                    for (size_t i = 0; i < inputs.size(); i++)
+                    {
+                        auto in = static_cast<const ElementType*>(inputs[i]);
+                        size_t size = input_sizes[i];
+                        if (begin + count <= size)
+                        {
+                            slots[i] = in + begin;
+                            continue;
+                        }
+                        // Broadcast along the leading axes, copy the repeated runs
+                        auto buffer = scratch + i * block;
+                        if (size == 1)
+                        {
+                            std::fill(buffer, buffer + count, in[0]);
+                        }
+                        else
+                        {
+                            size_t done = 0;
+                            while (done < count)
+                            {
+                                size_t offset = (begin + done) % size;
+                                size_t run = std::min(count - done, size - offset);
+                                std::memcpy(buffer + done, in + offset, run * sizeof(ElementType));
+                                done += run;
+                            }
+                        }
+                        slots[i] = buffer;
+                    }
+
+                    size_t slot = inputs.size();
+                    for (auto& instruction : instructions)
+                    {
+                        bool last = slot + 1 == slots.size();
+                        ElementType* out_ptr = (last && dest) ? dest : scratch + slot * block;
+                        Eigen::Map<Array> out(out_ptr, count);
+                        ConstArrayMap a(slots[instruction.arg0], count);
+                        const ElementType* b_ptr = ngraph::op::FusedElementwise::is_unary(
+                                                       instruction.opcode)
+                                                       ? slots[instruction.arg0]
+                                                       : slots[instruction.arg1];
+                        ConstArrayMap b(b_ptr, count);
+                        switch (instruction.opcode)
+                        {
+                        case Opcode::Add: out = a + b; break;
+                        case Opcode::Subtract: out = a - b; break;
+                        case Opcode::Multiply: out = a * b; break;
+                        case Opcode::Divide: out = a / b; break;
+                        case Opcode::Maximum: out = a.max(b); break;
+                        case Opcode::Minimum: out = a.min(b); break;
+                        case Opcode::Negative: out = -a; break;
+                        case Opcode::Abs: out = a.abs(); break;
+                        case Opcode::Exp: out = a.exp(); break;
+                        case Opcode::Log: out = a.log(); break;
+                        case Opcode::Sqrt: out = a.sqrt(); break;
+                        case Opcode::Tanh: out = a.tanh(); break;
+                        }
+                        slots[slot++] = out_ptr;
+                    }
+                    return slots.back();
+                }
+
+                /// \brief Evaluates a FusedElementwise expression of expression_size elements.
+                ///        With reduction_size > 1 every run of reduction_size consecutive
+                ///        elements is summed into one output element.
+                template <typename ElementType>
+                void fused_elementwise(
+                    const std::vector<void*>& inputs,
+                    const std::vector<size_t>& input_sizes,
+                    void* output,
+                    const std::vector<ngraph::op::FusedElementwise::Instruction>& instructions,
+                    size_t expression_size,
+                    size_t reduction_size,
+                    int arena)
+                {
+                    using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+
+                    auto out = static_cast<ElementType*>(output);
+                    const size_t block = fused_elementwise_block_size;
+                    const size_t slot_count = inputs.size() + instructions.size();
+                    const size_t scratch_size = slot_count * block;
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+
+                    if (reduction_size <= 1)
+                    {
+                        auto evaluate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<ElementType> scratch(scratch_size);
+                            std::vector<const ElementType*> slots(slot_count);
+                            for (Eigen::Index b = first; b < last; b++)
+                            {
+                                size_t begin = b * block;
+                                size_t count = std::min(block, expression_size - begin);
+                                fused_elementwise_block<ElementType>(inputs,
+                                                                     input_sizes,
+                                                                     instructions,
+                                                                     begin,
+                                                                     count,
+                                                                     slots,
+                                                                     scratch.data(),
+                                                                     out + begin);
+                            }
+                        };
+                        size_t blocks = (expression_size + block - 1) / block;
+                        Eigen::TensorOpCost cost(block * sizeof(ElementType) * inputs.size(),
+                                                 block * sizeof(ElementType),
+                                                 block * instructions.size());
+                        device.parallelFor(blocks, cost, evaluate_blocks);
+                    }
+                    else
+                    {
+                        auto evaluate_rows = [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<ElementType> scratch(scratch_size);
+                            std::vector<const ElementType*> slots(slot_count);
+                            for (Eigen::Index row = first; row < last; row++)
+                            {
+                                ElementType sum = 0;
+                                size_t row_begin = row * reduction_size;
+                                for (size_t done = 0; done < reduction_size; done += block)
+                                {
+                                    size_t count = std::min(block, reduction_size - done);
+                                    auto values =
+                                        fused_elementwise_block<ElementType>(inputs,
+                                                                             input_sizes,
+                                                                             instructions,
+                                                                             row_begin + done,
+                                                                             count,
+                                                                             slots,
+                                                                             scratch.data(),
+                                                                             nullptr);
+                                    sum += Eigen::Map<const Array>(values, count).sum();
+                                }
+                                out[row] = sum;
+                            }
+                        };
+                        size_t rows = expression_size / reduction_size;
+                        Eigen::TensorOpCost cost(
+                            reduction_size * sizeof(ElementType) * inputs.size(),
+                            sizeof(ElementType),
+                            reduction_size * (instructions.size() + 1));
+                        device.parallelFor(rows, cost, evaluate_rows);
+                    }
+                }
+            }
+        }
+    }
+}
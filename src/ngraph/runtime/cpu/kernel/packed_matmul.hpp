@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/type/packed.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Output channels dequantized at a time. The f32 tile of a block stays in cache
+                // while it is multiplied with every row of the data.
+                constexpr size_t packed_matmul_block_size = 64;
+
+                /// \brief Computes out[rows, channels] = data[rows, depth] *
+                ///        ((weights - zero_point) * scale)^T for weights packed as u4
+                ///        (Signed = false) or i4 (Signed = true) with shape [channels, depth].
+                ///
+                /// Blocks of output channels are unpacked to f32 one at a time and spread over
+                /// the executor's thread pool, so the full precision weights are never
+                /// materialized.
+                template <bool Signed>
+                void packed_matmul(const float* data,
+                                   const uint8_t* weights,
+                                   const float* scale,
+                                   const uint8_t* zero_point,
+                                   float* out,
+                                   size_t rows,
+                                   size_t depth,
+                                   size_t channels,
+                                   bool per_channel_scale,
+                                   bool per_channel_zero_point,
+                                   int arena)
+                {
+                    using RowMajor = Eigen::Matrix<float,
+                                                   Eigen::Dynamic,
+                                                   Eigen::Dynamic,
+                                                   Eigen::RowMajor>;
+                    using Stride = Eigen::OuterStride<>;
+
+                    auto value = [weights](size_t index) -> int32_t {
+                        return Signed ? packed::get_i4(weights, index)
+                                      : packed::get_u4(weights, index);
+                    };
+                    auto zero = [zero_point](size_t index) -> int32_t {
+                        return Signed ? packed::get_i4(zero_point, index)
+                                      : packed::get_u4(zero_point, index);
+                    };
+
+                    Eigen::Map<const RowMajor> x(data, rows, depth);
+                    const size_t block = packed_matmul_block_size;
+                    auto evaluate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<float> tile(block * depth);
+                        for (Eigen::Index b = first; b < last; b++)
+                        {
+                            size_t begin = b * block;
+                            size_t count = std::min(block, channels - begin);
+                            for (size_t c = 0; c < count; c++)
+                            {
+                                size_t channel = begin + c;
+                                int32_t zp = zero(per_channel_zero_point ? channel : 0);
+                                float s = scale[per_channel_scale ? channel : 0];
+                                float* row = tile.data() + c * depth;
+                                size_t offset = channel * depth;
+                                for (size_t k = 0; k < depth; k++)
+                                {
+                                    row[k] = static_cast<float>(value(offset + k) - zp) * s;
+                                }
+                            }
+                            Eigen::Map<const RowMajor> w(tile.data(), count, depth);
+                            Eigen::Map<RowMajor, 0, Stride> y(
+                                out + begin, rows, count, Stride(channels));
+                            y.noalias() = x * w.transpose();
+                        }
+                    };
+
+                    size_t blocks = (channels + block - 1) / block;
+                    Eigen::TensorOpCost cost(rows * depth * sizeof(float) + block * depth / 2,
+                                             rows * block * sizeof(float),
+                                             2 * rows * block * depth);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(blocks, cost, evaluate_blocks);
+                }
+            }
+        }
+    }
+}
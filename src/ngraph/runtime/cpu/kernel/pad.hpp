@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -192,6 +194,21 @@ namespace ngraph
                     }
                 }
 
+                // Fills the padding of an output whose input was written in place between `below`
+                // padding elements and `above` padding elements
+                template <typename ElementType>
+                void pad_borders(void* output,
+                                 void* pad_value,
+                                 size_t below,
+                                 size_t interior,
+                                 size_t above)
+                {
+                    auto out = static_cast<ElementType*>(output);
+                    auto value = *static_cast<ElementType*>(pad_value);
+                    std::fill(out, out + below, value);
+                    std::fill(out + below + interior, out + below + interior + above, value);
+                }
+
                 template <typename ElementType>
                 void pad_ref(const void* arg0,
                              const void* arg1,
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+// Rank-generic data movement kernels. They are templated only on a storage type of the element's
+// size (see SELECT_KERNEL_BY_SIZE) and serve the (type, rank) combinations that the build does
+// not specialize.
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Repeats `input` to fill `output`; both shapes have the output rank and
+                ///        each input dimension divides the output one. Covers Broadcast (input
+                ///        dimension 1 on broadcast axes) and Tile.
+                template <typename ElementType>
+                void tile_generic(void* input,
+                                  void* output,
+                                  const Shape& input_shape,
+                                  const Shape& output_shape,
+                                  int /* arena */)
+                {
+                    auto rank = output_shape.size();
+                    auto out_size = shape_size(output_shape);
+                    if (rank == 0 || out_size == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<size_t> in_strides(rank, 1);
+                    for (size_t d = rank - 1; d > 0; d--)
+                    {
+                        in_strides[d - 1] = in_strides[d] * input_shape[d];
+                    }
+
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    auto in_row = input_shape[rank - 1];
+                    auto out_row = output_shape[rank - 1];
+                    // Odometer over the outer dimensions; the innermost one is copied per row
+                    std::vector<size_t> index(rank, 0);
+                    for (size_t row = 0; row < out_size / out_row; row++)
+                    {
+                        size_t offset = 0;
+                        for (size_t d = 0; d + 1 < rank; d++)
+                        {
+                            offset += (index[d] % input_shape[d]) * in_strides[d];
+                        }
+                        auto src = in + offset;
+                        auto dst = out + row * out_row;
+                        if (in_row == out_row)
+                        {
+                            memcpy(dst, src, out_row * sizeof(ElementType));
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < out_row; j++)
+                            {
+                                dst[j] = src[j % in_row];
+                            }
+                        }
+
+                        for (size_t d = rank - 1; d-- > 0;)
+                        {
+                            if (++index[d] < output_shape[d])
+                            {
+                                break;
+                            }
+                            index[d] = 0;
+                        }
+                    }
+                }
+
+                template <typename ElementType>
+                void concat_generic(std::vector<void*> inputs,
+                                    std::vector<Shape> input_shapes,
+                                    void* output,
+                                    Shape output_shape,
+                                    int64_t axis)
+                {
+                    // Each input contributes one contiguous block per index of the dimensions
+                    // before `axis`
+                    size_t rows = 1;
+                    for (int64_t d = 0; d < axis; d++)
+                    {
+                        rows *= output_shape[d];
+                    }
+                    if (rows == 0)
+                    {
+                        return;
+                    }
+
+                    auto out = static_cast<ElementType*>(output);
+                    auto out_block = shape_size(output_shape) / rows;
+                    size_t out_offset = 0;
+                    for (size_t i = 0; i < inputs.size(); i++)
+                    {
+                        auto in = static_cast<const ElementType*>(inputs[i]);
+                        auto in_block = shape_size(input_shapes[i]) / rows;
+                        for (size_t row = 0; row < rows; row++)
+                        {
+                            memcpy(out + row * out_block + out_offset,
+                                   in + row * in_block,
+                                   in_block * sizeof(ElementType));
+                        }
+                        out_offset += in_block;
+                    }
+                }
+            }
+        }
+    }
+}
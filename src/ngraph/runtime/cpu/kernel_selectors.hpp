@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "ngraph/runtime/cpu/cpu_kernel_profile.hpp"
+
 // VS compiler treats __VA_ARGS__ as a single token argument rather than expanding it
 // so the macro below is a workaround to that
 #define EXPAND_MACRO(S) S // VS compiler workaround
@@ -31,10 +33,24 @@
 #define SELECT_RANK35_ET4(KV, ET, R1, R2, K)                                                       \
     EXPAND_RANK35_AND_ET4(K, KV, R1, R2, ET, KERNEL_CT_R1_R2)
 
-// Configurable at build using NGRAPH_CPU_OPTIMIZED_DATATYPES
+// Configurable at build using NGRAPH_CPU_OPTIMIZED_DATATYPES (and NGRAPH_CPU_OPTIMIZED_RANKS for
+// SELECT_ETS_AND_RANK7). Guard with is_optimized_et / is_optimized_et_and_rank and fall back to a
+// reference or rank-generic kernel otherwise.
 #define SELECT_ETS(KV, ET, K) EXPAND_ETS(K, KV, ET, KERNEL_CT)
 #define SELECT_ETS_AND_RANK7(KV, ET, R, K) EXPAND_ETS_AND_RANK7(K, KV, ET, R, KERNEL_CT_R)
 
+// One instantiation per element size. Use for rank-generic data movement kernels
+#define SELECT_KERNEL_BY_SIZE(KV, ET, K)                                                           \
+    switch (ET.size())                                                                             \
+    {                                                                                              \
+    case 1: KV = K<uint8_t>; break;                                                                \
+    case 2: KV = K<uint16_t>; break;                                                               \
+    case 4: KV = K<uint32_t>; break;                                                               \
+    case 8: KV = K<uint64_t>; break;                                                               \
+    default:                                                                                       \
+        throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);  \
+    }
+
 // Macros for instantiating templated kernels
 #define KERNEL_CT(K, KV, CT) KV = K<CT>
 #define KERNEL_CT_CT_CT(K, KV, CT) KV = K<CT, CT, CT>
@@ -47,7 +63,7 @@
 #define EXPAND_RANK5_AND_ET4(K, KV, R, ET, S, A1) EXPAND_RANK5(K, KV, R, EXPAND_ET4, ET, S, A1)
 #define EXPAND_RANK35_AND_ET4(K, KV, R1, R2, ET, S)                                                \
     EXPAND_RANK3(K, KV, R1, EXPAND_RANK5_AND_ET4, R2, ET, S)
-#define EXPAND_ETS_AND_RANK7(K, KV, ET, R, S) EXPAND_ETS_2(K, KV, ET, EXPAND_RANK7_1, R, S)
+#define EXPAND_ETS_AND_RANK7(K, KV, ET, R, S) EXPAND_ETS_2(K, KV, ET, EXPAND_RANKS_1, R, S)
 
 // Expander Macros that instantiate kernels for various element types and ranks
 #define EXPAND_ET4(K, KV, ET, S, A1, A2)                                                           \
@@ -314,6 +330,83 @@
     default: throw ngraph_error("Unsupported rank " + std::to_string(R) + " for kernel " #K);      \
     }
 
+// Expand only selected ranks. Named macros (e.g., RANK4_CASE) are expanded based on build-flags
+#define EXPAND_RANKS_1(K, KV, R, S, A1)                                                            \
+    switch (R)                                                                                     \
+    {                                                                                              \
+        RANK1_CASE(S, K, KV, A1)                                                                   \
+        RANK2_CASE(S, K, KV, A1)                                                                   \
+        RANK3_CASE(S, K, KV, A1)                                                                   \
+        RANK4_CASE(S, K, KV, A1)                                                                   \
+        RANK5_CASE(S, K, KV, A1)                                                                   \
+        RANK6_CASE(S, K, KV, A1)                                                                   \
+        RANK7_CASE(S, K, KV, A1)                                                                   \
+    default: throw ngraph_error("Unsupported rank " + std::to_string(R) + " for kernel " #K);      \
+    }
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_1)
+#define RANK1_EN 1
+#define RANK1_CASE(S, K, KV, A1)                                                                   \
+    case 1: EXPAND_MACRO(S(K, KV, A1, 1)); break;
+#else
+#define RANK1_EN 0
+#define RANK1_CASE(S, K, KV, A1)
+#endif
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_2)
+#define RANK2_EN 1
+#define RANK2_CASE(S, K, KV, A1)                                                                   \
+    case 2: EXPAND_MACRO(S(K, KV, A1, 2)); break;
+#else
+#define RANK2_EN 0
+#define RANK2_CASE(S, K, KV, A1)
+#endif
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_3)
+#define RANK3_EN 1
+#define RANK3_CASE(S, K, KV, A1)                                                                   \
+    case 3: EXPAND_MACRO(S(K, KV, A1, 3)); break;
+#else
+#define RANK3_EN 0
+#define RANK3_CASE(S, K, KV, A1)
+#endif
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_4)
+#define RANK4_EN 1
+#define RANK4_CASE(S, K, KV, A1)                                                                   \
+    case 4: EXPAND_MACRO(S(K, KV, A1, 4)); break;
+#else
+#define RANK4_EN 0
+#define RANK4_CASE(S, K, KV, A1)
+#endif
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_5)
+#define RANK5_EN 1
+#define RANK5_CASE(S, K, KV, A1)                                                                   \
+    case 5: EXPAND_MACRO(S(K, KV, A1, 5)); break;
+#else
+#define RANK5_EN 0
+#define RANK5_CASE(S, K, KV, A1)
+#endif
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_6)
+#define RANK6_EN 1
+#define RANK6_CASE(S, K, KV, A1)                                                                   \
+    case 6: EXPAND_MACRO(S(K, KV, A1, 6)); break;
+#else
+#define RANK6_EN 0
+#define RANK6_CASE(S, K, KV, A1)
+#endif
+
+#if defined(NGRAPH_CPU_OPTIMIZE_RANK_7)
+#define RANK7_EN 1
+#define RANK7_CASE(S, K, KV, A1)                                                                   \
+    case 7: EXPAND_MACRO(S(K, KV, A1, 7)); break;
+#else
+#define RANK7_EN 0
+#define RANK7_CASE(S, K, KV, A1)
+#endif
+
 #if defined(NGRAPH_CPU_OPTIMIZE_boolean)
 #define BOOLEAN_EN 1
 #define BOOLEAN_SELECT(S, ...) EXPAND_MACRO(S(__VA_ARGS__))
@@ -418,3 +511,24 @@ static inline bool is_optimized_et(const ngraph::element::Type& et)
         return false;
     }
 }
+
+static inline bool is_optimized_rank(size_t rank)
+{
+    switch (rank)
+    {
+    case 1: return RANK1_EN;
+    case 2: return RANK2_EN;
+    case 3: return RANK3_EN;
+    case 4: return RANK4_EN;
+    case 5: return RANK5_EN;
+    case 6: return RANK6_EN;
+    case 7: return RANK7_EN;
+    default: return false;
+    }
+}
+
+static inline bool is_optimized_et_and_rank(const ngraph::element::Type& et, size_t rank)
+{
+    ngraph::runtime::cpu::record_kernel_use(et, rank);
+    return is_optimized_et(et) && is_optimized_rank(rank);
+}
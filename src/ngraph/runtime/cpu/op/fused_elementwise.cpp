@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::FusedElementwise::type_info;
+
+op::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                       const vector<Instruction>& instructions,
+                                       const Shape& shape,
+                                       size_t reduced_axes)
+    : Op(args)
+    , m_instructions(instructions)
+    , m_shape(shape)
+    , m_reduced_axes(reduced_axes)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::FusedElementwise::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, get_input_size() > 0, "FusedElementwise needs an input");
+    NODE_VALIDATION_CHECK(this, !m_instructions.empty(), "FusedElementwise needs an instruction");
+    NODE_VALIDATION_CHECK(this,
+                          m_reduced_axes <= m_shape.size(),
+                          "Cannot reduce ",
+                          m_reduced_axes,
+                          " axes of shape ",
+                          m_shape);
+
+    auto element_type = get_input_element_type(0);
+    size_t expression_size = shape_size(m_shape);
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == element_type,
+                              "Argument element types do not match");
+        size_t input_size = shape_size(get_input_shape(i));
+        NODE_VALIDATION_CHECK(this,
+                              input_size > 0 && expression_size % input_size == 0,
+                              "Argument shape ",
+                              get_input_shape(i),
+                              " cannot be broadcast to ",
+                              m_shape);
+    }
+
+    size_t slots = get_input_size();
+    for (auto& instruction : m_instructions)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              instruction.arg0 < slots &&
+                                  (is_unary(instruction.opcode) || instruction.arg1 < slots),
+                              "Instruction reads a slot that is not defined yet");
+        slots++;
+    }
+
+    Shape result_shape(m_shape.begin(), m_shape.end() - m_reduced_axes);
+    set_output_type(0, element_type, result_shape);
+}
+
+shared_ptr<Node> op::FusedElementwise::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<FusedElementwise>(new_args, m_instructions, m_shape, m_reduced_axes);
+}
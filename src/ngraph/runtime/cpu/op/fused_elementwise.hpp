@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A chain of elementwise ops evaluated in a single pass over memory, optionally
+        ///        followed by a sum over the trailing axes.
+        ///
+        /// The expression is a list of instructions over value slots. Slots [0, N) hold the N
+        /// inputs, each following instruction appends one slot and the last slot is the value
+        /// of the expression. An input with fewer elements than the expression shape is
+        /// broadcast along the leading axes, i.e. element i reads input[i % input_size].
+        class FusedElementwise : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Opcode
+            {
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                Maximum,
+                Minimum,
+                Negative,
+                Abs,
+                Exp,
+                Log,
+                Sqrt,
+                Tanh
+            };
+
+            struct Instruction
+            {
+                Opcode opcode;
+                size_t arg0;
+                size_t arg1;
+            };
+
+            /// \brief Constructs a FusedElementwise operation.
+            ///
+            /// \param args The inputs of the expression.
+            /// \param instructions The instructions in evaluation order.
+            /// \param shape The shape of the expression.
+            /// \param reduced_axes The number of trailing axes of shape the result is summed
+            ///                     over.
+            CPU_BACKEND_API FusedElementwise(const OutputVector& args,
+                                             const std::vector<Instruction>& instructions,
+                                             const Shape& shape,
+                                             size_t reduced_axes = 0);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const std::vector<Instruction>& get_instructions() const { return m_instructions; }
+            const Shape& get_expression_shape() const { return m_shape; }
+            size_t get_reduced_axes() const { return m_reduced_axes; }
+            /// \returns true if the opcode reads a single slot
+            static bool is_unary(Opcode opcode) { return opcode >= Opcode::Negative; }
+        private:
+            std::vector<Instruction> m_instructions;
+            Shape m_shape;
+            size_t m_reduced_axes;
+        };
+    }
+}
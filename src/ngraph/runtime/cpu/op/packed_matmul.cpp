@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/packed_matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::PackedMatmul::type_info;
+
+op::PackedMatmul::PackedMatmul(const Output<Node>& data,
+                               const Output<Node>& weights,
+                               const Output<Node>& scale,
+                               const Output<Node>& zero_point)
+    : Op({data, weights, scale, zero_point})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::PackedMatmul::validate_and_infer_types()
+{
+    auto& data_shape = get_input_shape(0);
+    auto& weights_shape = get_input_shape(1);
+    auto& scale_shape = get_input_shape(2);
+    auto& zero_point_shape = get_input_shape(3);
+    auto weights_type = get_input_element_type(1);
+
+    NODE_VALIDATION_CHECK(
+        this, get_input_element_type(0) == element::f32, "Data must have element type f32");
+    NODE_VALIDATION_CHECK(this,
+                          weights_type == element::u4 || weights_type == element::i4,
+                          "Weights must have element type u4 or i4");
+    NODE_VALIDATION_CHECK(
+        this, get_input_element_type(2) == element::f32, "Scale must have element type f32");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(3) == weights_type,
+                          "Zero point must have the element type of the weights");
+    NODE_VALIDATION_CHECK(this,
+                          data_shape.size() >= 1 && weights_shape.size() == 2 &&
+                              data_shape.back() == weights_shape[1],
+                          "Data shape ",
+                          data_shape,
+                          " does not match weights shape ",
+                          weights_shape);
+
+    size_t channels = weights_shape[0];
+    NODE_VALIDATION_CHECK(this,
+                          shape_size(scale_shape) == 1 || scale_shape == Shape{channels},
+                          "Scale must be a scalar or hold one value per output channel");
+    NODE_VALIDATION_CHECK(this,
+                          shape_size(zero_point_shape) == 1 || zero_point_shape == Shape{channels},
+                          "Zero point must be a scalar or hold one value per output channel");
+
+    Shape result_shape(data_shape.begin(), data_shape.end() - 1);
+    result_shape.push_back(channels);
+    set_output_type(0, element::f32, result_shape);
+}
+
+shared_ptr<Node> op::PackedMatmul::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<PackedMatmul>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+}
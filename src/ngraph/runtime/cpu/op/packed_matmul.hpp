@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Matrix product of f32 data with 4-bit weights that are dequantized on the fly.
+        ///
+        /// The weights are stored packed as u4 or i4 with one row of K values per output
+        /// channel, i.e. with shape [N, K]. The result is data[..., K] * ((weights - zero_point)
+        /// * scale)^T with shape [..., N]. scale and zero_point are scalars or hold one value
+        /// per output channel.
+        class PackedMatmul : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"PackedMatmul", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \brief Constructs a PackedMatmul operation.
+            ///
+            /// \param data The f32 input of shape [..., K].
+            /// \param weights The packed u4 or i4 weights of shape [N, K].
+            /// \param scale The f32 scale of shape [] or [N].
+            /// \param zero_point The zero point of shape [] or [N], of the weights type.
+            CPU_BACKEND_API PackedMatmul(const Output<Node>& data,
+                                         const Output<Node>& weights,
+                                         const Output<Node>& scale,
+                                         const Output<Node>& zero_point);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+        };
+    }
+}
@@ -25,7 +25,7 @@ constexpr NodeTypeInfo op::Rnn::type_info;
 
 shared_ptr<Node> op::Rnn::clone_with_new_inputs(const OutputVector& new_args) const
 {
-    if (new_args.size() != 6 && new_args.size() != 5)
+    if (new_args.size() != 7 && new_args.size() != 6 && new_args.size() != 5)
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
@@ -45,6 +45,23 @@ shared_ptr<Node> op::Rnn::clone_with_new_inputs(const OutputVector& new_args) co
                                 m_num_fused_layers,
                                 m_rnntype);
     }
+    else if (new_args.size() == 7)
+    {
+        return make_shared<Rnn>(new_args[0],
+                                new_args[1],
+                                new_args[2],
+                                new_args[3],
+                                new_args[4],
+                                new_args[5],
+                                new_args[6],
+                                m_num_timesteps,
+                                m_num_gates_per_cell,
+                                m_src_sequence_length,
+                                m_num_cell_states,
+                                m_direction,
+                                m_num_fused_layers,
+                                m_rnntype);
+    }
     else
     {
         return make_shared<Rnn>(new_args[0],
@@ -115,9 +132,15 @@ op::Rnn::Rnn(const Output<Node>& src_layer,
         throw ngraph_error("src_layer size is not equal t*n*c");
     }
 
-    if ((bias.get_shape()[0] / (m_direction * m_num_fused_layers)) !=
-            (weights_layer.get_shape()[1]) ||
-        (bias.get_shape()[0] / (m_direction * m_num_fused_layers)) != (weights_iter.get_shape()[1]))
+    // linear-before-reset GRU keeps the recurrent bias of the hidden gate apart from the sum of
+    // the input and recurrent biases of the other gates
+    size_t bias_gates_size = weights_layer.get_shape()[1];
+    if (m_rnntype == ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru)
+    {
+        bias_gates_size += m_dst_layer_feature_size;
+    }
+    if ((bias.get_shape()[0] / (m_direction * m_num_fused_layers)) != bias_gates_size ||
+        weights_layer.get_shape()[1] != weights_iter.get_shape()[1])
     {
         throw ngraph_error("bias and weights_shape are not compatible");
     }
@@ -223,3 +246,49 @@ op::Rnn::Rnn(const Output<Node>& src_layer,
         src_layer.get_element_type(),
         Shape{(m_direction * m_num_fused_layers * m_batch_size), m_src_iter_feature_size});
 }
+
+op::Rnn::Rnn(const Output<Node>& src_layer,
+             const Output<Node>& src_iter,
+             const Output<Node>& src_iter_c,
+             const Output<Node>& weights_layer,
+             const Output<Node>& weights_iter,
+             const Output<Node>& bias,
+             const Output<Node>& weights_peephole,
+             size_t num_timesteps,
+             size_t num_gates_per_cell,
+             size_t src_sequence_length,
+             size_t num_cell_states,
+             size_t direction,
+             size_t num_fused_layers,
+             ngraph::runtime::cpu::rnn_utils::rnntype rnn_type)
+    : Rnn(src_layer,
+          src_iter,
+          src_iter_c,
+          weights_layer,
+          weights_iter,
+          bias,
+          num_timesteps,
+          num_gates_per_cell,
+          src_sequence_length,
+          num_cell_states,
+          direction,
+          num_fused_layers,
+          rnn_type)
+{
+    if (m_rnntype != ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm)
+    {
+        throw ngraph_error("peephole weights are only supported for LSTM");
+    }
+
+    if (weights_peephole.get_element_type() != src_layer.get_element_type())
+    {
+        throw ngraph_error("all rnn inputs must have the same element type");
+    }
+
+    if (weights_peephole.get_shape() !=
+        Shape{m_num_fused_layers * m_direction * 3 * m_src_iter_feature_size})
+    {
+        throw ngraph_error("peephole weights shape is not compatible");
+    }
+    set_argument(6, weights_peephole);
+}
@@ -46,6 +46,9 @@ namespace ngraph
         // src_iter_feature_size - feature size w.r.to hidden state
         // num_cell_states - number of recurrent state tensor states , LSTM = 2, GRU = 1, vanilla
         // RNN = 1
+        // LSTM with peepholes takes an extra input [6] - the peephole weights of Shape{layers *
+        // directions * 3 * feature_size} in the DNNL (i, f, o) gate order.
+        // For lbr_gru the bias carries a fourth gate, the recurrent bias of the hidden gate.
 
         // OUTPUT VALUE: A tuple with the following structure:
         //   [0] - ht, output tensor with shape (sequence_length*batch_size, feature_size) .
@@ -84,6 +87,21 @@ namespace ngraph
                                 size_t direction,
                                 size_t num_fused_layers,
                                 ngraph::runtime::cpu::rnn_utils::rnntype rnn_type);
+
+            CPU_BACKEND_API Rnn(const Output<Node>& src_layer,
+                                const Output<Node>& src_iter,
+                                const Output<Node>& src_iter_c,
+                                const Output<Node>& weights_layer,
+                                const Output<Node>& weights_iter,
+                                const Output<Node>& bias,
+                                const Output<Node>& weights_peephole,
+                                size_t num_timesteps,
+                                size_t num_gates_per_cell,
+                                size_t src_sequence_length,
+                                size_t num_cell_states,
+                                size_t direction,
+                                size_t num_fused_layers,
+                                ngraph::runtime::cpu::rnn_utils::rnntype rnn_type);
             virtual std::shared_ptr<Node>
                 clone_with_new_inputs(const OutputVector& new_args) const override;
 
@@ -99,6 +117,7 @@ namespace ngraph
             size_t get_num_cell_states() const { return m_num_cell_states; }
             size_t get_direction() const { return m_direction; }
             size_t get_num_fused_layers() const { return m_num_fused_layers; }
+            bool has_peephole() const { return get_input_size() == 7; }
             bool is_type(ngraph::runtime::cpu::rnn_utils::rnntype rnn_type) const
             {
                 return m_rnntype == rnn_type;
@@ -32,7 +32,10 @@ namespace ngraph
                 {
                     vanilla_rnn,
                     vanilla_gru,
-                    vanilla_lstm
+                    vanilla_lstm,
+                    // GRU with the linear transformation applied before the reset gate; the
+                    // bias carries a fourth (recurrent hidden) gate
+                    lbr_gru
                 };
             }
         }
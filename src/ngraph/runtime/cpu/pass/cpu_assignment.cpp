@@ -652,15 +652,22 @@ namespace ngraph
                         auto weights_layer_rank = node->get_input_shape(3).size();
                         auto weights_iter_rank = node->get_input_shape(4).size();
                         auto bias_rank = node->get_input_shape(5).size();
+                        auto peephole_rank =
+                            rnn_op->has_peephole() ? node->get_input_shape(6).size() : 1;
                         if ((src_layer_rank == 2 && src_iter_rank == 2 && src_iter_c_rank == 2 &&
                              weights_layer_rank == 2 && weights_iter_rank == 2 && bias_rank == 1 &&
+                             peephole_rank == 1 &&
                              node->get_input_element_type(0) == element::f32 &&
                              node->get_input_element_type(1) == element::f32))
                         {
                             runtime::cpu::dnnl_utils::assign_dnnl_kernel(node);
                         }
                     }
-                    else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_rnn))
+                    else if (rnn_op->is_type(
+                                 ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_rnn) ||
+                             rnn_op->is_type(
+                                 ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru) ||
+                             rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru))
                     {
                         auto weights_layer_rank = node->get_input_shape(2).size();
                         auto weights_iter_rank = node->get_input_shape(3).size();
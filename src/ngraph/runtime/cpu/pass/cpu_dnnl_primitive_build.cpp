@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <iomanip>
+#include <limits>
+#include <sstream>
 #include <string>
 
 #include "cpu_dnnl_primitive_build.hpp"
@@ -944,6 +947,26 @@ namespace ngraph
                                   "ops_beta);\n";
                     }
 
+                    if (auto op_annotations =
+                            std::static_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(
+                                convolution->get_op_annotations()))
+                    {
+                        auto float_literal = [](float value) {
+                            std::stringstream ss;
+                            ss << "static_cast<float>("
+                               << std::setprecision(std::numeric_limits<float>::max_digits10)
+                               << value << ")";
+                            return ss.str();
+                        };
+                        for (auto& post_op : op_annotations->get_post_ops())
+                        {
+                            writer << "ops.append_eltwise(1.f, "
+                                   << dnnl_utils::get_post_op_algorithm_string(post_op.algorithm)
+                                   << ", " << float_literal(post_op.alpha) << ", "
+                                   << float_literal(post_op.beta) << ");\n";
+                        }
+                    }
+
                     writer << "dnnl::primitive_attr conv_attr;\n";
                     writer << "conv_attr.set_post_ops(ops);\n";
                     writer << "conv_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);\n";
@@ -0,0 +1,314 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "cpu_elementwise_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Opcode = op::FusedElementwise::Opcode;
+
+// Smaller values stay in cache anyway, separate kernels are cheaper than interpreting the
+// instruction list for them
+static const size_t s_min_fused_elements = 64;
+
+static bool get_opcode(const Node& node, Opcode& opcode)
+{
+    static const map<NodeTypeInfo, Opcode> opcodes{
+        {op::v1::Add::type_info, Opcode::Add},
+        {op::v1::Subtract::type_info, Opcode::Subtract},
+        {op::v1::Multiply::type_info, Opcode::Multiply},
+        {op::v1::Divide::type_info, Opcode::Divide},
+        {op::v1::Maximum::type_info, Opcode::Maximum},
+        {op::v1::Minimum::type_info, Opcode::Minimum},
+        {op::v0::Negative::type_info, Opcode::Negative},
+        {op::v0::Abs::type_info, Opcode::Abs},
+        {op::v0::Exp::type_info, Opcode::Exp},
+        {op::v0::Log::type_info, Opcode::Log},
+        {op::v0::Sqrt::type_info, Opcode::Sqrt},
+        {op::v0::Tanh::type_info, Opcode::Tanh}};
+
+    auto it = opcodes.find(node.get_type_info());
+    if (it == opcodes.end())
+    {
+        return false;
+    }
+    opcode = it->second;
+    return true;
+}
+
+static bool has_control_dependencies(const shared_ptr<Node>& node)
+{
+    return !node->get_control_dependencies().empty() || !node->get_control_dependents().empty();
+}
+
+// An f32 elementwise op computing a value of the given shape from values of the same shape
+static bool is_fusible(const shared_ptr<Node>& node, const Shape& shape)
+{
+    Opcode opcode;
+    if (!get_opcode(*node, opcode) || node->get_output_size() != 1 ||
+        node->get_output_element_type(0) != element::f32 || node->get_output_shape(0) != shape ||
+        runtime::cpu::dnnl_utils::use_dnnl_kernel(node.get()) || has_control_dependencies(node))
+    {
+        return false;
+    }
+    for (auto& input : node->inputs())
+    {
+        if (input.get_element_type() != element::f32 || input.get_shape() != shape)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool users_in(const Output<Node>& value, const unordered_set<Node*>& members)
+{
+    for (auto& input : value.get_target_inputs())
+    {
+        if (members.count(input.get_node()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Number of trailing axes a Sum reduces over, or 0 if it reduces over other axes
+static size_t get_trailing_reduced_axes(const op::v0::Sum& sum)
+{
+    auto axes = sum.get_reduction_axes();
+    size_t rank = sum.get_input_shape(0).size();
+    for (auto axis : axes)
+    {
+        if (axis < rank - axes.size())
+        {
+            return 0;
+        }
+    }
+    return axes.size();
+}
+
+// A Broadcast of f32 data along the leading axes, so that element i of its output is element
+// i % size of its input
+static bool is_leading_broadcast(const shared_ptr<Node>& node)
+{
+    auto broadcast = as_type_ptr<op::v0::Broadcast>(node);
+    if (!broadcast || broadcast->get_input_element_type(0) != element::f32 ||
+        shape_size(broadcast->get_input_shape(0)) == 0 || has_control_dependencies(node))
+    {
+        return false;
+    }
+    auto& axes = broadcast->get_broadcast_axes();
+    for (size_t i = 0; i < axes.size(); i++)
+    {
+        if (axes.count(i) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A Reshape that keeps the element order and only feeds a single input, CPUCollapseDims wraps
+// broadcasts and reductions in these
+static bool is_order_preserving_reshape(const shared_ptr<Node>& node)
+{
+    auto reshape = as_type_ptr<op::v0::Reshape>(node);
+    return reshape && !reshape->get_is_transpose() && !has_control_dependencies(node) &&
+           reshape->output(0).get_target_inputs().size() == 1;
+}
+
+// The data of a broadcast along the leading axes that only the members use, or the value itself
+static Output<Node> get_broadcast_source(const Output<Node>& value,
+                                         const unordered_set<Node*>& members)
+{
+    if (!users_in(value, members))
+    {
+        return value;
+    }
+    auto producer = value.get_node_shared_ptr();
+    if (is_order_preserving_reshape(producer))
+    {
+        producer = producer->get_input_node_shared_ptr(0);
+        if (producer->output(0).get_target_inputs().size() != 1)
+        {
+            return value;
+        }
+    }
+    return is_leading_broadcast(producer) ? producer->input_value(0) : value;
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+    unordered_set<Node*> fused;
+    auto ordered_ops = function->get_ordered_ops();
+    unordered_map<Node*, size_t> positions;
+    for (size_t i = 0; i < ordered_ops.size(); i++)
+    {
+        positions[ordered_ops[i].get()] = i;
+    }
+    for (auto it = ordered_ops.rbegin(); it != ordered_ops.rend(); ++it)
+    {
+        auto root = *it;
+        if (fused.count(root.get()))
+        {
+            continue;
+        }
+
+        // The chain ends either in an elementwise op or in a Sum over its trailing axes
+        auto expression_root = root;
+        size_t reduced_axes = 0;
+        unordered_set<Node*> members{root.get()};
+        if (auto sum = as_type_ptr<op::v0::Sum>(root))
+        {
+            reduced_axes = get_trailing_reduced_axes(*sum);
+            expression_root = sum->get_input_node_shared_ptr(0);
+            if (is_order_preserving_reshape(expression_root))
+            {
+                members.insert(expression_root.get());
+                expression_root = expression_root->get_input_node_shared_ptr(0);
+            }
+            if (reduced_axes == 0 || has_control_dependencies(root) ||
+                !is_fusible(expression_root, expression_root->get_output_shape(0)) ||
+                expression_root->output(0).get_target_inputs().size() != 1)
+            {
+                continue;
+            }
+            members.insert(expression_root.get());
+        }
+        else if (!is_fusible(root, root->get_output_shape(0)))
+        {
+            continue;
+        }
+
+        // Elementwise members all have this shape, the expression may be a reshape of it
+        Shape member_shape = expression_root->get_output_shape(0);
+        Shape shape = root->get_input_shape(0);
+        if (reduced_axes == 0)
+        {
+            shape = member_shape;
+        }
+
+        if (shape_size(member_shape) < s_min_fused_elements)
+        {
+            continue;
+        }
+
+        // Grow the chain through producers whose users are all members. A producer shared by
+        // several members is looked at again as each of them joins, and joins with the last.
+        NodeVector chain{expression_root};
+        for (size_t i = 0; i < chain.size(); i++)
+        {
+            for (auto& value : chain[i]->input_values())
+            {
+                auto producer = value.get_node_shared_ptr();
+                if (members.count(producer.get()) == 0 && is_fusible(producer, member_shape) &&
+                    users_in(value, members))
+                {
+                    members.insert(producer.get());
+                    chain.push_back(producer);
+                }
+            }
+        }
+        if (chain.size() + (reduced_axes > 0 ? 1 : 0) < 2)
+        {
+            continue;
+        }
+
+        // Elementwise members in evaluation order
+        sort(chain.begin(), chain.end(), [&](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+            return positions.at(a.get()) < positions.at(b.get());
+        });
+
+        // Values from outside the chain become the inputs, a broadcast along the leading axes
+        // is read directly from its argument
+        OutputVector args;
+        map<Output<Node>, size_t> slots;
+        for (auto& node : chain)
+        {
+            for (auto& value : node->input_values())
+            {
+                if (members.count(value.get_node()) || slots.count(value))
+                {
+                    continue;
+                }
+                auto arg = get_broadcast_source(value, members);
+                size_t slot = args.size();
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    if (args[i] == arg)
+                    {
+                        slot = i;
+                    }
+                }
+                if (slot == args.size())
+                {
+                    args.push_back(arg);
+                }
+                slots[value] = slot;
+            }
+        }
+
+        vector<op::FusedElementwise::Instruction> instructions;
+        for (auto& node : chain)
+        {
+            Opcode opcode;
+            get_opcode(*node, opcode);
+            op::FusedElementwise::Instruction instruction{opcode, 0, 0};
+            instruction.arg0 = slots.at(node->input_value(0));
+            if (!op::FusedElementwise::is_unary(opcode))
+            {
+                instruction.arg1 = slots.at(node->input_value(1));
+            }
+            slots[node->output(0)] = args.size() + instructions.size();
+            instructions.push_back(instruction);
+        }
+
+        auto fused_op = make_shared<op::FusedElementwise>(args, instructions, shape, reduced_axes);
+        NGRAPH_DEBUG << "CPUElementwiseFusion: " << chain.size() << " ops ending in "
+                     << root->get_name() << " fused into " << fused_op->get_name();
+        replace_node(root, fused_op);
+        fused.insert(members.begin(), members.end());
+        replaced = true;
+    }
+    return replaced;
+}
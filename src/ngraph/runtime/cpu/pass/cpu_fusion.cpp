@@ -80,10 +80,12 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/packed_matmul.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 
 static bool init_cblas_arg(std::shared_ptr<ngraph::Node> reshape,
@@ -587,6 +589,92 @@ void ngraph::runtime::cpu::pass::CPUPreFusion::construct_maxpool_relu_switch()
     this->add_matcher(m, callback);
 }
 
+// Dot(data, Dequantize(packed 4-bit constant)) -> PackedMatmul
+// Runs ahead of CPUFusion so the Dot is not turned into a f32 MatmulBias first.
+void ngraph::runtime::cpu::pass::CPUPreFusion::construct_packed_matmul()
+{
+    auto data = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto weights = std::make_shared<pattern::op::Label>(
+        element::u4, Shape{3, 4}, pattern::has_class<ngraph::op::v0::Constant>());
+    auto scale = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{}, pattern::has_class<ngraph::op::v0::Constant>());
+    auto zero_point = std::make_shared<pattern::op::Label>(
+        element::u4, Shape{}, pattern::has_class<ngraph::op::v0::Constant>());
+    auto dq = std::make_shared<ngraph::op::v0::Dequantize>(
+        weights, scale, zero_point, element::f32, AxisSet{});
+    auto dq_label = std::make_shared<pattern::op::Label>(dq, nullptr, OutputVector{dq});
+    auto skip_reshape = std::make_shared<pattern::op::Skip>(
+        dq_label, pattern::has_class<ngraph::op::v0::Reshape>());
+    auto pdot = std::make_shared<ngraph::op::v0::Dot>(data, skip_reshape);
+
+    auto callback = [data, dq_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_packed_matmul against node = "
+                     << m.get_match_root()->get_name();
+        auto pvm = m.get_pattern_value_map();
+        auto dot = m.get_match_root_as<ngraph::op::v0::Dot>();
+        NGRAPH_CHECK(
+            dot, "match root node ", *m.get_match_root(), " not of type `ngraph::op::v0::Dot`");
+        auto dq_m = as_type_ptr<ngraph::op::v0::Dequantize>(pvm[dq_label].get_node_shared_ptr());
+        auto weights_m = as_type_ptr<ngraph::op::v0::Constant>(dq_m->get_argument(0));
+        auto type = weights_m->get_output_element_type(0);
+        if ((type != element::u4 && type != element::i4) ||
+            dq_m->get_output_element_type(0) != element::f32 ||
+            dot->get_reduction_axes_count() != 1 || weights_m->get_output_shape(0).size() != 2)
+        {
+            NGRAPH_DEBUG << "Not a matrix product with 4-bit weights";
+            return false;
+        }
+
+        // The weights are [K, N], or [N, K] when the Dot reads them through a transpose
+        bool transposed = false;
+        if (auto reshape = as_type_ptr<ngraph::op::v0::Reshape>(dot->get_argument(1)))
+        {
+            if (reshape->get_input_order() != AxisVector{1, 0})
+            {
+                NGRAPH_DEBUG << "Weights reshape is not a transpose";
+                return false;
+            }
+            transposed = true;
+        }
+
+        auto& shape = weights_m->get_output_shape(0);
+        size_t depth = transposed ? shape[1] : shape[0];
+        size_t channels = transposed ? shape[0] : shape[1];
+        auto axes = dq_m->get_axes();
+        if (!axes.empty() && axes != AxisSet{transposed ? 0u : 1u})
+        {
+            NGRAPH_DEBUG << "Weights are not quantized per output channel";
+            return false;
+        }
+
+        auto packed_weights = weights_m;
+        if (!transposed)
+        {
+            // Store one row of K weights per output channel
+            std::vector<uint8_t> buffer(packed::byte_size(type, channels * depth));
+            auto source = weights_m->get_data_ptr();
+            for (size_t k = 0; k < depth; k++)
+            {
+                for (size_t n = 0; n < channels; n++)
+                {
+                    auto value = packed::get(type, source, k * channels + n);
+                    packed::set(type, buffer.data(), n * depth + k, value);
+                }
+            }
+            packed_weights = std::make_shared<ngraph::op::v0::Constant>(
+                type, Shape{channels, depth}, buffer.data());
+        }
+
+        auto packed_matmul = std::make_shared<ngraph::op::PackedMatmul>(
+            pvm[data], packed_weights, dq_m->input_value(1), dq_m->input_value(2));
+        m.get_match_value().replace(packed_matmul->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(pdot, "CPUPreFusion.PackedMatmul");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_batch_norm_relu()
 {
     auto input_shape = Shape{1, 2, 2, 2};
@@ -2607,3 +2695,117 @@ void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_quantized_matmul()
     auto m = std::make_shared<pattern::Matcher>(q_dot, "CPUQuantFusion.QDot");
     this->add_matcher(m, callback);
 }
+
+// Convolution over Dequantize inputs + Quantize + Dequantize, as emitted by
+// PostTrainingQuantization -> QuantizedConvolutionBias + Dequantize
+void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qdq_conv()
+{
+    Shape shape{2, 2, 1, 1};
+    auto q_output = std::make_shared<pattern::op::Label>(
+        element::i8, shape, pattern::has_class<ngraph::op::v0::Quantize>());
+    auto dq_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto dq_zp = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto dq = std::make_shared<ngraph::op::v0::Dequantize>(
+        q_output, dq_scale, dq_zp, element::f32, AxisSet{});
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_qdq_conv against "
+                     << m.get_match_root()->get_name();
+
+        auto dq_m = m.get_match_root_as<ngraph::op::v0::Dequantize>();
+        NGRAPH_CHECK(dq_m,
+                     "match root node ",
+                     *m.get_match_root(),
+                     " not of type `ngraph::op::v0::Dequantize`");
+        auto q_m = std::static_pointer_cast<ngraph::op::v0::Quantize>(dq_m->get_argument(0));
+        auto conv_m = as_type_ptr<ngraph::op::v0::Convolution>(q_m->get_argument(0));
+        if (!conv_m || q_m->input_value(0).get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "Quantized value is not the sole use of a Convolution";
+            return false;
+        }
+
+        auto data_dq = as_type_ptr<ngraph::op::v0::Dequantize>(conv_m->get_argument(0));
+        auto filters_dq = as_type_ptr<ngraph::op::v0::Dequantize>(conv_m->get_argument(1));
+        if (!data_dq || !filters_dq)
+        {
+            NGRAPH_DEBUG << "Convolution inputs are not dequantized";
+            return false;
+        }
+
+        auto data_scale = as_type_ptr<ngraph::op::v0::Constant>(data_dq->get_argument(1));
+        auto filters_scale = as_type_ptr<ngraph::op::v0::Constant>(filters_dq->get_argument(1));
+        auto output_scale = as_type_ptr<ngraph::op::v0::Constant>(q_m->get_argument(1));
+        if (!data_scale || !filters_scale || !output_scale ||
+            !filters_dq->get_argument(0)->is_constant())
+        {
+            NGRAPH_DEBUG << "Scales and filters must be constant";
+            return false;
+        }
+
+        if (!(ngraph::is_zero(data_dq->get_argument(2)) &&
+              ngraph::is_zero(filters_dq->get_argument(2)) &&
+              ngraph::is_zero(q_m->get_argument(2))))
+        {
+            NGRAPH_DEBUG << "Non-zero zero points";
+            return false;
+        }
+
+        auto channels = conv_m->get_input_shape(1)[0];
+        auto data_type = data_dq->get_input_element_type(0);
+        if ((data_type != element::u8 && data_type != element::i8) ||
+            filters_dq->get_input_element_type(0) != element::i8 ||
+            q_m->get_output_element_type(0) != element::i8 ||
+            shape_size(data_scale->get_output_shape(0)) != 1 ||
+            shape_size(output_scale->get_output_shape(0)) != 1 || !q_m->get_axes().empty() ||
+            !(filters_dq->get_axes().empty() ||
+              (filters_dq->get_axes() == AxisSet{0} &&
+               shape_size(filters_scale->get_output_shape(0)) == channels)) ||
+            q_m->get_round_mode() !=
+                ngraph::op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN)
+        {
+            NGRAPH_DEBUG << "Unsupported quantization parameters";
+            return false;
+        }
+
+        if (!runtime::cpu::dnnl_utils::can_use_dnnl_conv<ngraph::op::v0::Convolution>(
+                conv_m.get()))
+        {
+            NGRAPH_DEBUG << "Convolution not supported by DNNL";
+            return false;
+        }
+
+        // Per output channel requantization: data_scale * filters_scale[c] / output_scale
+        auto filters_scales = filters_scale->get_vector<float>();
+        float data_output_scale =
+            data_scale->get_vector<float>()[0] / output_scale->get_vector<float>()[0];
+        std::vector<float> requantization_scales(channels);
+        for (size_t c = 0; c < channels; c++)
+        {
+            requantization_scales[c] =
+                data_output_scale * filters_scales[filters_scales.size() == 1 ? 0 : c];
+        }
+
+        auto qconv_n = std::make_shared<ngraph::op::v0::QuantizedConvolutionBias>(
+            data_dq->input_value(0),
+            filters_dq->input_value(0),
+            builder::make_constant<int32_t>(element::i32, Shape{channels}, 0),
+            conv_m->get_window_movement_strides(),
+            conv_m->get_window_dilation_strides(),
+            conv_m->get_padding_below(),
+            conv_m->get_padding_above(),
+            conv_m->get_data_dilation_strides(),
+            op::v0::Constant::create(element::f32, Shape{channels}, requantization_scales),
+            false);
+        auto dq_n = std::make_shared<ngraph::op::v0::Dequantize>(qconv_n,
+                                                                 dq_m->input_value(1),
+                                                                 dq_m->input_value(2),
+                                                                 dq_m->get_output_element_type(0),
+                                                                 dq_m->get_axes());
+        m.get_match_value().replace(dq_n->output(0));
+        return true;
+    };
+
+    this->add_matcher(std::make_shared<pattern::Matcher>(dq, "CPUQuantFusion.QDQConv"),
+                      callback);
+}
@@ -44,10 +44,12 @@ public:
         : GraphRewrite()
     {
         construct_maxpool_relu_switch();
+        construct_packed_matmul();
     }
 
 private:
     void construct_maxpool_relu_switch();
+    void construct_packed_matmul();
 };
 
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUFusion : public ngraph::pass::GraphRewrite
@@ -139,6 +141,7 @@ public:
         construct_qconvb_add();
         construct_dq_q();
         construct_quantized_matmul();
+        construct_qdq_conv();
     }
 
 private:
@@ -149,4 +152,5 @@ private:
     void construct_dq_q();
     void construct_qconvb_add();
     void construct_quantized_matmul();
+    void construct_qdq_conv();
 };
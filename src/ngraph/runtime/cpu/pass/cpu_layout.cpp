@@ -19,6 +19,9 @@
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <dnnl.hpp>
 
@@ -282,6 +285,91 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
     }
 }
 
+// Estimates the layouts that the consumers of `node` will ask for. Users that pass their input
+// layout on (elementwise ops) are followed up to a fixed depth, every other consumer adds the
+// bytes it reads to `blocked_bytes` if it is a DNNL kernel and to `native_bytes` otherwise.
+static void estimate_layout_demand(const std::shared_ptr<ngraph::Node>& node,
+                                   size_t& blocked_bytes,
+                                   size_t& native_bytes)
+{
+    const size_t max_depth = 8;
+    std::unordered_set<Node*> visited{node.get()};
+    std::vector<std::pair<Node*, size_t>> stack{{node.get(), 0}};
+    while (!stack.empty())
+    {
+        auto current = stack.back();
+        stack.pop_back();
+        for (auto& output : current.first->outputs())
+        {
+            size_t bytes = shape_size(output.get_shape()) * output.get_element_type().size();
+            for (auto& input : output.get_target_inputs())
+            {
+                auto user = input.get_node();
+                if (!visited.insert(user).second)
+                {
+                    continue;
+                }
+                if (!is_type<ngraph::op::v0::Result>(user) &&
+                    (user->is_unary_elementwise_arithmetic() ||
+                     user->is_binary_elementwise_arithmetic()) &&
+                    current.second < max_depth)
+                {
+                    stack.push_back({user, current.second + 1});
+                }
+                else if (dnnl_utils::use_dnnl_kernel(user))
+                {
+                    blocked_bytes += bytes;
+                }
+                else
+                {
+                    native_bytes += bytes;
+                }
+            }
+        }
+    }
+}
+
+// Picks the input whose layout a binary elementwise op propagates. Converting either input costs
+// the same, so the choice only affects the reorders needed downstream: a native layout is kept
+// when more of the consumers read native data than DNNL-blocked data. Ties keep the first input.
+static int select_binaryeltwise_layout(const std::shared_ptr<ngraph::Node>& node,
+                                       const std::vector<dnnl::memory::desc>& arg_mds)
+{
+    static const int32_t user_select = getenv_int("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
+    if (user_select == 0 || user_select == 1)
+    {
+        return user_select;
+    }
+    if (dnnl_utils::compare_dnnl_mds(arg_mds[0], arg_mds[1]))
+    {
+        return 0;
+    }
+
+    bool native[2];
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto native_md = dnnl_utils::create_blocked_dnnl_md(
+            node->get_input_shape(i),
+            ngraph::row_major_strides(node->get_input_shape(i)),
+            node->get_input_element_type(i));
+        native[i] = dnnl_utils::compare_dnnl_mds(arg_mds[i], native_md);
+    }
+    if (native[0] == native[1])
+    {
+        return 0;
+    }
+
+    size_t blocked_bytes = 0;
+    size_t native_bytes = 0;
+    estimate_layout_demand(node, blocked_bytes, native_bytes);
+    if (native_bytes == blocked_bytes)
+    {
+        return 0;
+    }
+    int native_index = native[0] ? 0 : 1;
+    return native_bytes > blocked_bytes ? native_index : 1 - native_index;
+}
+
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
                                std::shared_ptr<ngraph::Node> node)
 {
@@ -300,8 +388,7 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
     {
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
-        const int32_t user_select = getenv_int("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
-        int select = (user_select == 0 || user_select == 1) ? user_select : 0;
+        int select = select_binaryeltwise_layout(node, arg_mds);
         i_mds.push_back(arg_mds[select]);
         i_mds.push_back(arg_mds[select]);
         o_mds.push_back(arg_mds[select]);
@@ -1686,6 +1773,24 @@ namespace ngraph
                     return true;
                 }
 
+                // A transpose that only moves size-1 axes keeps the elements in the same order
+                static bool is_order_preserving_transpose(const ngraph::op::v0::Reshape* reshape)
+                {
+                    auto input_shape = reshape->get_input_shape(0);
+                    size_t last_axis = 0;
+                    bool first = true;
+                    for (auto axis : reshape->get_input_order())
+                    {
+                        if (input_shape[axis] == 1)
+                            continue;
+                        if (!first && axis < last_axis)
+                            return false;
+                        last_axis = axis;
+                        first = false;
+                    }
+                    return true;
+                }
+
                 static bool can_be_squeezed(const ngraph::op::v0::Reshape* reshape,
                                             const dnnl::memory::desc& md,
                                             AxisVector& squeezed_axis)
@@ -1798,14 +1903,15 @@ namespace ngraph
                         }
                         else
                         {
-                            if (!reshape->get_is_transpose())
+                            if (!reshape->get_is_transpose() ||
+                                is_order_preserving_transpose(reshape))
                                 skip_reshape = true;
                         }
                     }
                     else
                     {
                         // Input is in row-major layout
-                        if (reshape->get_is_transpose())
+                        if (reshape->get_is_transpose() && !is_order_preserving_transpose(reshape))
                         {
                             auto input_strides = cpu_tvl->get_strides();
                             auto axis_order = reshape->get_input_order();
@@ -2116,7 +2222,7 @@ namespace ngraph
                             }
                             else if (input_md.data.ndims == 4 &&
                                      dnnl_utils::dnnl_md_matches_format_tag(
-                                         input_md, dnnl::memory::format_tag::nchw))
+                                         input_md, dnnl::memory::format_tag::nhwc))
                             {
                                 result_format = dnnl::memory::format_tag::nhwc;
                             }
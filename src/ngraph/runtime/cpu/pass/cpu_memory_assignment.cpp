@@ -20,6 +20,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/pad.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
@@ -317,6 +318,44 @@ void runtime::cpu::pass::CPUMemoryAssignment::propagate_in_place_slice(const Inp
     }
 }
 
+void runtime::cpu::pass::CPUMemoryAssignment::process_in_place_pad(NodeVector nodes)
+{
+    for (shared_ptr<Node>& node : nodes)
+    {
+        auto pad = as_type_ptr<op::v0::Pad>(node);
+        if (!pad || !pad->get_op_annotations() ||
+            pad->get_op_annotations()->get_in_place_oi_pairs().size() == 0)
+        {
+            continue;
+        }
+        auto input_tensor = &pad->input_value(0).get_tensor();
+        auto output_tensor = &pad->get_output_tensor(0);
+        // same set, in place pad allowed
+        if (get_bufferID(input_tensor) != get_bufferID(output_tensor))
+        {
+            continue;
+        }
+
+        // Only one axis is padded and the axes before it have size 1, so the elements below the
+        // input are the padding of that axis times the size of the axes after it
+        auto in_shape = pad->get_input_shape(0);
+        auto padding_below = pad->get_padding_below();
+        size_t start = 0, accumulated = 1;
+        for (int i = in_shape.size() - 1; i >= 0; i--)
+        {
+            start += padding_below[i] * accumulated;
+            accumulated *= in_shape[i];
+        }
+
+        auto old_offset = input_tensor->get_pool_offset();
+        auto offset =
+            output_tensor->get_pool_offset() + pad->get_output_element_type(0).size() * start;
+        input_tensor->set_pool_offset(offset);
+        NGRAPH_DEBUG << "cpu_memory_assignment: pad, change offset, old offset is " << old_offset
+                     << ", new offset is " << offset;
+    }
+}
+
 // This function processes each node and puts its output tensors into one buffer set accordingly.
 // All the tensors in the same buffer set share the same memory buffer.
 // Output tensor is put into the set of input tensor when the operation is non-destructive in-place.
@@ -391,14 +430,20 @@ void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(NodeVector&
                 {
                     auto cacheable = op_annotations->is_cacheable();
 
-                    // in place concat
-                    if (is_type<op::v0::Concat>(node))
+                    // in place concat and pad, the arguments are written into the output
+                    if (is_type<op::v0::Concat>(node) || is_type<op::v0::Pad>(node))
                     {
                         auto output_tensor = &node->get_output_tensor(0);
                         auto ele = std::pair<TensorRole, unordered_set<descriptor::Tensor*>>(
                             TensorRole::INTERMEDIATE,
                             unordered_set<descriptor::Tensor*>({output_tensor}));
-                        for (auto& arg : node->input_values())
+                        auto args = node->input_values();
+                        if (is_type<op::v0::Pad>(node))
+                        {
+                            // the padding value is not part of the output
+                            args.resize(1);
+                        }
+                        for (auto& arg : args)
                         {
                             // when reusing memory, check cacheability
                             if (!m_disable_memory_sharing)
@@ -819,6 +864,9 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     // In place slice optimization
     process_in_place_slice(ops);
 
+    // In place pad optimization
+    process_in_place_pad(ops);
+
     // update the offset for intermediate tensors in tensor_caching
     auto start = mm.max_allocated();
     for (auto item : m_tensor_caching)
@@ -61,6 +61,10 @@ private:
     // propagate slice when its arg comes from function input
     void propagate_in_place_slice(const ngraph::Input<ngraph::Node>& input);
 
+    // Find in-place pad ops and set the memory pool offset of their argument to the middle of
+    // their output
+    void process_in_place_pad(NodeVector nodes);
+
     // build buffer sets maps
     void build_buffer_sets_maps(NodeVector& ops);
 
@@ -48,20 +48,123 @@
 ///
 /// After optimization: the result of add1 is stored to the memory buffer assigned to concat, same
 /// for add2 and add3.
+///
+/// In-place-pad optimization works the same way for a constant pad that only pads one axis, with
+/// all the axes before it of size 1: the argument node writes its output into the middle of the
+/// pad node's memory buffer, and the pad node only fills the borders.
+///
+/// In-place elementwise optimization lets an elementwise node overwrite an input of the same shape
+/// and element type. The memory assignment pass only does so when the node is the last user of the
+/// input in execution order, so inputs with several users are overwritten by the last one.
 
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 
+#include <set>
+#include <unordered_map>
+
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/ceiling.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/pad.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 
 using namespace ngraph;
 
+// Elementwise ops whose kernels compute each output element from the input elements at the same
+// index, so the output may overwrite an input of the same shape and element type
+static bool is_in_place_elementwise(const Node& node)
+{
+    static const std::set<NodeTypeInfo> elementwise_ops{op::v0::Abs::type_info,
+                                                        op::v0::Ceiling::type_info,
+                                                        op::v0::Cos::type_info,
+                                                        op::v0::Cosh::type_info,
+                                                        op::v0::Exp::type_info,
+                                                        op::v0::Floor::type_info,
+                                                        op::v0::Log::type_info,
+                                                        op::v0::Negative::type_info,
+                                                        op::v0::Sign::type_info,
+                                                        op::v0::Sin::type_info,
+                                                        op::v0::Sinh::type_info,
+                                                        op::v0::Sqrt::type_info,
+                                                        op::v0::Tan::type_info,
+                                                        op::v0::Tanh::type_info,
+                                                        op::v1::Add::type_info,
+                                                        op::v1::Divide::type_info,
+                                                        op::v1::Maximum::type_info,
+                                                        op::v1::Minimum::type_info,
+                                                        op::v1::Multiply::type_info,
+                                                        op::v1::Power::type_info,
+                                                        op::v1::Subtract::type_info};
+    return elementwise_ops.count(node.get_type_info()) != 0;
+}
+
+// True if an output of the node shares the memory buffer of one of its inputs
+static bool is_in_place_view(const Node* node)
+{
+    if (!node->is_op())
+    {
+        return false;
+    }
+    auto op_annotations = static_cast<const ngraph::op::Op*>(node)->get_op_annotations();
+    if (op_annotations)
+    {
+        for (auto& oi_pair : op_annotations->get_in_place_oi_pairs())
+        {
+            if (!oi_pair.destructive)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void add_in_place_oi_pair(const std::shared_ptr<Node>& node,
+                                 const ngraph::op::util::oi_pair& oi_pair)
+{
+    auto op = std::static_pointer_cast<ngraph::op::Op>(node);
+    auto op_annotations = op->get_op_annotations();
+    if (!op_annotations)
+    {
+        op_annotations = std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+        op->set_op_annotations(op_annotations);
+    }
+    op_annotations->add_in_place_oi_pair(oi_pair);
+}
+
+static bool is_native_layout(const descriptor::Tensor& tensor)
+{
+    auto cpu_tvl =
+        std::dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(tensor.get_tensor_layout());
+    return cpu_tvl && !cpu_tvl->is_dnnl_layout();
+}
+
 bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<Function> function)
 {
     for (auto n : function->get_ordered_ops())
@@ -316,5 +419,155 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
             }
         }
     }
+
+    for (auto n : function->get_ordered_ops())
+    {
+        auto pad = as_type_ptr<op::v0::Pad>(n);
+        if (!pad || pad->get_pad_mode() != op::PadMode::CONSTANT)
+        {
+            continue;
+        }
+        auto in_shape = pad->get_input_shape(0);
+        auto padding_below = pad->get_padding_below();
+        auto padding_above = pad->get_padding_above();
+        bool padded = false;
+        bool in_place_pad = true;
+        size_t product = 1;
+        for (size_t i = 0; i < in_shape.size() && in_place_pad; i++)
+        {
+            if (padding_below[i] < 0 || padding_above[i] < 0)
+            {
+                NGRAPH_DEBUG << "cpu_memory_optimization: negative padding, no in place pad";
+                in_place_pad = false;
+            }
+            else if (padding_below[i] != 0 || padding_above[i] != 0)
+            {
+                // The input is contiguous in the output only when a single axis is padded and
+                // all axes before it have size 1
+                if (padded || product != 1)
+                {
+                    NGRAPH_DEBUG << "cpu_memory_optimization: input is not contiguous in output, "
+                                    "no in place pad";
+                    in_place_pad = false;
+                }
+                padded = true;
+            }
+            product *= in_shape[i];
+        }
+        if (!in_place_pad || !padded)
+        {
+            continue;
+        }
+
+        if (!is_native_layout(pad->get_input_tensor(0)) ||
+            !is_native_layout(pad->get_output_tensor(0)))
+        {
+            NGRAPH_DEBUG << "cpu_memory_optimization: non-native layout, no in place pad";
+            continue;
+        }
+
+        auto output = pad->input_value(0);
+        auto arg = output.get_node_shared_ptr();
+        if (!arg->is_op() || arg->is_constant() || arg->is_parameter() ||
+            is_type<op::v0::Concat>(arg) || is_in_place_view(arg.get()))
+        {
+            NGRAPH_DEBUG << "cpu_memory_optimization: " << arg->get_name()
+                         << ": not a plain op, no in place pad";
+            continue;
+        }
+        auto arg_annotations = std::static_pointer_cast<ngraph::op::Op>(arg)->get_op_annotations();
+        if (arg_annotations && arg_annotations->get_in_place_oi_pairs().size() > 0)
+        {
+            NGRAPH_DEBUG << "cpu_memory_optimization: " << arg->get_name()
+                         << ": in place op, no in place pad";
+            continue;
+        }
+        if (output.get_target_inputs().size() != 1)
+        {
+            NGRAPH_DEBUG << "cpu_memory_optimization: multiple users, no in place pad";
+            continue;
+        }
+        // In place concat moves the output of its arguments
+        bool feeds_in_place_concat = false;
+        for (auto user : pad->get_users())
+        {
+            feeds_in_place_concat |= is_type<op::v0::Concat>(user) && is_in_place_view(user.get());
+        }
+        if (feeds_in_place_concat)
+        {
+            NGRAPH_DEBUG << "cpu_memory_optimization: in place concat user, no in place pad";
+            continue;
+        }
+
+        add_in_place_oi_pair(pad, {0, 0, false});
+    }
+
+    // Elementwise ops overwrite an input when they are its last user
+    std::unordered_map<Node*, size_t> positions;
+    size_t position = 0;
+    for (auto n : function->get_ordered_ops())
+    {
+        positions[n.get()] = position++;
+    }
+    for (auto n : function->get_ordered_ops())
+    {
+        if (!is_in_place_elementwise(*n) ||
+            n->get_output_element_type(0) != n->get_input_element_type(0))
+        {
+            continue;
+        }
+        auto op_annotations = std::static_pointer_cast<ngraph::op::Op>(n)->get_op_annotations();
+        if (dnnl_utils::use_dnnl_kernel(n.get()) ||
+            (op_annotations && op_annotations->get_in_place_oi_pairs().size() > 0))
+        {
+            continue;
+        }
+        bool moved_output = false;
+        for (auto user : n->get_users())
+        {
+            moved_output |= (is_type<op::v0::Concat>(user) || is_type<op::v0::Pad>(user)) &&
+                            is_in_place_view(user.get());
+        }
+        if (moved_output)
+        {
+            NGRAPH_DEBUG << "cpu_memory_optimization: " << n->get_name()
+                         << ": output is placed by its user, no in place elementwise";
+            continue;
+        }
+
+        for (size_t i = 0; i < n->get_input_size(); i++)
+        {
+            auto input = n->input_value(i);
+            auto arg = input.get_node();
+            if (input.get_shape() != n->get_output_shape(0) || arg->is_constant() ||
+                arg->is_parameter() || is_in_place_view(arg))
+            {
+                continue;
+            }
+            auto users = input.get_target_inputs();
+            if (!m_ordered_execution && users.size() != 1)
+            {
+                continue;
+            }
+            bool last_user = true;
+            for (auto& user : users)
+            {
+                auto user_node = user.get_node();
+                // Views of the input alias it after this op has run
+                if (is_in_place_view(user_node) || positions[user_node] > positions[n.get()])
+                {
+                    last_user = false;
+                    break;
+                }
+            }
+            if (last_user)
+            {
+                NGRAPH_DEBUG << "cpu_memory_optimization: " << n->get_name()
+                             << ": overwrites input " << i;
+                add_in_place_oi_pair(n, {0, i, true});
+                break;
+            }
+        }
+    }
     return false;
 }
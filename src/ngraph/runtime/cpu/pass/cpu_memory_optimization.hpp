@@ -29,7 +29,17 @@ namespace ngraph
                 class CPUMemoryOptimization : public ngraph::pass::FunctionPass
                 {
                 public:
+                    /// \param ordered_execution Ops run one at a time in topological order, so an
+                    ///        elementwise op may overwrite an input whose other users already ran.
+                    ///        Otherwise only inputs with a single user are overwritten.
+                    CPUMemoryOptimization(bool ordered_execution = true)
+                        : m_ordered_execution(ordered_execution)
+                    {
+                    }
                     bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    bool m_ordered_execution;
                 };
             }
         }
@@ -31,6 +31,7 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
@@ -275,16 +276,12 @@ void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::
 }
 
 // fold Constant + ConvertLayout to Constant
-template <typename T>
-static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout_helper(
+static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout(
     const shared_ptr<op::v0::Constant>& input,
     const shared_ptr<runtime::cpu::op::ConvertLayout>& convertlayout,
     dnnl::memory::desc& input_desc,
     dnnl::memory::desc& result_desc)
 {
-    std::vector<T> result_vec(convertlayout->get_output_tensor(0).size() /
-                              input->get_output_element_type(0).size());
-
     bool input_format_is_nchw = runtime::cpu::dnnl_utils::dnnl_md_matches_format_tag(
         input_desc.data, dnnl::memory::format_tag::nchw);
     if (input_format_is_nchw && runtime::cpu::dnnl_utils::dnnl_md_matches_format_tag(
@@ -330,11 +327,22 @@ static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout_helper(
             dnnl::memory::format_tag::goihw);
     }
 
-    // build dnnl primitive and execute
+    // A reorder between identical layouts is a copy, the folded Constant shares the data of
+    // the input instead
+    if (runtime::cpu::dnnl_utils::compare_dnnl_mds(input_desc, result_desc))
+    {
+        return make_shared<ngraph::op::v0::Constant>(*input);
+    }
+
+    // build dnnl primitive and execute, the reorder writes straight into the storage of the
+    // folded Constant
+    auto result_buffer =
+        make_shared<runtime::AlignedBuffer>(convertlayout->get_output_tensor(0).size());
     dnnl::memory in{input_desc,
                     runtime::cpu::executor::global_cpu_engine,
                     const_cast<void*>(input->get_data_ptr())};
-    dnnl::memory out{result_desc, runtime::cpu::executor::global_cpu_engine, result_vec.data()};
+    dnnl::memory out{
+        result_desc, runtime::cpu::executor::global_cpu_engine, result_buffer->get_ptr()};
     dnnl::reorder reorder{in, out};
 
     std::unordered_map<int, dnnl::memory> exec_args = {{DNNL_ARG_SRC, in}, {DNNL_ARG_DST, out}};
@@ -350,8 +358,9 @@ static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout_helper(
         throw ngraph_error("Could not run mkdnn primitive " + std::string(e.message));
     }
 
-    return make_shared<ngraph::op::v0::Constant>(
-        convertlayout->get_output_element_type(0), convertlayout->get_output_shape(0), result_vec);
+    return make_shared<ngraph::op::v0::Constant>(convertlayout->get_output_element_type(0),
+                                                 convertlayout->get_output_shape(0),
+                                                 result_buffer);
 }
 
 bool ngraph::runtime::cpu::pass::CPUConvertLayoutConstantFolding::run_on_function(
@@ -377,77 +386,13 @@ bool ngraph::runtime::cpu::pass::CPUConvertLayoutConstantFolding::run_on_functio
                 auto m_input = static_pointer_cast<ngraph::op::v0::Constant>(arg);
                 auto input_md = dnnl_utils::get_input_dnnl_md(m_convertlayout.get(), 0);
 
-                std::shared_ptr<ngraph::op::v0::Constant> replacement;
-
-                switch (m_input->get_output_element_type(0))
-                {
-                case element::Type_t::undefined:
-                    NGRAPH_CHECK(
-                        false,
-                        "Encountered 'undefined' element type in construct_constant_convertlayout");
-                    break;
-                case element::Type_t::dynamic:
-                    NGRAPH_CHECK(
-                        false,
-                        "Encountered 'dynamic' element type in construct_constant_convertlayout");
-                    break;
-                case element::Type_t::u1:
-                    NGRAPH_CHECK(
-                        false, "Encountered 'u1' element type in construct_constant_convertlayout");
-                    break;
-                case element::Type_t::boolean:
-                    replacement = fold_constant_convertlayout_helper<char>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::bf16:
-                    replacement = fold_constant_convertlayout_helper<bfloat16>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::f16:
-                    replacement = fold_constant_convertlayout_helper<float16>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::f32:
-                    replacement = fold_constant_convertlayout_helper<float>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::f64:
-                    replacement = fold_constant_convertlayout_helper<double>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i8:
-                    replacement = fold_constant_convertlayout_helper<int8_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i16:
-                    replacement = fold_constant_convertlayout_helper<int16_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i32:
-                    replacement = fold_constant_convertlayout_helper<int32_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i64:
-                    replacement = fold_constant_convertlayout_helper<int64_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u8:
-                    replacement = fold_constant_convertlayout_helper<uint8_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u16:
-                    replacement = fold_constant_convertlayout_helper<uint16_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u32:
-                    replacement = fold_constant_convertlayout_helper<uint32_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u64:
-                    replacement = fold_constant_convertlayout_helper<uint64_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                }
+                const element::Type& et = m_input->get_output_element_type(0);
+                NGRAPH_CHECK(et.is_static() && et != element::u1,
+                             "Encountered '",
+                             et,
+                             "' element type in construct_constant_convertlayout");
+                auto replacement =
+                    fold_constant_convertlayout(m_input, m_convertlayout, input_md, output_md);
 
                 auto tv = replacement->get_output_tensor_ptr(0);
                 auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
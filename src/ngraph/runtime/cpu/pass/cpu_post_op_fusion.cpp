@@ -0,0 +1,267 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+
+#include "cpu_post_op_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/conv_fused.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/gelu.hpp"
+#include "ngraph/op/group_conv.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Algorithm = runtime::cpu::PostOp::Algorithm;
+
+static bool is_post_op_producer(const shared_ptr<Node>& node)
+{
+    static const unordered_set<NodeTypeInfo> producers{op::v0::Convolution::type_info,
+                                                       op::v0::ConvolutionBias::type_info,
+                                                       op::v0::ConvolutionBiasAdd::type_info,
+                                                       op::ConvolutionRelu::type_info,
+                                                       op::ConvolutionAdd::type_info,
+                                                       op::v0::GroupConvolution::type_info,
+                                                       op::GroupConvolutionBias::type_info};
+
+    return producers.count(node->get_type_info()) != 0 && node->get_output_size() == 1 &&
+           node->get_output_element_type(0) == element::f32 &&
+           runtime::cpu::dnnl_utils::use_dnnl_kernel(node.get());
+}
+
+// Matches a constant, possibly broadcast, whose elements all hold the same f32 value
+static bool get_scalar_value(const Output<Node>& output, float& value)
+{
+    auto node = output.get_node_shared_ptr();
+    if (auto broadcast = as_type_ptr<op::v0::Broadcast>(node))
+    {
+        node = broadcast->get_argument(0);
+    }
+    auto constant = as_type_ptr<op::v0::Constant>(node);
+    if (!constant || constant->get_output_element_type(0) != element::f32 ||
+        !constant->get_all_data_elements_bitwise_identical())
+    {
+        return false;
+    }
+    value = constant->get_data_ptr<float>()[0];
+    return true;
+}
+
+// Maps an op consuming `source` to a post-op and returns the node whose output carries the
+// post-op result, or nullptr when the op cannot be expressed as a DNNL eltwise post-op.
+static shared_ptr<Node> match_post_op(const Output<Node>& source,
+                                      const shared_ptr<Node>& user,
+                                      runtime::cpu::PostOp& post_op)
+{
+    if (user->get_output_size() != 1 || user->get_output_element_type(0) != element::f32 ||
+        user->get_output_shape(0) != source.get_shape() ||
+        !user->get_control_dependencies().empty())
+    {
+        return nullptr;
+    }
+
+    auto set = [&post_op](Algorithm algorithm, float alpha, float beta) {
+        post_op.algorithm = algorithm;
+        post_op.alpha = alpha;
+        post_op.beta = beta;
+    };
+
+    if (is_type<op::v0::Relu>(user))
+    {
+        set(Algorithm::Relu, 0.f, 0.f);
+    }
+    else if (auto leaky_relu = as_type_ptr<op::CPULeakyRelu>(user))
+    {
+        set(Algorithm::Relu, leaky_relu->get_alpha(), 0.f);
+    }
+    else if (auto bounded_relu = as_type_ptr<op::BoundedRelu>(user))
+    {
+        set(Algorithm::BoundedRelu, bounded_relu->get_alpha(), 0.f);
+    }
+    else if (is_type<op::v0::Tanh>(user))
+    {
+        set(Algorithm::Tanh, 0.f, 0.f);
+    }
+    else if (is_type<op::v0::Exp>(user))
+    {
+        set(Algorithm::Exp, 0.f, 0.f);
+    }
+    else if (is_type<op::v0::Abs>(user))
+    {
+        set(Algorithm::Abs, 0.f, 0.f);
+    }
+    else if (is_type<op::v0::Sqrt>(user))
+    {
+        set(Algorithm::Sqrt, 0.f, 0.f);
+    }
+    else if (is_type<op::v0::Log>(user))
+    {
+        set(Algorithm::Log, 0.f, 0.f);
+    }
+    else if (is_type<op::v0::Gelu>(user))
+    {
+        set(Algorithm::Gelu, 0.f, 0.f);
+    }
+    else if (is_type<op::v0::Sigmoid>(user))
+    {
+        // x * Sigmoid(x) is Swish, provided the multiply is the sigmoid's only user
+        auto sigmoid_users = user->output(0).get_target_inputs();
+        if (sigmoid_users.size() == 1)
+        {
+            auto multiply = sigmoid_users.begin()->get_node()->shared_from_this();
+            if (is_type<op::v1::Multiply>(multiply) &&
+                multiply->input_value(1 - sigmoid_users.begin()->get_index()) == source &&
+                multiply->get_output_shape(0) == source.get_shape() &&
+                multiply->get_control_dependencies().empty())
+            {
+                set(Algorithm::Swish, 1.f, 0.f);
+                return multiply;
+            }
+        }
+        set(Algorithm::Logistic, 0.f, 0.f);
+    }
+    else if (user->get_input_size() == 2 &&
+             (is_type<op::v1::Multiply>(user) || is_type<op::v1::Add>(user) ||
+              is_type<op::v1::Subtract>(user) || is_type<op::v1::Divide>(user)))
+    {
+        // Scaling or shifting by a scalar maps onto DNNL's linear eltwise, alpha * x + beta
+        size_t source_index = user->input_value(0) == source ? 0 : 1;
+        float value;
+        if (user->input_value(source_index) != source ||
+            user->input_value(1 - source_index) == source ||
+            !get_scalar_value(user->input_value(1 - source_index), value))
+        {
+            return nullptr;
+        }
+
+        if (is_type<op::v1::Multiply>(user))
+        {
+            set(Algorithm::Linear, value, 0.f);
+        }
+        else if (is_type<op::v1::Add>(user))
+        {
+            set(Algorithm::Linear, 1.f, value);
+        }
+        else if (is_type<op::v1::Subtract>(user) && source_index == 0)
+        {
+            set(Algorithm::Linear, 1.f, -value);
+        }
+        else if (is_type<op::v1::Subtract>(user))
+        {
+            set(Algorithm::Linear, -1.f, value);
+        }
+        else if (source_index == 0)
+        {
+            set(Algorithm::Linear, 1.f / value, 0.f);
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+    else
+    {
+        return nullptr;
+    }
+    return user;
+}
+
+bool runtime::cpu::pass::CPUPostOpFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto node : function->get_ordered_ops())
+    {
+        if (!is_post_op_producer(node))
+        {
+            continue;
+        }
+
+        auto annotations = static_pointer_cast<CPUOpAnnotations>(
+            static_pointer_cast<ngraph::op::Op>(node)->get_op_annotations());
+        // Absorbed ops keep their input connections, so their inputs are skipped below
+        unordered_set<Node*> absorbed;
+        while (true)
+        {
+            vector<shared_ptr<Node>> users;
+            for (auto& target : node->output(0).get_target_inputs())
+            {
+                if (absorbed.count(target.get_node()) == 0)
+                {
+                    users.push_back(target.get_node()->shared_from_this());
+                }
+            }
+
+            PostOp post_op;
+            shared_ptr<Node> fused;
+            if (users.size() == 1)
+            {
+                fused = match_post_op(node->output(0), users[0], post_op);
+            }
+            else if (users.size() == 2)
+            {
+                // Swish consumes the producer twice, through the sigmoid and the multiply
+                for (auto& user : users)
+                {
+                    if (is_type<op::v0::Sigmoid>(user))
+                    {
+                        fused = match_post_op(node->output(0), user, post_op);
+                        if (fused && post_op.algorithm != Algorithm::Swish)
+                        {
+                            fused = nullptr;
+                        }
+                    }
+                }
+            }
+            if (!fused)
+            {
+                break;
+            }
+
+            NGRAPH_DEBUG << "CPUPostOpFusion: folding " << fused->get_name() << " into "
+                         << node->get_name();
+            annotations->add_post_op(post_op);
+            for (auto& user : users)
+            {
+                absorbed.insert(user.get());
+            }
+            replace_node(fused, node);
+            modified = true;
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Folds elementwise epilogues into the DNNL convolution that produces
+                /// their input.
+                ///
+                /// Each absorbed op is recorded as a post-op in the convolution's CPU
+                /// annotations and the DNNL emitter appends it to the primitive attributes, so
+                /// any chain of supported activations, Swish (x * Sigmoid(x)) and scalar
+                /// scale/shift ops runs inside the convolution kernel. Only f32 convolutions
+                /// already assigned to DNNL are considered.
+                class CPUPostOpFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
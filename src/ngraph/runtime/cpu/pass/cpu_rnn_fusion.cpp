@@ -22,6 +22,7 @@
 #include <unordered_set>
 
 #include "cpu_rnn_fusion.hpp"
+#include "ngraph/builder/split.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -32,7 +33,9 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/gru_cell.hpp"
 #include "ngraph/op/lstm_cell.hpp"
+#include "ngraph/op/lstm_sequence.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
@@ -41,10 +44,14 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/rnn_cell.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/squeeze.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tanh.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/op/unsqueeze.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/or.hpp"
@@ -71,6 +78,160 @@
 
 using namespace ngraph;
 
+static bool is_zero_constant(const Output<Node>& value)
+{
+    auto constant = as_type_ptr<ngraph::op::v0::Constant>(value.get_node_shared_ptr());
+    if (!constant)
+    {
+        return false;
+    }
+    for (auto v : constant->cast_vector<float>())
+    {
+        if (v != 0.f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Recurrent cells whose equations match the DNNL vanilla RNN, GRU and LSTM kernels
+static bool is_supported_cell(const Node& node)
+{
+    if (node.get_input_element_type(0) != element::f32)
+    {
+        return false;
+    }
+    if (auto gru = as_type<const ngraph::op::v3::GRUCell>(&node))
+    {
+        return gru->get_clip() == 0.f &&
+               gru->get_activations() == std::vector<std::string>{"sigmoid", "tanh"};
+    }
+    if (auto rnn = as_type<const ngraph::op::v0::RNNCell>(&node))
+    {
+        return rnn->get_clip() == 0.f && rnn->get_activations() == std::vector<std::string>{"tanh"};
+    }
+    if (auto lstm = as_type<const ngraph::op::v0::LSTMCell>(&node))
+    {
+        return lstm->get_clip() == 0.f && !lstm->get_input_forget() &&
+               lstm->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"};
+    }
+    return false;
+}
+
+// Reorders the gates of LSTM weights or bias, stacked along axis, to the IFCO order of DNNL
+static Output<Node>
+    reorder_lstm_gates(const Output<Node>& value, ngraph::op::LSTMWeightsFormat format, int axis)
+{
+    static const std::map<ngraph::op::LSTMWeightsFormat, std::vector<size_t>> gate_order{
+        {ngraph::op::LSTMWeightsFormat::FICO, {1, 0, 2, 3}},
+        {ngraph::op::LSTMWeightsFormat::ICOF, {0, 3, 1, 2}},
+        {ngraph::op::LSTMWeightsFormat::IFOC, {0, 1, 3, 2}},
+        {ngraph::op::LSTMWeightsFormat::IOFC, {0, 2, 3, 1}},
+    };
+    if (format == ngraph::op::LSTMWeightsFormat::IFCO)
+    {
+        return value;
+    }
+    auto gates = builder::split(value, 4, axis);
+    OutputVector ifco_gates;
+    for (auto gate : gate_order.at(format))
+    {
+        ifco_gates.push_back(gates.at(gate));
+    }
+    return std::make_shared<ngraph::op::v0::Concat>(ifco_gates, axis);
+}
+
+// ngraph keeps peephole weights in (i, o, f) order, DNNL takes them as (i, f, o)
+static Output<Node> reorder_peephole_gates(const Output<Node>& value, int axis)
+{
+    auto gates = builder::split(value, 3, axis);
+    return std::make_shared<ngraph::op::v0::Concat>(OutputVector{gates[0], gates[2], gates[1]},
+                                                    axis);
+}
+
+static Output<Node> transpose_2d(const Output<Node>& value)
+{
+    auto shape = value.get_shape();
+    return std::make_shared<ngraph::op::v0::Reshape>(
+        value, AxisVector{1, 0}, Shape{shape[1], shape[0]});
+}
+
+// Builds a single layer, single direction op::Rnn running the recurrence of cell over
+// num_timesteps steps. src_layer is {T * N, C}, the states are {N, H} and weights holds the
+// cell's W, R, B (and P for LSTM) in ngraph layout; they are transposed and reordered here into
+// the DNNL layout, which constant folding then packs once at compile time.
+static std::shared_ptr<ngraph::op::Rnn> make_rnn_for_cell(const Node& cell,
+                                                          const Output<Node>& src_layer,
+                                                          const Output<Node>& src_iter,
+                                                          const Output<Node>& src_iter_c,
+                                                          const OutputVector& weights,
+                                                          size_t num_timesteps)
+{
+    if (auto lstm = as_type<const ngraph::op::v0::LSTMCell>(&cell))
+    {
+        auto format = lstm->get_weights_format();
+        auto wei_layer = transpose_2d(reorder_lstm_gates(weights[0], format, 0));
+        auto wei_iter = transpose_2d(reorder_lstm_gates(weights[1], format, 0));
+        auto bias = reorder_lstm_gates(weights[2], format, 0);
+        if (is_zero_constant(weights[3]))
+        {
+            return std::make_shared<ngraph::op::Rnn>(
+                src_layer,
+                src_iter,
+                src_iter_c,
+                wei_layer,
+                wei_iter,
+                bias,
+                num_timesteps,
+                4,
+                num_timesteps,
+                2,
+                1,
+                1,
+                ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm);
+        }
+        return std::make_shared<ngraph::op::Rnn>(
+            src_layer,
+            src_iter,
+            src_iter_c,
+            wei_layer,
+            wei_iter,
+            bias,
+            reorder_peephole_gates(weights[3], 0),
+            num_timesteps,
+            4,
+            num_timesteps,
+            2,
+            1,
+            1,
+            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm);
+    }
+
+    // GRU gates are stored as (z, r, h), which is the (u, r, o) order of DNNL
+    size_t n_gates = 1;
+    auto rnn_type = ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_rnn;
+    if (auto gru = as_type<const ngraph::op::v3::GRUCell>(&cell))
+    {
+        n_gates = 3;
+        rnn_type = gru->get_linear_before_reset()
+                       ? ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru
+                       : ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+    }
+    return std::make_shared<ngraph::op::Rnn>(src_layer,
+                                             src_iter,
+                                             transpose_2d(weights[0]),
+                                             transpose_2d(weights[1]),
+                                             weights[2],
+                                             num_timesteps,
+                                             n_gates,
+                                             num_timesteps,
+                                             1,
+                                             1,
+                                             1,
+                                             rnn_type);
+}
+
 void ngraph::runtime::cpu::pass::VanillaRNNFusion::construct_vanilla_rnn()
 {
     // pattern to capture the vanilla RNN
@@ -189,6 +350,12 @@ void ngraph::runtime::cpu::pass::LSTMFusion::construct_onnx_lstmcell_fprop()
                      "match root node ",
                      *m.get_match_root(),
                      " not of type `op::v0::LSTMCell`");
+        // op::Lstm has no peepholes; RNNOpFusion maps the cells that use them
+        if (!is_supported_cell(*lstmcell_op) || !is_zero_constant(lstmcell_op->input_value(6)))
+        {
+            NGRAPH_DEBUG << "LSTMCell doesn't match the DNNL LSTM cell without peepholes";
+            return false;
+        }
         auto src_iter = std::make_shared<ngraph::op::v0::Concat>(
             OutputVector{pattern_map[H_t], pattern_map[C_t]}, 0);
 
@@ -924,6 +1091,16 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
         auto rnn_ltor_node = as_type_ptr<ngraph::op::Rnn>(pattern_map[rnn_left_to_right]);
         auto rnn_rtol_node = as_type_ptr<ngraph::op::Rnn>(pattern_map[rnn_right_to_left]);
 
+        for (auto rnn_node : {rnn_ltor_node, rnn_rtol_node})
+        {
+            if (!rnn_node->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm) ||
+                rnn_node->has_peephole())
+            {
+                NGRAPH_DEBUG << "Not fusing, only LSTMs without peepholes are fused";
+                return false;
+            }
+        }
+
         if (rnn_ltor_node->get_src_sequence_length() != rnn_rtol_node->get_src_sequence_length())
         {
             NGRAPH_DEBUG << "Not fusing, timestep of rnn's in both direction should match";
@@ -1024,3 +1201,512 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
     auto m = std::make_shared<ngraph::pattern::Matcher>(concat, "BiDirectionalRnn");
     this->add_matcher(m, callback);
 }
+
+// LSTMSequence runs on one DNNL LSTM when every batch entry covers the whole sequence
+static bool is_supported_lstm_sequence(const ngraph::op::v0::LSTMSequence& sequence)
+{
+    if (sequence.get_input_element_type(0) != element::f32 ||
+        sequence.get_input_shape(0).size() != 3 || sequence.get_clip_threshold() != 0.f ||
+        sequence.get_input_forget() ||
+        sequence.get_activations() != std::vector<std::string>{"sigmoid", "tanh", "tanh"})
+    {
+        return false;
+    }
+
+    size_t hidden_size = static_cast<size_t>(sequence.get_hidden_size());
+    if (sequence.get_input_shape(6).back() != 4 * hidden_size)
+    {
+        return false;
+    }
+
+    // DNNL has no per-batch sequence lengths
+    auto seq_lengths =
+        as_type_ptr<ngraph::op::v0::Constant>(sequence.input_value(3).get_node_shared_ptr());
+    if (!seq_lengths)
+    {
+        return false;
+    }
+    auto num_timesteps = static_cast<int64_t>(sequence.get_input_shape(0)[0]);
+    for (auto length : seq_lengths->cast_vector<int64_t>())
+    {
+        if (length != num_timesteps)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ngraph::runtime::cpu::pass::RNNOpFusion::is_supported(const Node& node)
+{
+    if (auto sequence = as_type<const ngraph::op::v0::LSTMSequence>(&node))
+    {
+        return is_supported_lstm_sequence(*sequence);
+    }
+    return is_supported_cell(node);
+}
+
+void ngraph::runtime::cpu::pass::RNNOpFusion::construct_rnn_cell()
+{
+    // LSTMCells without peepholes are left to LSTMFusion so RNNFusion can chain them over time
+    auto cell = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{32, 100}, [](const Output<Node>& value) {
+            auto node = value.get_node();
+            return is_type<ngraph::op::v3::GRUCell>(node) ||
+                   is_type<ngraph::op::v0::RNNCell>(node) ||
+                   (is_type<ngraph::op::v0::LSTMCell>(node) &&
+                    !is_zero_constant(node->input_value(6)));
+        });
+
+    auto callback = [](pattern::Matcher& m) {
+        auto cell_node = m.get_match_root();
+        NGRAPH_DEBUG << "In construct_rnn_cell callback against " << *cell_node;
+        if (!is_supported_cell(*cell_node))
+        {
+            return false;
+        }
+
+        bool is_lstm = is_type<ngraph::op::v0::LSTMCell>(cell_node);
+        size_t weights_begin = is_lstm ? 3 : 2;
+        OutputVector weights;
+        for (size_t i = weights_begin; i < cell_node->get_input_size(); i++)
+        {
+            weights.push_back(cell_node->input_value(i));
+        }
+        auto rnn = make_rnn_for_cell(*cell_node,
+                                     cell_node->input_value(0),
+                                     cell_node->input_value(1),
+                                     is_lstm ? cell_node->input_value(2) : Output<Node>(),
+                                     weights,
+                                     1);
+        if (is_lstm)
+        {
+            cell_node->output(0).replace(rnn->output(1));
+            cell_node->output(1).replace(rnn->output(2));
+        }
+        else
+        {
+            cell_node->output(0).replace(rnn->output(1));
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(cell, "RNNOpFusion.rnn_cell");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::RNNOpFusion::construct_lstm_sequence()
+{
+    auto sequence = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{32, 100}, pattern::has_class<ngraph::op::v0::LSTMSequence>());
+
+    auto callback = [](pattern::Matcher& m) {
+        auto sequence_node = as_type_ptr<ngraph::op::v0::LSTMSequence>(m.get_match_root());
+        NGRAPH_DEBUG << "In RNNOpFusion LSTMSequence callback against " << *sequence_node;
+        if (!is_supported_lstm_sequence(*sequence_node))
+        {
+            return false;
+        }
+
+        auto x_shape = sequence_node->get_input_shape(0);
+        size_t num_timesteps = x_shape[0];
+        size_t batch_size = x_shape[1];
+        size_t input_size = x_shape[2];
+        size_t hidden_size = static_cast<size_t>(sequence_node->get_hidden_size());
+        bool reverse = sequence_node->get_direction() ==
+                       ngraph::op::v0::LSTMSequence::direction::REVERSE;
+        size_t direction = sequence_node->get_direction() ==
+                                   ngraph::op::v0::LSTMSequence::direction::BIDIRECTIONAL
+                               ? 2
+                               : 1;
+        auto format = sequence_node->get_weights_format();
+
+        // a reverse LSTM is the forward LSTM over the time-reversed sequence
+        Output<Node> src_layer = sequence_node->input_value(0);
+        if (reverse)
+        {
+            src_layer = std::make_shared<ngraph::op::v0::Reverse>(src_layer, AxisSet{0});
+        }
+        src_layer = std::make_shared<ngraph::op::v0::Reshape>(
+            src_layer, AxisVector{0, 1, 2}, Shape{num_timesteps * batch_size, input_size});
+
+        auto flatten_state = [&](const Output<Node>& state) {
+            return std::make_shared<ngraph::op::v0::Reshape>(
+                state, AxisVector{0, 1, 2}, Shape{direction * batch_size, hidden_size});
+        };
+        // {D, 4 * H, C} -> {D * C, 4 * H}
+        auto flatten_weights = [&](const Output<Node>& weights) {
+            auto shape = weights.get_shape();
+            return std::make_shared<ngraph::op::v0::Reshape>(
+                reorder_lstm_gates(weights, format, 1),
+                AxisVector{0, 2, 1},
+                Shape{shape[0] * shape[2], shape[1]});
+        };
+        auto flatten_bias = [&](const Output<Node>& bias) {
+            return std::make_shared<ngraph::op::v0::Reshape>(
+                bias, AxisVector{0, 1}, Shape{shape_size(bias.get_shape())});
+        };
+
+        auto src_iter = flatten_state(sequence_node->input_value(1));
+        auto src_iter_c = flatten_state(sequence_node->input_value(2));
+        auto wei_layer = flatten_weights(sequence_node->input_value(4));
+        auto wei_iter = flatten_weights(sequence_node->input_value(5));
+        auto bias = flatten_bias(reorder_lstm_gates(sequence_node->input_value(6), format, 1));
+
+        std::shared_ptr<ngraph::op::Rnn> rnn;
+        if (is_zero_constant(sequence_node->input_value(7)))
+        {
+            rnn = std::make_shared<ngraph::op::Rnn>(
+                src_layer,
+                src_iter,
+                src_iter_c,
+                wei_layer,
+                wei_iter,
+                bias,
+                num_timesteps,
+                4,
+                num_timesteps,
+                2,
+                direction,
+                1,
+                ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm);
+        }
+        else
+        {
+            rnn = std::make_shared<ngraph::op::Rnn>(
+                src_layer,
+                src_iter,
+                src_iter_c,
+                wei_layer,
+                wei_iter,
+                bias,
+                flatten_bias(reorder_peephole_gates(sequence_node->input_value(7), 1)),
+                num_timesteps,
+                4,
+                num_timesteps,
+                2,
+                direction,
+                1,
+                ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm);
+        }
+
+        // dst_layer is {T * N, D * H} with the directions concatenated per timestep
+        Output<Node> y = std::make_shared<ngraph::op::v0::Reshape>(
+            rnn->output(0),
+            AxisVector{0, 1},
+            Shape{num_timesteps, batch_size, direction, hidden_size});
+        y = std::make_shared<ngraph::op::v0::Reshape>(
+            y, AxisVector{0, 2, 1, 3}, Shape{num_timesteps, direction, batch_size, hidden_size});
+        if (reverse)
+        {
+            y = std::make_shared<ngraph::op::v0::Reverse>(y, AxisSet{0});
+        }
+        auto y_h = std::make_shared<ngraph::op::v0::Reshape>(
+            rnn->output(1), AxisVector{0, 1}, Shape{direction, batch_size, hidden_size});
+        auto y_c = std::make_shared<ngraph::op::v0::Reshape>(
+            rnn->output(2), AxisVector{0, 1}, Shape{direction, batch_size, hidden_size});
+
+        sequence_node->output(0).replace(y);
+        sequence_node->output(1).replace(y_h);
+        sequence_node->output(2).replace(y_c);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(sequence, "RNNOpFusion.lstm_sequence");
+    this->add_matcher(m, callback);
+}
+
+// Skips the ops that only relabel the shape of a value, keeping its row-major order
+static Output<Node> skip_shape_ops(Output<Node> value)
+{
+    while (true)
+    {
+        auto node = value.get_node();
+        auto reshape = as_type<ngraph::op::v0::Reshape>(node);
+        if ((reshape && !reshape->get_is_transpose()) || is_type<ngraph::op::v1::Reshape>(node) ||
+            is_type<ngraph::op::v0::Squeeze>(node) || is_type<ngraph::op::v0::Unsqueeze>(node))
+        {
+            value = node->input_value(0);
+        }
+        else
+        {
+            return value;
+        }
+    }
+}
+
+// Checks a TensorIterator slice or concat covers the whole time axis with single steps
+static bool is_full_sweep(
+    int64_t start, int64_t stride, int64_t part_size, int64_t end, int64_t num_timesteps)
+{
+    start = start < 0 ? start + num_timesteps : start;
+    end = end < 0 ? end + num_timesteps : end;
+    if (part_size != 1)
+    {
+        return false;
+    }
+    return (stride == 1 && start == 0 && end == num_timesteps - 1) ||
+           (stride == -1 && start == num_timesteps - 1 && end == 0);
+}
+
+namespace
+{
+    // A TensorIterator whose body is one recurrent cell: the cell steps over a sequence sliced
+    // along its time axis and carries its states through the back edges.
+    struct CellLoop
+    {
+        struct LoopOutput
+        {
+            // the per-timestep hidden states or the final state of the cell output
+            bool is_sequence;
+            size_t cell_output;
+            size_t time_axis;
+            bool reversed;
+        };
+
+        std::shared_ptr<Node> cell;
+        Output<Node> src;
+        size_t time_axis;
+        bool reversed;
+        Output<Node> initial_hidden;
+        Output<Node> initial_cell;
+        OutputVector weights;
+        std::vector<LoopOutput> outputs;
+    };
+}
+
+static bool match_cell_loop(const ngraph::op::v0::TensorIterator& ti, CellLoop& loop)
+{
+    using TensorIterator = ngraph::op::v0::TensorIterator;
+    auto body = ti.get_body();
+    if (!body || ti.get_num_iterations() < 1)
+    {
+        return false;
+    }
+    auto num_timesteps = ti.get_num_iterations();
+
+    bool single_cell = true;
+    NodeVector body_results(body->get_results().begin(), body->get_results().end());
+    traverse_nodes(body_results, [&](std::shared_ptr<Node> node) {
+        if (node->is_parameter() || node->is_output() || node->is_constant() ||
+            skip_shape_ops(node->output(0)).get_node() != node.get())
+        {
+            return;
+        }
+        single_cell = single_cell && !loop.cell && is_supported_cell(*node);
+        loop.cell = node;
+    });
+    if (!single_cell || !loop.cell)
+    {
+        return false;
+    }
+    bool is_lstm = is_type<ngraph::op::v0::LSTMCell>(loop.cell);
+
+    std::map<Node*, std::shared_ptr<TensorIterator::InputDescription>> param_descs;
+    for (auto desc : ti.get_input_descriptions())
+    {
+        param_descs[body->get_parameters().at(desc->m_body_parameter_index).get()] = desc;
+    }
+    auto input_desc = [&](const Output<Node>& value) {
+        auto it = param_descs.find(skip_shape_ops(value).get_node());
+        return it == param_descs.end() ? nullptr : it->second;
+    };
+    auto body_value = [&](uint64_t result_index) {
+        return skip_shape_ops(body->get_results().at(result_index)->input_value(0));
+    };
+
+    // the sequence, sliced one timestep at a time
+    auto slice = as_type_ptr<TensorIterator::SliceInputDescription>(
+        input_desc(loop.cell->input_value(0)));
+    if (!slice)
+    {
+        return false;
+    }
+    loop.src = ti.input_value(slice->m_input_index);
+    auto src_shape = loop.src.get_shape();
+    if (src_shape.size() != 3 || (slice->m_axis != 0 && slice->m_axis != 1) ||
+        static_cast<int64_t>(src_shape[slice->m_axis]) != num_timesteps ||
+        !is_full_sweep(
+            slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, num_timesteps))
+    {
+        return false;
+    }
+    loop.time_axis = slice->m_axis;
+    loop.reversed = slice->m_stride < 0;
+    size_t batch_size = src_shape[1 - loop.time_axis];
+    if (loop.cell->get_input_shape(0) != Shape{batch_size, src_shape[2]})
+    {
+        return false;
+    }
+
+    // the states, fed back from the cell outputs
+    auto match_state = [&](size_t cell_input, size_t cell_output, Output<Node>& initial) {
+        auto merged = as_type_ptr<TensorIterator::MergedInputDescription>(
+            input_desc(loop.cell->input_value(cell_input)));
+        if (!merged || body_value(merged->m_body_value_index) != loop.cell->output(cell_output))
+        {
+            return false;
+        }
+        initial = ti.input_value(merged->m_input_index);
+        return shape_size(initial.get_shape()) == shape_size(loop.cell->get_input_shape(1));
+    };
+    if (!match_state(1, 0, loop.initial_hidden) ||
+        (is_lstm && !match_state(2, 1, loop.initial_cell)))
+    {
+        return false;
+    }
+
+    // the weights, either loop invariant or constant in the body
+    for (size_t i = is_lstm ? 3 : 2; i < loop.cell->get_input_size(); i++)
+    {
+        auto value = loop.cell->input_value(i);
+        if (auto constant = as_type_ptr<ngraph::op::v0::Constant>(value.get_node_shared_ptr()))
+        {
+            loop.weights.push_back(constant->clone_with_new_inputs(OutputVector{}));
+            continue;
+        }
+        auto it = param_descs.find(value.get_node());
+        if (it == param_descs.end() ||
+            !is_type<TensorIterator::InvariantInputDescription>(it->second))
+        {
+            return false;
+        }
+        loop.weights.push_back(ti.input_value(it->second->m_input_index));
+    }
+
+    for (auto desc : ti.get_output_descriptions())
+    {
+        auto value = body_value(desc->m_body_value_index);
+        if (value.get_node_shared_ptr() != loop.cell)
+        {
+            return false;
+        }
+        if (auto concat = as_type_ptr<TensorIterator::ConcatOutputDescription>(desc))
+        {
+            auto result_shape =
+                body->get_results().at(desc->m_body_value_index)->get_output_shape(0);
+            if (value.get_index() != 0 || result_shape.size() != 3 ||
+                (concat->m_axis != 0 && concat->m_axis != 1) ||
+                result_shape[concat->m_axis] != 1 ||
+                !is_full_sweep(concat->m_start,
+                               concat->m_stride,
+                               concat->m_part_size,
+                               concat->m_end,
+                               num_timesteps))
+            {
+                return false;
+            }
+            loop.outputs.push_back({true,
+                                    0,
+                                    static_cast<size_t>(concat->m_axis),
+                                    concat->m_stride < 0});
+        }
+        else if (auto last = as_type_ptr<TensorIterator::BodyOutputDescription>(desc))
+        {
+            if (last->m_iteration != -1 && last->m_iteration != num_timesteps - 1)
+            {
+                return false;
+            }
+            loop.outputs.push_back({false, value.get_index(), 0, false});
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ngraph::runtime::cpu::pass::TensorIteratorRNNFusion::is_supported(const Node& node)
+{
+    auto ti = as_type<const ngraph::op::v0::TensorIterator>(&node);
+    CellLoop loop;
+    return ti && match_cell_loop(*ti, loop);
+}
+
+bool ngraph::runtime::cpu::pass::TensorIteratorRNNFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> f)
+{
+    bool modified = false;
+    for (auto node : f->get_ordered_ops())
+    {
+        auto ti = as_type_ptr<ngraph::op::v0::TensorIterator>(node);
+        CellLoop loop;
+        if (!ti || !match_cell_loop(*ti, loop))
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "Fusing " << *ti << " into a single Rnn over "
+                     << ti->get_num_iterations() << " timesteps";
+
+        auto src_shape = loop.src.get_shape();
+        size_t num_timesteps = static_cast<size_t>(ti->get_num_iterations());
+        size_t batch_size = src_shape[1 - loop.time_axis];
+        size_t hidden_size = loop.cell->get_input_shape(1)[1];
+
+        Output<Node> src_layer = loop.src;
+        if (loop.time_axis == 1)
+        {
+            src_layer = std::make_shared<ngraph::op::v0::Reshape>(
+                src_layer, AxisVector{1, 0, 2}, Shape{num_timesteps, batch_size, src_shape[2]});
+        }
+        if (loop.reversed)
+        {
+            src_layer = std::make_shared<ngraph::op::v0::Reverse>(src_layer, AxisSet{0});
+        }
+        src_layer = std::make_shared<ngraph::op::v0::Reshape>(
+            src_layer, AxisVector{0, 1, 2}, Shape{num_timesteps * batch_size, src_shape[2]});
+
+        auto flatten_state = [&](const Output<Node>& state) -> Output<Node> {
+            if (!state.get_node())
+            {
+                return state;
+            }
+            return std::make_shared<ngraph::op::v0::Reshape>(
+                state,
+                get_default_order(state.get_shape()),
+                Shape{batch_size, hidden_size});
+        };
+        auto rnn = make_rnn_for_cell(*loop.cell,
+                                     src_layer,
+                                     flatten_state(loop.initial_hidden),
+                                     flatten_state(loop.initial_cell),
+                                     loop.weights,
+                                     num_timesteps);
+
+        for (size_t i = 0; i < loop.outputs.size(); i++)
+        {
+            const auto& loop_output = loop.outputs[i];
+            auto out_shape = ti->get_output_shape(i);
+            Output<Node> value;
+            if (loop_output.is_sequence)
+            {
+                value = std::make_shared<ngraph::op::v0::Reshape>(
+                    rnn->output(0),
+                    AxisVector{0, 1},
+                    Shape{num_timesteps, batch_size, hidden_size});
+                if (loop_output.reversed)
+                {
+                    value = std::make_shared<ngraph::op::v0::Reverse>(value, AxisSet{0});
+                }
+                if (loop_output.time_axis == 1)
+                {
+                    value = std::make_shared<ngraph::op::v0::Reshape>(
+                        value, AxisVector{1, 0, 2}, Shape{batch_size, num_timesteps, hidden_size});
+                }
+            }
+            else
+            {
+                value = rnn->output(loop_output.cell_output + 1);
+            }
+            if (value.get_shape() != out_shape)
+            {
+                value = std::make_shared<ngraph::op::v0::Reshape>(
+                    value, get_default_order(value.get_shape()), out_shape);
+            }
+            ti->output(i).replace(value);
+        }
+        modified = true;
+    }
+    return modified;
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/pass.hpp"
 #include "ngraph/runtime/cpu/cpu_backend_visibility.h"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 
@@ -33,6 +34,8 @@ namespace ngraph
                 class RNNFusion;
                 class BiDirectionalRnn;
                 class MultiLayerRNNFusion;
+                class RNNOpFusion;
+                class TensorIteratorRNNFusion;
             }
         }
     }
@@ -109,3 +112,35 @@ public:
 private:
     void construct_bidirectional_rnn();
 };
+
+/// \brief Maps the recurrent cell and sequence ops (GRUCell, RNNCell, LSTMCell with peepholes
+///        and LSTMSequence) onto op::Rnn so they execute as single DNNL RNN primitives.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::RNNOpFusion : public ngraph::pass::GraphRewrite
+{
+public:
+    RNNOpFusion()
+        : GraphRewrite()
+    {
+        construct_rnn_cell();
+        construct_lstm_sequence();
+    }
+
+    /// \return true if the node is a cell or sequence op this pass can map onto op::Rnn
+    static bool is_supported(const Node& node);
+
+private:
+    void construct_rnn_cell();
+    void construct_lstm_sequence();
+};
+
+/// \brief Replaces a TensorIterator whose body is a single recurrent cell stepping over a
+///        sequence with one op::Rnn spanning all iterations.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::TensorIteratorRNNFusion
+    : public ngraph::pass::FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \return true if the TensorIterator can be replaced with a fused op::Rnn
+    static bool is_supported(const Node& node);
+};
@@ -49,7 +49,7 @@ namespace ngraph
 ///
 /// This class is instantiated by `ngraph::runtime::Backend::create`.
 ///
-class ngraph::runtime::dynamic::DynamicBackend : public Backend
+class NGRAPH_API ngraph::runtime::dynamic::DynamicBackend : public Backend
 {
 public:
     DynamicBackend(std::shared_ptr<ngraph::runtime::Backend> wrapped_backend);
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <iterator>
+#include <unordered_set>
 
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
@@ -23,6 +24,7 @@
 #include "ngraph/op/experimental/dyn_replace_slice.hpp"
 #include "ngraph/op/experimental/dyn_slice.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/range.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/transpose.hpp"
@@ -35,6 +37,7 @@
 #include "ngraph/runtime/dynamic/dynamic_executable.hpp"
 #include "ngraph/runtime/dynamic/dynamic_tensor.hpp"
 #include "ngraph/specialize_function.hpp"
+#include "ngraph/structural_hash.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -51,6 +54,12 @@ runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrap
     passes.run_passes(m_wrapped_function);
 
     set_parameters_and_results(*wrapped_function);
+
+    m_shape_polymorphic = is_shape_polymorphic(m_wrapped_function);
+    for (auto& parameter : m_wrapped_function->get_parameters())
+    {
+        m_shape_polymorphic = m_shape_polymorphic && !parameter->is_relevant_to_shapes();
+    }
 }
 
 // Due to clang++-3.9 bugs, this needs to be a non-static separate function from
@@ -66,7 +75,7 @@ bool is_dynamic_op(const std::shared_ptr<Node>& op)
            is_type<op::v3::Broadcast>(op) || is_type<op::v1::GenerateMask>(op);
 }
 
-// Helper for a vile hack in DynamicExecutable::call. See body of that function for details.
+// Helper for a vile hack in run_specialization_passes. See body of that function for details.
 static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
 {
     size_t count = 0;
@@ -80,6 +89,45 @@ static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
     return count;
 }
 
+// Eliminates the dynamic ops of a specialized clone
+static void run_specialization_passes(const shared_ptr<Function>& clone)
+{
+    pass::Manager passes;
+    // ConvertOpset3To1 should be moved below DynElimination
+    // when ConstantFolding for v3 ops will be ready
+    passes.register_pass<pass::ConvertOpset3To1>();
+    passes.register_pass<pass::ConstantFolding>();
+    passes.register_pass<pass::DynElimination>();
+    passes.register_pass<pass::ConvertOpset1To0>(); // Converts dynamic v1 variants to v0 ops
+    passes.set_per_pass_validation(false);
+
+    // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
+    // ConstantFolding/DynElimination until everything that DynElimination is supposed to
+    // eliminate has actually been eliminated. We could do this by monitoring the return values
+    // of the passes (keep iterating until both CF and DE report no changes), but that did not
+    // seem to work so here we are. Probably a better fix is to somehow combine the matchers in
+    // CF
+    // and DE into one pass.
+    size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
+
+    while (num_dyn_nodes_last_pass != 0)
+    {
+        passes.run_passes(clone);
+        auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
+
+        NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
+                     "Could not eliminate all Dyn nodes (",
+                     num_dyn_nodes_this_pass,
+                     " remaining)");
+
+        num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
+    }
+
+    pass::Manager pass_val;
+    pass_val.register_pass<pass::Validate>();
+    pass_val.run_passes(clone);
+}
+
 bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
@@ -164,7 +212,46 @@ bool runtime::dynamic::DynamicExecutable::call(
         std::vector<element::Type> arg_element_types;
         std::vector<PartialShape> arg_shapes;
 
+        // After its first compilation a shape polymorphic function is rebound to the new shapes
+        // instead of being specialized and run through the passes again. The backend may reuse
+        // that compilation as well.
         std::shared_ptr<Function> clone;
+        std::shared_ptr<runtime::Executable> compiled_executable;
+        std::shared_ptr<Function> polymorphic_function;
+        std::shared_ptr<runtime::Executable> polymorphic_executable;
+        {
+            std::lock_guard<std::mutex> lock(m_polymorphic_mutex);
+            polymorphic_function = m_polymorphic_function;
+            polymorphic_executable = m_polymorphic_executable;
+        }
+        if (polymorphic_function)
+        {
+            std::vector<Shape> input_shapes;
+            for (auto& input : inputs)
+            {
+                auto wrapped_input = input;
+                if (auto dynamic_tensor =
+                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+                {
+                    NGRAPH_CHECK(dynamic_tensor->has_storage());
+                    wrapped_input = dynamic_tensor->get_wrapped_tensor();
+                }
+                input_shapes.push_back(wrapped_input->get_shape());
+                wrapped_inputs.push_back(wrapped_input);
+            }
+
+            clone = rebind_function(polymorphic_function, input_shapes);
+            if (clone)
+            {
+                compiled_executable = polymorphic_executable->rebind(input_shapes);
+            }
+            else
+            {
+                wrapped_inputs.clear();
+            }
+        }
+
+        if (!clone)
         {
             // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
             // RAII
@@ -219,43 +306,10 @@ bool runtime::dynamic::DynamicExecutable::call(
 
             clone = specialize_function(
                 m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
-        }
-
-        pass::Manager passes;
-        // ConvertOpset3To1 should be moved below DynElimination
-        // when ConstantFolding for v3 ops will be ready
-        passes.register_pass<pass::ConvertOpset3To1>();
-        passes.register_pass<pass::ConstantFolding>();
-        passes.register_pass<pass::DynElimination>();
-        passes.register_pass<pass::ConvertOpset1To0>(); // Converts dynamic v1 variants to v0 ops
-        passes.set_per_pass_validation(false);
-
-        // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
-        // ConstantFolding/DynElimination until everything that DynElimination is supposed to
-        // eliminate has actually been eliminated. We could do this by monitoring the return values
-        // of the passes (keep iterating until both CF and DE report no changes), but that did not
-        // seem to work so here we are. Probably a better fix is to somehow combine the matchers in
-        // CF
-        // and DE into one pass.
-        size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
-
-        while (num_dyn_nodes_last_pass != 0)
-        {
-            passes.run_passes(clone);
-            auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
 
-            NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
-                         "Could not eliminate all Dyn nodes (",
-                         num_dyn_nodes_this_pass,
-                         " remaining)");
-
-            num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
+            run_specialization_passes(clone);
         }
 
-        pass::Manager pass_val;
-        pass_val.register_pass<pass::Validate>();
-        pass_val.run_passes(clone);
-
         std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
 
         const ResultVector& results = clone->get_results();
@@ -282,8 +336,41 @@ bool runtime::dynamic::DynamicExecutable::call(
             }
         }
 
-        auto compiled_executable =
-            m_wrapped_backend->compile(clone, m_enable_performance_collection);
+        // Backends may rewrite the Function they compile, so the function kept for rebinding is
+        // a copy taken before compilation
+        std::shared_ptr<Function> rebindable_function;
+        if (m_shape_polymorphic && !polymorphic_function && is_shape_polymorphic(clone))
+        {
+            rebindable_function = clone_function(*clone);
+        }
+
+        if (!compiled_executable)
+        {
+            // Different input shapes or shape-relevant values may still specialize to the same
+            // graph, in which case the executable compiled for it can be shared.
+            size_t function_hash = StructuralHash().get_function_hash(clone);
+            compiled_executable = m_cache->get_structural_entry(function_hash, clone);
+            if (!compiled_executable)
+            {
+                // Later lookups compare against the graph as it was before compilation
+                auto uncompiled_function = clone_function(*clone);
+                compiled_executable =
+                    m_wrapped_backend->compile(clone, m_enable_performance_collection);
+                m_cache->add_structural_entry(
+                    function_hash, compiled_executable, uncompiled_function);
+            }
+        }
+
+        if (rebindable_function)
+        {
+            // Concurrent first calls may both get here; the first one to finish is kept
+            std::lock_guard<std::mutex> lock(m_polymorphic_mutex);
+            if (!m_polymorphic_function)
+            {
+                m_polymorphic_function = rebindable_function;
+                m_polymorphic_executable = compiled_executable;
+            }
+        }
         // Put compiled executable in the cache.
         m_cache->add_entry(merged_input_shapes, compiled_executable, clone);
         auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
@@ -291,3 +378,48 @@ bool runtime::dynamic::DynamicExecutable::call(
         return result;
     }
 }
+
+// Bytes of the Constants reachable from the nodes whose storage is not in seen yet
+static size_t add_constant_storage(const ResultVector& results, unordered_set<const void*>& seen)
+{
+    NodeVector nodes(results.begin(), results.end());
+    size_t bytes = 0;
+    traverse_nodes(nodes, [&](shared_ptr<Node> node) {
+        if (auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            if (seen.insert(constant->get_data_ptr()).second)
+            {
+                bytes += constant->get_output_tensor(0).size();
+            }
+        }
+    });
+    return bytes;
+}
+
+runtime::MemoryReport runtime::dynamic::DynamicExecutable::get_memory_report() const
+{
+    MemoryReport report;
+    unordered_set<const void*> seen;
+    unordered_set<const Executable*> executables;
+    auto entries = m_cache->get_entries();
+    for (auto& entry : entries)
+    {
+        if (executables.insert(entry.first.get()).second)
+        {
+            report.merge(entry.first->get_memory_report());
+            add_constant_storage(entry.first->get_results(), seen);
+        }
+    }
+
+    size_t function_bytes = add_constant_storage(m_wrapped_function->get_results(), seen);
+    for (auto& entry : entries)
+    {
+        if (entry.second)
+        {
+            function_bytes += add_constant_storage(entry.second->get_results(), seen);
+        }
+    }
+    report.add(MemoryReport::functions, function_bytes);
+    report.set_peak_bytes(report.get_peak_bytes() + function_bytes);
+    return report;
+}
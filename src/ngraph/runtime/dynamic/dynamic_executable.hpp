@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -48,6 +49,13 @@ namespace ngraph
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// If every op of the stored function is shape polymorphic (see `is_shape_polymorphic`) and no
+/// parameter is relevant to shapes, only the first call goes through steps 1 and 2. Later input
+/// shapes rebind that first specialization, and the wrapped backend is asked to rebind its
+/// executable too (`Executable::rebind`) before it is asked to compile the rebound clone.
+/// Only INTERPRETER rebinds its executables. The other backends, CPU included, still compile
+/// the rebound clone for every new shape, so for them only the specialization is skipped.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
@@ -59,10 +67,19 @@ public:
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Merges the reports of every cached executable. Constant storage of the wrapped
+    ///        and cloned Functions that no executable uses is reported as "functions".
+    MemoryReport get_memory_report() const override;
+
 private:
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     std::shared_ptr<ngraph::runtime::ExecutableCache> m_cache =
         std::make_shared<ngraph::runtime::ExecutableCache>();
     bool m_enable_performance_collection;
+    bool m_shape_polymorphic;
+    // Set once by the first call that compiles a shape polymorphic specialization
+    std::mutex m_polymorphic_mutex;
+    std::shared_ptr<ngraph::Function> m_polymorphic_function;
+    std::shared_ptr<ngraph::runtime::Executable> m_polymorphic_executable;
 };
@@ -15,9 +15,13 @@
 //*****************************************************************************
 
 #include <sstream>
+#include <unordered_set>
 
+#include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/util.hpp"
@@ -112,6 +116,11 @@ size_t runtime::Executable::get_preferred_pipeline_depth() const
     return 2;
 }
 
+shared_ptr<runtime::Executable> runtime::Executable::rebind(const vector<Shape>& /* input_shapes */)
+{
+    return nullptr;
+}
+
 void runtime::Executable::set_parameters_and_results(const Function& func)
 {
     m_parameters = func.get_parameters();
@@ -123,6 +132,26 @@ vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data()
     return vector<PerformanceCounter>();
 }
 
+runtime::MemoryReport runtime::Executable::get_memory_report() const
+{
+    MemoryReport report;
+    unordered_set<const void*> seen;
+    NodeVector results(m_results.begin(), m_results.end());
+    traverse_nodes(results, [&](shared_ptr<Node> node) {
+        if (auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            if (seen.insert(constant->get_data_ptr()).second)
+            {
+                size_t bytes = constant->get_output_tensor(0).size();
+                report.add(MemoryReport::constants, bytes);
+                report.add_op(constant->get_friendly_name(), MemoryReport::constants, bytes);
+            }
+        }
+    });
+    report.set_peak_bytes(report.get_total_bytes());
+    return report;
+}
+
 void runtime::Executable::save(std::ostream& /* output_stream */)
 {
     throw runtime_error("save operation unimplemented.");
@@ -130,47 +159,47 @@ void runtime::Executable::save(std::ostream& /* output_stream */)
 
 shared_ptr<runtime::Tensor> runtime::Executable::create_input_tensor(size_t /* input_index */)
 {
-    throw runtime_error("create_input_tensor unimplemented");
+    throw unsupported_op("create_input_tensor unimplemented");
 }
 
 shared_ptr<runtime::Tensor> runtime::Executable::create_input_tensor(size_t /* input_index */,
                                                                      void* /* memory_pointer */)
 {
-    throw runtime_error("create_input_tensor unimplemented");
+    throw unsupported_op("create_input_tensor unimplemented");
 }
 
 shared_ptr<runtime::Tensor> runtime::Executable::create_output_tensor(size_t /* output_index */)
 {
-    throw runtime_error("create_output_tensor unimplemented");
+    throw unsupported_op("create_output_tensor unimplemented");
 }
 
 shared_ptr<runtime::Tensor> runtime::Executable::create_output_tensor(size_t /* output_index */,
                                                                       void* /* memory_pointer */)
 {
-    throw runtime_error("create_output_tensor unimplemented");
+    throw unsupported_op("create_output_tensor unimplemented");
 }
 
 vector<shared_ptr<runtime::Tensor>>
     runtime::Executable::create_input_tensor(size_t /* input_index */, size_t /* pipeline_depth */)
 {
-    throw runtime_error("create_input_tensor unimplemented");
+    throw unsupported_op("create_input_tensor unimplemented");
 }
 
 vector<shared_ptr<runtime::Tensor>> runtime::Executable::create_input_tensor(
     size_t /* input_index */, size_t /* pipeline_depth */, std::vector<void*> /* memory_pointer */)
 {
-    throw runtime_error("create_input_tensor unimplemented");
+    throw unsupported_op("create_input_tensor unimplemented");
 }
 
 vector<shared_ptr<runtime::Tensor>>
     runtime::Executable::create_output_tensor(size_t /* output_index */,
                                               size_t /* pipeline_depth */)
 {
-    throw runtime_error("create_output_tensor unimplemented");
+    throw unsupported_op("create_output_tensor unimplemented");
 }
 
 vector<shared_ptr<runtime::Tensor>> runtime::Executable::create_output_tensor(
     size_t /* output_index */, size_t /* pipeline_depth */, std::vector<void*> /* memory_pointer */)
 {
-    throw runtime_error("create_output_tensor unimplemented");
+    throw unsupported_op("create_output_tensor unimplemented");
 }
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/memory_report.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/shape.hpp"
@@ -55,6 +56,20 @@ public:
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Report the memory held by this Executable.
+    ///    The default implementation only counts the constant data reachable from the results.
+    /// \returns MemoryReport broken down by category and, where known, by op.
+    virtual MemoryReport get_memory_report() const;
+
+    /// \brief Get an executable of the same Function for inputs of other static shapes.
+    ///    Backends whose kernels take their sizes at run time can reuse what they compiled for
+    ///    this executable instead of compiling the Function again. The default implementation
+    ///    returns nullptr; only the INTERPRETER executable overrides it.
+    /// \param input_shapes The new shapes, one per input Parameter
+    /// \returns The rebound Executable, or nullptr if the Function has to be compiled again
+    ///    for input_shapes.
+    virtual std::shared_ptr<Executable> rebind(const std::vector<Shape>& input_shapes);
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -19,6 +19,7 @@
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/runtime/executable_cache.hpp"
+#include "ngraph/structural_hash.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -63,7 +64,14 @@ void runtime::ExecutableCache::add_entry(const vector<int>& shape,
         ostringstream key;
         convert_shape_to_string(m_list.back(), key);
         m_list.pop_back();
-        m_map.erase(key.str());
+        auto evicted = m_map.find(key.str());
+        if (evicted != m_map.end())
+        {
+            auto evicted_exec = evicted->second;
+            m_map.erase(evicted);
+            remove_structural_entries(evicted_exec);
+        }
+        m_clone_function_map.erase(key.str());
     }
 
     convert_shape_to_string(shape, key);
@@ -127,3 +135,75 @@ shared_ptr<Function> runtime::ExecutableCache::get_cloned_function(const vector<
     }
     return it->second;
 }
+
+shared_ptr<runtime::Executable>
+    runtime::ExecutableCache::get_structural_entry(size_t function_hash,
+                                                   const shared_ptr<Function>& function)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    StructuralHash structural_hash;
+    auto range = m_structural_map.equal_range(function_hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        auto exec = it->second.first.lock();
+        if (!exec)
+        {
+            it = m_structural_map.erase(it);
+        }
+        else if (structural_hash.functions_equal(it->second.second, function))
+        {
+            return exec;
+        }
+        else
+        {
+            it++;
+        }
+    }
+    return nullptr;
+}
+
+void runtime::ExecutableCache::remove_structural_entries(const shared_ptr<Executable>& exec)
+{
+    // Other shapes may still share exec
+    for (auto& entry : m_map)
+    {
+        if (entry.second == exec)
+        {
+            return;
+        }
+    }
+    for (auto it = m_structural_map.begin(); it != m_structural_map.end();)
+    {
+        auto structural_exec = it->second.first.lock();
+        if (!structural_exec || structural_exec == exec)
+        {
+            it = m_structural_map.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void runtime::ExecutableCache::add_structural_entry(size_t function_hash,
+                                                    shared_ptr<runtime::Executable> exec,
+                                                    shared_ptr<Function> function)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_structural_map.emplace(function_hash, make_pair(exec, function));
+}
+
+vector<pair<shared_ptr<runtime::Executable>, shared_ptr<Function>>>
+    runtime::ExecutableCache::get_entries()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    vector<pair<shared_ptr<Executable>, shared_ptr<Function>>> entries;
+    for (auto& entry : m_map)
+    {
+        auto func = m_clone_function_map.find(entry.first);
+        entries.emplace_back(entry.second,
+                             func == m_clone_function_map.end() ? nullptr : func->second);
+    }
+    return entries;
+}
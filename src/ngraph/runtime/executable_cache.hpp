@@ -21,6 +21,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/executable.hpp"
@@ -34,7 +35,7 @@ namespace ngraph
     }
 }
 
-class ngraph::runtime::ExecutableCache
+class NGRAPH_API ngraph::runtime::ExecutableCache
 {
 public:
     using GraphCache = std::unordered_map<std::string, std::shared_ptr<Executable>>;
@@ -52,10 +53,34 @@ public:
     void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
     std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
 
+    /// \brief Returns the executable compiled from a Function structurally equal to function,
+    ///        or nullptr if there is none. Executables are only found while at least one shape
+    ///        entry still refers to them; evicting the last one also drops the structural entry.
+    /// \param function_hash The structural hash of function. Entries with the same hash are
+    ///        still compared with StructuralHash::functions_equal before they are reused.
+    std::shared_ptr<Executable> get_structural_entry(size_t function_hash,
+                                                     const std::shared_ptr<Function>& function);
+    /// \param function The Function exec was compiled from, as it was before compilation.
+    void add_structural_entry(size_t function_hash,
+                              std::shared_ptr<Executable> exec,
+                              std::shared_ptr<Function> function);
+
+    /// \brief Returns every cached executable together with the cloned Function it was
+    ///        compiled from. An executable shared by several shapes is listed once per shape.
+    std::vector<std::pair<std::shared_ptr<Executable>, std::shared_ptr<Function>>>
+        get_entries();
+
 private:
+    /// \brief Drops the structural entries of exec once no shape entry refers to it, so that
+    ///        evicted executables do not keep their cloned Functions alive. Expects m_mutex held.
+    void remove_structural_entries(const std::shared_ptr<Executable>& exec);
+
     size_t m_cache_size;
     GraphCache m_map;
     ClonedFunctionMap m_clone_function_map;
     std::list<std::vector<int>> m_list;
+    std::unordered_multimap<size_t,
+                            std::pair<std::weak_ptr<Executable>, std::shared_ptr<Function>>>
+        m_structural_map;
     std::mutex m_mutex;
 };
@@ -43,6 +43,12 @@ runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& functi
 {
 }
 
+shared_ptr<runtime::Executable>
+    runtime::gcpu::GCPUExecutable::rebind(const vector<Shape>& /* input_shapes */)
+{
+    return nullptr;
+}
+
 bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -198,6 +204,8 @@ void runtime::gcpu::GCPUExecutable::generate_calls(const element::Type& type,
     case element::Type_t::u64: gop_engine<uint64_t>(op, out, in); break;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::bf16:
     case element::Type_t::f16:
@@ -71,6 +71,9 @@ public:
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
 
+    /// \brief Not supported; the INTERPRETER rebind would drop the GCPU kernels.
+    std::shared_ptr<Executable> rebind(const std::vector<Shape>& input_shapes) override;
+
 private:
     int get_alignment() const { return 64; }
     void generate_calls(const element::Type& type,
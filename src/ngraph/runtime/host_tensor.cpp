@@ -21,6 +21,7 @@
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -79,7 +80,8 @@ void runtime::HostTensor::allocate_buffer()
                  get_element_type());
     m_descriptor->set_tensor_layout(
         std::make_shared<ngraph::descriptor::layout::DenseTensorLayout>(*m_descriptor));
-    m_buffer_size = m_descriptor->get_tensor_layout()->get_size() * get_element_type().size();
+    m_buffer_size =
+        packed::byte_size(get_element_type(), m_descriptor->get_tensor_layout()->get_size());
     if (m_memory_pointer != nullptr)
     {
         m_aligned_buffer_pool = m_memory_pointer;
@@ -129,7 +131,8 @@ void* runtime::HostTensor::get_data_ptr()
     {
         allocate_buffer();
     }
-    else if (shape_size(m_descriptor->get_shape()) * get_element_type().size() != m_buffer_size)
+    else if (packed::byte_size(get_element_type(), shape_size(m_descriptor->get_shape())) !=
+             m_buffer_size)
     {
         // A buffer is allocated but is the wrong size
         ngraph_free(m_allocated_buffer_pool);
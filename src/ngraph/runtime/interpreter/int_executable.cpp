@@ -30,6 +30,8 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/specialize_function.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -37,6 +39,19 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+// A copy of a u1, u4 or i4 tensor with a byte per element, for the reference kernels
+static shared_ptr<runtime::HostTensor> unpack_tensor(const shared_ptr<runtime::HostTensor>& tensor)
+{
+    const element::Type& type = tensor->get_element_type();
+    auto unpacked = make_shared<runtime::HostTensor>(type.is_signed() ? element::i8 : element::u8,
+                                                     tensor->get_shape());
+    packed::unpack(type,
+                   tensor->get_data_ptr(),
+                   static_cast<uint8_t*>(unpacked->get_data_ptr()),
+                   shape_size(tensor->get_shape()));
+    return unpacked;
+}
+
 runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(const Node& node)
 {
     const NodeTypeInfo& type_info = node.get_type_info();
@@ -79,6 +94,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         {
         case OP_TYPEID::Clamp_v0:
         case OP_TYPEID::MatMul_v0:
+        case OP_TYPEID::TensorIterator_v0:
         {
             retval = true;
             break;
@@ -101,7 +117,11 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     {
         m_nodes.push_back(node);
     }
+    create_tensor_iterators();
     set_parameters_and_results(*m_function);
+    // Both sides of the passes are checked, since a decomposition may have baked the shapes of
+    // this compilation into constants of otherwise polymorphic ops
+    m_shape_polymorphic = is_shape_polymorphic(function) && is_shape_polymorphic(m_function);
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -113,9 +133,54 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     {
         m_nodes.push_back(node);
     }
+    create_tensor_iterators();
     set_parameters_and_results(*m_function);
 }
 
+runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
+                                                   const INTExecutable& compiled)
+    : m_is_compiled{true}
+    , m_nan_check_enabled{compiled.m_nan_check_enabled}
+    , m_performance_counters_enabled{compiled.m_performance_counters_enabled}
+    , m_shape_polymorphic{true}
+    , m_function{function}
+{
+    for (auto node : m_function->get_ordered_ops())
+    {
+        m_nodes.push_back(node);
+    }
+    create_tensor_iterators();
+    set_parameters_and_results(*m_function);
+}
+
+// Bodies are compiled here rather than on first use so that concurrent calls only read the map
+void runtime::interpreter::INTExecutable::create_tensor_iterators()
+{
+    for (auto& node : m_nodes)
+    {
+        if (auto tensor_iterator = as_type_ptr<op::v0::TensorIterator>(node))
+        {
+            m_tensor_iterators[node.get()] = make_shared<TensorIteratorRunner>(
+                *tensor_iterator, runtime::Backend::create("INTERPRETER"));
+        }
+    }
+}
+
+shared_ptr<runtime::Executable>
+    runtime::interpreter::INTExecutable::rebind(const vector<Shape>& input_shapes)
+{
+    if (!m_shape_polymorphic)
+    {
+        return nullptr;
+    }
+    auto function = rebind_function(m_function, input_shapes);
+    if (!function)
+    {
+        return nullptr;
+    }
+    return shared_ptr<INTExecutable>(new INTExecutable(function, *this));
+}
+
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -230,6 +295,18 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             type = op->get_output_element_type(0);
         }
 
+        if (is_type<op::v0::Dequantize>(op) && packed::is_packed(type))
+        {
+            op_inputs[0] = unpack_tensor(op_inputs[0]);
+            op_inputs[2] = unpack_tensor(op_inputs[2]);
+            type = op_inputs[0]->get_element_type();
+        }
+        else if (op->is_constant() && packed::is_packed(type))
+        {
+            // Packed constants are copied byte by byte
+            type = element::u8;
+        }
+
         if (m_performance_counters_enabled)
         {
             m_timer_map[op].start();
@@ -269,6 +346,8 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     case element::Type_t::u64: op_engine<uint64_t>(op, out, in); break;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::bf16:
     case element::Type_t::f16:
@@ -374,6 +453,16 @@ shared_ptr<runtime::Tensor>
                                             parameter->get_output_shape(0));
 }
 
+shared_ptr<runtime::Tensor>
+    runtime::interpreter::INTExecutable::create_input_tensor(size_t input_index,
+                                                             void* memory_pointer)
+{
+    shared_ptr<op::v0::Parameter> parameter = get_parameter(input_index);
+    return make_shared<runtime::HostTensor>(parameter->get_output_element_type(0),
+                                            parameter->get_output_shape(0),
+                                            memory_pointer);
+}
+
 shared_ptr<runtime::Tensor>
     runtime::interpreter::INTExecutable::create_output_tensor(size_t output_index)
 {
@@ -382,6 +471,15 @@ shared_ptr<runtime::Tensor>
                                             result->get_output_shape(0));
 }
 
+shared_ptr<runtime::Tensor>
+    runtime::interpreter::INTExecutable::create_output_tensor(size_t output_index,
+                                                              void* memory_pointer)
+{
+    shared_ptr<op::v0::Result> result = get_result(output_index);
+    return make_shared<runtime::HostTensor>(
+        result->get_output_element_type(0), result->get_output_shape(0), memory_pointer);
+}
+
 vector<shared_ptr<runtime::Tensor>>
     runtime::interpreter::INTExecutable::create_input_tensor(size_t input_index,
                                                              size_t pipeline_depth)
@@ -48,6 +48,7 @@
 #include "ngraph/runtime/reference/avg_pool.hpp"
 #include "ngraph/runtime/reference/batch_mat_mul.hpp"
 #include "ngraph/runtime/reference/batch_norm.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/broadcast_distributed.hpp"
 #include "ngraph/runtime/reference/ceiling.hpp"
@@ -124,6 +125,7 @@
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
 #include "ngraph/slice_plan.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
@@ -171,10 +173,20 @@ public:
 
     std::vector<PerformanceCounter> get_performance_data() const override;
 
+    /// \brief Reuses the passes this executable ran if its Function is shape polymorphic. The
+    ///        reference kernels read their sizes from the rebound nodes.
+    std::shared_ptr<Executable> rebind(const std::vector<Shape>& input_shapes) override;
+
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
+    std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
+                                                         void* memory_pointer) override;
+
     std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) override;
 
+    std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index,
+                                                          void* memory_pointer) override;
+
     std::vector<std::shared_ptr<runtime::Tensor>>
         create_input_tensor(size_t input_index, size_t pipeline_depth) override;
 
@@ -184,6 +196,9 @@ public:
 protected:
     INTExecutable(const std::string& model_string);
 
+    /// \brief Wraps a Function that went through the interpreter passes already.
+    INTExecutable(const std::shared_ptr<Function>& function, const INTExecutable& compiled);
+
     template <typename T>
     std::vector<T> as_vector(const HostTensor* tensor) const
     {
@@ -267,6 +282,8 @@ protected:
         return result;
     }
 
+    void create_tensor_iterators();
+
     Coordinate as_coordinate(const HostTensor* tensor) const;
     Strides as_strides(const HostTensor* tensor) const;
     Shape as_shape(const HostTensor* tensor) const;
@@ -279,10 +296,13 @@ protected:
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
+    bool m_shape_polymorphic = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     NodeVector m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    // One runner per TensorIterator, each with its body compiled at construction
+    std::unordered_map<const Node*, std::shared_ptr<TensorIteratorRunner>> m_tensor_iterators;
     std::set<std::string> m_unsupported_op_name_list;
 
     static OP_TYPEID get_typeid(const Node& node);
@@ -569,6 +589,26 @@ protected:
                                             apb->get_include_padding_in_avg_computation());
             break;
         }
+        case OP_TYPEID::BinaryConvolution_v1:
+        {
+            const op::v1::BinaryConvolution* conv =
+                static_cast<const op::v1::BinaryConvolution*>(&node);
+            if (node.get_input_element_type(1) != element::u1)
+            {
+                throw unsupported_op("BinaryConvolution filters must be u1");
+            }
+            reference::binary_convolution<T>(args[0]->get_data_ptr<const T>(),
+                                             args[1]->get_data_ptr<const uint8_t>(),
+                                             out[0]->get_data_ptr<T>(),
+                                             args[0]->get_shape(),
+                                             args[1]->get_shape(),
+                                             node.get_output_shape(0),
+                                             conv->get_strides(),
+                                             conv->get_dilations(),
+                                             conv->get_pads_begin(),
+                                             conv->get_pad_value());
+            break;
+        }
         case OP_TYPEID::Broadcast_v0:
         {
             const op::v0::Broadcast* broadcast = static_cast<const op::v0::Broadcast*>(&node);
@@ -650,7 +690,7 @@ protected:
         case OP_TYPEID::Constant_v0:
         {
             const op::v0::Constant* c = static_cast<const op::v0::Constant*>(&node);
-            size_t element_count = shape_size(node.get_output_shape(0));
+            size_t element_count = out[0]->get_size_in_bytes() / sizeof(T);
             reference::constant<T>(c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
@@ -719,6 +759,8 @@ protected:
                 break;
             case element::Type_t::undefined:
             case element::Type_t::dynamic:
+            case element::Type_t::i4:
+            case element::Type_t::u4:
             case element::Type_t::u1:
             case element::Type_t::bf16:
             case element::Type_t::f16:
@@ -2152,6 +2194,21 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::TensorIterator_v0:
+        {
+            std::vector<void*> outputs;
+            for (auto& tensor : out)
+            {
+                outputs.push_back(tensor->get_data_ptr());
+            }
+            std::vector<void*> inputs;
+            for (auto& tensor : args)
+            {
+                inputs.push_back(tensor->get_data_ptr());
+            }
+            m_tensor_iterators.at(&node)->run(outputs, inputs);
+            break;
+        }
         case OP_TYPEID::TopK_v0:
         {
             const op::v0::TopK* topk = static_cast<const op::v0::TopK*>(&node);
@@ -2206,7 +2263,6 @@ protected:
         case OP_TYPEID::AvgPool_v1:
         case OP_TYPEID::BatchMatMulTranspose_v0:
         case OP_TYPEID::BatchToSpace_v1:
-        case OP_TYPEID::BinaryConvolution_v1:
         case OP_TYPEID::Broadcast_v1:
         case OP_TYPEID::Broadcast_v3:
         case OP_TYPEID::Bucketize_v3:
@@ -2292,7 +2348,6 @@ protected:
         case OP_TYPEID::SquaredDifference_v0:
         case OP_TYPEID::Squeeze_v0:
         case OP_TYPEID::Stack_v0:
-        case OP_TYPEID::TensorIterator_v0:
         case OP_TYPEID::Tile_v0:
         case OP_TYPEID::TopK_v1:
         case OP_TYPEID::TopK_v3:
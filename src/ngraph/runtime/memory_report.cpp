@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <ostream>
+
+#include "ngraph/runtime/memory_report.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr const char* runtime::MemoryReport::constants;
+constexpr const char* runtime::MemoryReport::intermediates;
+constexpr const char* runtime::MemoryReport::scratchpad;
+constexpr const char* runtime::MemoryReport::workspaces;
+constexpr const char* runtime::MemoryReport::functions;
+
+void runtime::MemoryReport::add(const string& category, size_t bytes)
+{
+    m_categories[category] += bytes;
+}
+
+void runtime::MemoryReport::add_op(const string& op, const string& category, size_t bytes)
+{
+    m_ops[op][category] += bytes;
+}
+
+void runtime::MemoryReport::add_saved(const string& category, size_t bytes)
+{
+    m_saved[category] += bytes;
+}
+
+void runtime::MemoryReport::merge(const MemoryReport& other)
+{
+    for (auto& category : other.m_categories)
+    {
+        m_categories[category.first] += category.second;
+    }
+    for (auto& op : other.m_ops)
+    {
+        for (auto& category : op.second)
+        {
+            m_ops[op.first][category.first] += category.second;
+        }
+    }
+    for (auto& category : other.m_saved)
+    {
+        m_saved[category.first] += category.second;
+    }
+    m_peak_bytes += other.m_peak_bytes;
+}
+
+size_t runtime::MemoryReport::get_bytes(const string& category) const
+{
+    auto it = m_categories.find(category);
+    return it == m_categories.end() ? 0 : it->second;
+}
+
+size_t runtime::MemoryReport::get_saved_bytes(const string& category) const
+{
+    auto it = m_saved.find(category);
+    return it == m_saved.end() ? 0 : it->second;
+}
+
+size_t runtime::MemoryReport::get_total_bytes() const
+{
+    size_t total = 0;
+    for (auto& category : m_categories)
+    {
+        total += category.second;
+    }
+    return total;
+}
+
+ostream& runtime::operator<<(ostream& out, const MemoryReport& report)
+{
+    out << "total " << report.get_total_bytes() << " bytes, peak " << report.get_peak_bytes()
+        << " bytes\n";
+    for (auto& category : report.get_categories())
+    {
+        out << "    " << category.first << ": " << category.second << "\n";
+    }
+    for (auto& category : report.get_saved())
+    {
+        out << "    saved " << category.first << ": " << category.second << "\n";
+    }
+    for (auto& op : report.get_ops())
+    {
+        out << "    " << op.first << ":";
+        for (auto& category : op.second)
+        {
+            out << " " << category.first << "=" << category.second;
+        }
+        out << "\n";
+    }
+    return out;
+}
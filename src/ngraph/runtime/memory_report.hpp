@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <string>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Breakdown of the memory held by a compiled Executable.
+        ///
+        /// Bytes are grouped into named categories (see the constants below) and, where a
+        /// backend can attribute them, into per-op totals keyed by node name. Per-op bytes are
+        /// what each op asks for; a backend that reuses memory between ops may hold less than
+        /// their sum. The peak is the high-water mark observed while executing, including every
+        /// call context that was live at the same time.
+        class NGRAPH_API MemoryReport
+        {
+        public:
+            static constexpr const char* constants = "constants";
+            static constexpr const char* intermediates = "intermediates";
+            static constexpr const char* scratchpad = "scratchpad";
+            static constexpr const char* workspaces = "workspaces";
+            static constexpr const char* functions = "functions";
+
+            using CategoryMap = std::map<std::string, size_t>;
+
+            /// \brief Add bytes to a category.
+            void add(const std::string& category, size_t bytes);
+            /// \brief Attribute bytes of a category to the named op. The category total is
+            ///        not changed.
+            void add_op(const std::string& op, const std::string& category, size_t bytes);
+            /// \brief Record bytes of a category that the backend avoided holding, e.g. by
+            ///        sharing memory with another category. Totals are not changed.
+            void add_saved(const std::string& category, size_t bytes);
+            /// \brief Add every category, op and the peak of another report to this one.
+            void merge(const MemoryReport& other);
+
+            size_t get_bytes(const std::string& category) const;
+            size_t get_total_bytes() const;
+            const CategoryMap& get_categories() const { return m_categories; }
+            const std::map<std::string, CategoryMap>& get_ops() const { return m_ops; }
+            size_t get_saved_bytes(const std::string& category) const;
+            const CategoryMap& get_saved() const { return m_saved; }
+            size_t get_peak_bytes() const { return m_peak_bytes; }
+            void set_peak_bytes(size_t bytes) { m_peak_bytes = bytes; }
+
+        private:
+            CategoryMap m_categories;
+            std::map<std::string, CategoryMap> m_ops;
+            CategoryMap m_saved;
+            size_t m_peak_bytes = 0;
+        };
+
+        NGRAPH_API
+        std::ostream& operator<<(std::ostream& out, const MemoryReport& report);
+    }
+}
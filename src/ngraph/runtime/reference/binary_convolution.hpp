@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+#include "ngraph/type/packed.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            inline size_t popcount(uint64_t value)
+            {
+#if defined(_MSC_VER)
+                return static_cast<size_t>(__popcnt64(value));
+#else
+                return static_cast<size_t>(__builtin_popcountll(value));
+#endif
+            }
+
+            // data: N, C, D...
+            // filter: O, C, K... packed as u1
+            // out: N, O, Q...
+            //
+            // Data values and a pad value greater than zero are 1 bits, all others are 0 bits.
+            // Bits stand for +1 and -1, so every output is the number of agreeing bits minus the
+            // number of differing bits over the receptive field, computed with XOR and popcount
+            // on 64 channels at a time.
+            template <typename T>
+            void binary_convolution(const T* data,
+                                    const uint8_t* filter,
+                                    T* out,
+                                    const Shape& data_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& strides,
+                                    const Strides& dilations,
+                                    const CoordinateDiff& pads_begin,
+                                    float pad_value)
+            {
+                const size_t batch = data_shape[0];
+                const size_t channels = data_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const size_t words = (channels + 63) / 64;
+                const Shape data_spatial(data_shape.begin() + 2, data_shape.end());
+                const Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+                const Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+                const size_t data_positions = shape_size(data_spatial);
+                const size_t filter_positions = shape_size(filter_spatial);
+                const size_t out_positions = shape_size(out_spatial);
+
+                // Channel c of a position is bit c % 64 of word c / 64
+                std::vector<uint64_t> data_bits(batch * data_positions * words, 0);
+                for (size_t n = 0; n < batch; n++)
+                {
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        const T* channel = data + (n * channels + c) * data_positions;
+                        for (size_t p = 0; p < data_positions; p++)
+                        {
+                            if (channel[p] > T(0))
+                            {
+                                data_bits[(n * data_positions + p) * words + c / 64] |=
+                                    uint64_t(1) << (c % 64);
+                            }
+                        }
+                    }
+                }
+
+                std::vector<uint64_t> filter_bits(out_channels * filter_positions * words, 0);
+                for (size_t o = 0; o < out_channels; o++)
+                {
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        for (size_t k = 0; k < filter_positions; k++)
+                        {
+                            if (packed::get_u1(filter, (o * channels + c) * filter_positions + k))
+                            {
+                                filter_bits[(o * filter_positions + k) * words + c / 64] |=
+                                    uint64_t(1) << (c % 64);
+                            }
+                        }
+                    }
+                }
+
+                std::vector<uint64_t> pad_bits(words, pad_value > 0 ? ~uint64_t(0) : 0);
+                if (channels % 64 != 0)
+                {
+                    pad_bits.back() &= (uint64_t(1) << (channels % 64)) - 1;
+                }
+
+                // The data position read by every output and filter position, -1 in the padding
+                std::vector<int64_t> positions;
+                positions.reserve(out_positions * filter_positions);
+                CoordinateTransform out_transform(out_spatial);
+                CoordinateTransform filter_transform(filter_spatial);
+                for (const Coordinate& out_coord : out_transform)
+                {
+                    for (const Coordinate& filter_coord : filter_transform)
+                    {
+                        int64_t position = 0;
+                        for (size_t d = 0; d < out_coord.size() && position >= 0; d++)
+                        {
+                            int64_t i = static_cast<int64_t>(out_coord[d] * strides[d] +
+                                                             filter_coord[d] * dilations[d]) -
+                                        pads_begin[d];
+                            int64_t size = static_cast<int64_t>(data_spatial[d]);
+                            position = (i < 0 || i >= size) ? -1 : position * size + i;
+                        }
+                        positions.push_back(position);
+                    }
+                }
+
+                for (size_t n = 0; n < batch; n++)
+                {
+                    const uint64_t* batch_bits = data_bits.data() + n * data_positions * words;
+                    for (size_t o = 0; o < out_channels; o++)
+                    {
+                        const uint64_t* out_filter_bits =
+                            filter_bits.data() + o * filter_positions * words;
+                        T* out_channel = out + (n * out_channels + o) * out_positions;
+                        const int64_t* position = positions.data();
+                        for (size_t q = 0; q < out_positions; q++)
+                        {
+                            int64_t sum = 0;
+                            for (size_t k = 0; k < filter_positions; k++, position++)
+                            {
+                                const uint64_t* x = *position < 0
+                                                        ? pad_bits.data()
+                                                        : batch_bits + *position * words;
+                                const uint64_t* w = out_filter_bits + k * words;
+                                size_t differ = 0;
+                                for (size_t i = 0; i < words; i++)
+                                {
+                                    differ += popcount(x[i] ^ w[i]);
+                                }
+                                sum += static_cast<int64_t>(channels) -
+                                       2 * static_cast<int64_t>(differ);
+                            }
+                            out_channel[q] = static_cast<T>(sum);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
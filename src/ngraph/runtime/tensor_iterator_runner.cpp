@@ -0,0 +1,339 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using TensorIterator = op::v0::TensorIterator;
+
+// First index along the axis of the part taken on an iteration; a negative stride walks the
+// axis backwards from start
+static int64_t slice_begin(
+    int64_t start, int64_t stride, int64_t part_size, int64_t iteration, int64_t dim_size)
+{
+    if (start < 0)
+    {
+        start += dim_size;
+    }
+    int64_t begin = start + iteration * stride;
+    return stride < 0 ? begin - part_size + 1 : begin;
+}
+
+static bool is_contiguous_slice(const Shape& shape, int64_t axis)
+{
+    return shape_size(Shape(shape.begin(), shape.begin() + axis)) == 1;
+}
+
+// Copies the part [begin, begin + part_size) along axis between a tensor and its slice
+static void copy_slice(char* full,
+                       char* part,
+                       const Shape& full_shape,
+                       int64_t axis,
+                       int64_t begin,
+                       int64_t part_size,
+                       const element::Type& type,
+                       bool into_full)
+{
+    size_t outer = shape_size(Shape(full_shape.begin(), full_shape.begin() + axis));
+    size_t inner =
+        shape_size(Shape(full_shape.begin() + axis + 1, full_shape.end())) * type.size();
+    size_t full_row = full_shape[axis] * inner;
+    size_t part_row = part_size * inner;
+    for (size_t i = 0; i < outer; i++)
+    {
+        char* full_ptr = full + i * full_row + begin * inner;
+        char* part_ptr = part + i * part_row;
+        if (into_full)
+        {
+            memcpy(full_ptr, part_ptr, part_row);
+        }
+        else
+        {
+            memcpy(part_ptr, full_ptr, part_row);
+        }
+    }
+}
+
+static size_t slice_row_bytes(const Shape& full_shape, int64_t axis, const element::Type& type)
+{
+    return shape_size(Shape(full_shape.begin() + axis + 1, full_shape.end())) * type.size();
+}
+
+runtime::TensorIteratorRunner::TensorIteratorRunner(const TensorIterator& tensor_iterator,
+                                                    const shared_ptr<Backend>& backend)
+    : m_backend(backend)
+    , m_num_iterations(tensor_iterator.get_num_iterations())
+    , m_input_descriptions(tensor_iterator.get_input_descriptions())
+    , m_output_descriptions(tensor_iterator.get_output_descriptions())
+{
+    NGRAPH_CHECK(m_num_iterations > 0,
+                 "TensorIterator '",
+                 tensor_iterator.get_name(),
+                 "' has an unknown number of iterations");
+    for (size_t i = 0; i < tensor_iterator.get_input_size(); i++)
+    {
+        m_input_shapes.push_back(tensor_iterator.get_input_shape(i));
+    }
+    for (size_t i = 0; i < tensor_iterator.get_output_size(); i++)
+    {
+        m_output_shapes.push_back(tensor_iterator.get_output_shape(i));
+    }
+
+    // The backend rewrites what it compiles, so the body is compiled from a copy
+    auto body = tensor_iterator.get_body();
+    auto function = clone_function(
+        *make_shared<Function>(body->get_results(), body->get_parameters()));
+    for (auto parameter : function->get_parameters())
+    {
+        m_parameter_types.push_back(parameter->get_element_type());
+        m_parameter_shapes.push_back(parameter->get_output_shape(0));
+    }
+    for (auto result : function->get_results())
+    {
+        m_result_types.push_back(result->get_output_element_type(0));
+        m_result_shapes.push_back(result->get_output_shape(0));
+    }
+    m_body = m_backend->compile(function);
+
+    size_t num_results = m_result_shapes.size();
+    m_result_placements.assign(num_results, ResultPlacement::Scratch);
+    m_result_concat_output.assign(num_results, 0);
+    m_parameter_buffers.resize(m_parameter_shapes.size());
+    for (auto& buffers : m_result_buffers)
+    {
+        buffers.resize(num_results);
+    }
+
+    for (auto desc : m_input_descriptions)
+    {
+        auto parameter_index = desc->m_body_parameter_index;
+        if (auto slice = as_type_ptr<TensorIterator::SliceInputDescription>(desc))
+        {
+            if (!is_contiguous_slice(m_input_shapes.at(desc->m_input_index), slice->m_axis))
+            {
+                m_parameter_buffers[parameter_index].reset(new AlignedBuffer(
+                    shape_size(m_parameter_shapes[parameter_index]) *
+                    m_parameter_types[parameter_index].size()));
+            }
+        }
+        else if (auto merged = as_type_ptr<TensorIterator::MergedInputDescription>(desc))
+        {
+            m_result_placements.at(merged->m_body_value_index) = ResultPlacement::BackEdge;
+        }
+    }
+    for (auto desc : m_output_descriptions)
+    {
+        auto concat = as_type_ptr<TensorIterator::ConcatOutputDescription>(desc);
+        auto& placement = m_result_placements.at(desc->m_body_value_index);
+        if (concat && placement != ResultPlacement::ConcatSlice &&
+            is_contiguous_slice(m_output_shapes.at(desc->m_output_index), concat->m_axis))
+        {
+            placement = ResultPlacement::ConcatSlice;
+            m_result_concat_output[desc->m_body_value_index] = desc->m_output_index;
+        }
+    }
+    for (size_t i = 0; i < num_results; i++)
+    {
+        size_t byte_size = shape_size(m_result_shapes[i]) * m_result_types[i].size();
+        switch (m_result_placements[i])
+        {
+        case ResultPlacement::BackEdge:
+            m_result_buffers[1][i].reset(new AlignedBuffer(byte_size));
+            m_result_buffers[0][i].reset(new AlignedBuffer(byte_size));
+            break;
+        case ResultPlacement::Scratch:
+            m_result_buffers[0][i].reset(new AlignedBuffer(byte_size));
+            break;
+        case ResultPlacement::ConcatSlice: break;
+        }
+    }
+}
+
+shared_ptr<runtime::Tensor> runtime::TensorIteratorRunner::wrap(const element::Type& type,
+                                                                const Shape& shape,
+                                                                void* data)
+{
+    return m_backend->create_tensor(type, shape, data);
+}
+
+void runtime::TensorIteratorRunner::run(const vector<void*>& outputs, const vector<void*>& inputs)
+{
+    lock_guard<mutex> guard(m_mutex);
+    size_t num_results = m_result_shapes.size();
+    vector<shared_ptr<Tensor>> parameters(m_parameter_shapes.size());
+    vector<shared_ptr<Tensor>> results(num_results);
+    vector<char*> result_data(num_results);
+
+    // Invariant inputs, initial values of back edges and staged slices are bound once
+    for (auto desc : m_input_descriptions)
+    {
+        auto index = desc->m_body_parameter_index;
+        void* data = inputs.at(desc->m_input_index);
+        if (m_parameter_buffers[index])
+        {
+            data = m_parameter_buffers[index]->get_ptr();
+        }
+        else if (is_type<TensorIterator::SliceInputDescription>(desc))
+        {
+            continue;
+        }
+        parameters[index] = wrap(m_parameter_types[index], m_parameter_shapes[index], data);
+    }
+    vector<shared_ptr<Tensor>> result_buffers[2];
+    for (size_t b = 0; b < 2; b++)
+    {
+        result_buffers[b].resize(num_results);
+        for (size_t i = 0; i < num_results; i++)
+        {
+            if (m_result_buffers[b][i])
+            {
+                result_buffers[b][i] = wrap(
+                    m_result_types[i], m_result_shapes[i], m_result_buffers[b][i]->get_ptr());
+            }
+        }
+    }
+
+    for (int64_t iteration = 0; iteration < m_num_iterations; iteration++)
+    {
+        for (auto desc : m_input_descriptions)
+        {
+            auto slice = as_type_ptr<TensorIterator::SliceInputDescription>(desc);
+            if (!slice)
+            {
+                continue;
+            }
+            auto index = desc->m_body_parameter_index;
+            const Shape& input_shape = m_input_shapes[desc->m_input_index];
+            char* input = static_cast<char*>(inputs[desc->m_input_index]);
+            int64_t begin = slice_begin(slice->m_start,
+                                        slice->m_stride,
+                                        slice->m_part_size,
+                                        iteration,
+                                        input_shape[slice->m_axis]);
+            if (m_parameter_buffers[index])
+            {
+                copy_slice(input,
+                           m_parameter_buffers[index]->get_ptr<char>(),
+                           input_shape,
+                           slice->m_axis,
+                           begin,
+                           slice->m_part_size,
+                           m_parameter_types[index],
+                           false);
+            }
+            else
+            {
+                size_t offset =
+                    begin * slice_row_bytes(input_shape, slice->m_axis, m_parameter_types[index]);
+                parameters[index] =
+                    wrap(m_parameter_types[index], m_parameter_shapes[index], input + offset);
+            }
+        }
+
+        for (size_t i = 0; i < num_results; i++)
+        {
+            switch (m_result_placements[i])
+            {
+            case ResultPlacement::Scratch:
+            case ResultPlacement::BackEdge:
+            {
+                // back edges alternate between two buffers so the body never overwrites the
+                // state it is reading
+                size_t b = m_result_placements[i] == ResultPlacement::BackEdge ? iteration % 2 : 0;
+                results[i] = result_buffers[b][i];
+                result_data[i] = m_result_buffers[b][i]->get_ptr<char>();
+                break;
+            }
+            case ResultPlacement::ConcatSlice:
+            {
+                auto output_index = m_result_concat_output[i];
+                auto concat = static_pointer_cast<TensorIterator::ConcatOutputDescription>(
+                    m_output_descriptions.at(output_index));
+                const Shape& output_shape = m_output_shapes[output_index];
+                int64_t begin = slice_begin(concat->m_start,
+                                            concat->m_stride,
+                                            concat->m_part_size,
+                                            iteration,
+                                            output_shape[concat->m_axis]);
+                size_t offset =
+                    begin * slice_row_bytes(output_shape, concat->m_axis, m_result_types[i]);
+                result_data[i] = static_cast<char*>(outputs[output_index]) + offset;
+                results[i] = wrap(m_result_types[i], m_result_shapes[i], result_data[i]);
+                break;
+            }
+            }
+        }
+
+        m_body->call(results, parameters);
+
+        for (auto desc : m_output_descriptions)
+        {
+            auto value_index = desc->m_body_value_index;
+            auto output_index = desc->m_output_index;
+            char* output = static_cast<char*>(outputs[output_index]);
+            if (auto concat = as_type_ptr<TensorIterator::ConcatOutputDescription>(desc))
+            {
+                if (m_result_placements[value_index] == ResultPlacement::ConcatSlice &&
+                    m_result_concat_output[value_index] == output_index)
+                {
+                    continue;
+                }
+                const Shape& output_shape = m_output_shapes[output_index];
+                copy_slice(output,
+                           result_data[value_index],
+                           output_shape,
+                           concat->m_axis,
+                           slice_begin(concat->m_start,
+                                       concat->m_stride,
+                                       concat->m_part_size,
+                                       iteration,
+                                       output_shape[concat->m_axis]),
+                           concat->m_part_size,
+                           m_result_types[value_index],
+                           true);
+            }
+            else if (auto body_output =
+                         as_type_ptr<TensorIterator::BodyOutputDescription>(desc))
+            {
+                int64_t target = body_output->m_iteration < 0
+                                     ? body_output->m_iteration + m_num_iterations
+                                     : body_output->m_iteration;
+                if (target == iteration)
+                {
+                    memcpy(output,
+                           result_data[value_index],
+                           shape_size(m_output_shapes[output_index]) *
+                               m_result_types[value_index].size());
+                }
+            }
+        }
+
+        // the next iteration reads the back edges where this one wrote them
+        for (auto desc : m_input_descriptions)
+        {
+            if (auto merged = as_type_ptr<TensorIterator::MergedInputDescription>(desc))
+            {
+                parameters[desc->m_body_parameter_index] = results[merged->m_body_value_index];
+            }
+        }
+    }
+}
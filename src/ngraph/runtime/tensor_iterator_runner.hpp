@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class TensorIteratorRunner;
+    }
+}
+
+/// \brief Executes a TensorIterator by running its body, compiled once, for every iteration.
+///
+/// Nothing is unrolled. Slices of the sequence inputs and of the concatenated outputs that are
+/// contiguous in memory are passed to the body in place. A back edge reads the tensor its
+/// value was written to in the previous iteration, so loop-carried state is never copied.
+class NGRAPH_API ngraph::runtime::TensorIteratorRunner
+{
+public:
+    /// \brief Compiles the body of a TensorIterator.
+    /// \param tensor_iterator The TensorIterator; its shapes must be static.
+    /// \param backend The backend that compiles the body and wraps the iteration buffers.
+    TensorIteratorRunner(const op::v0::TensorIterator& tensor_iterator,
+                         const std::shared_ptr<Backend>& backend);
+
+    /// \brief Runs every iteration.
+    /// \param outputs Buffers of the TensorIterator outputs
+    /// \param inputs Buffers of the TensorIterator inputs
+    void run(const std::vector<void*>& outputs, const std::vector<void*>& inputs);
+
+private:
+    using InputDescription = op::v0::TensorIterator::InputDescription;
+    using OutputDescription = op::v0::TensorIterator::OutputDescription;
+
+    // where the body writes a result on a given iteration
+    enum class ResultPlacement
+    {
+        Scratch,
+        BackEdge,
+        ConcatSlice
+    };
+
+    std::shared_ptr<Tensor> wrap(const element::Type& type, const Shape& shape, void* data);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Executable> m_body;
+    int64_t m_num_iterations;
+    std::vector<std::shared_ptr<InputDescription>> m_input_descriptions;
+    std::vector<std::shared_ptr<OutputDescription>> m_output_descriptions;
+    std::vector<Shape> m_input_shapes;
+    std::vector<Shape> m_output_shapes;
+    std::vector<element::Type> m_parameter_types;
+    std::vector<Shape> m_parameter_shapes;
+    std::vector<element::Type> m_result_types;
+    std::vector<Shape> m_result_shapes;
+    std::vector<ResultPlacement> m_result_placements;
+    // the concat output a ConcatSlice result is written into
+    std::vector<size_t> m_result_concat_output;
+    // per body parameter, staging for strided slices; per body result, scratch or back edges
+    std::vector<std::unique_ptr<AlignedBuffer>> m_parameter_buffers;
+    std::vector<std::unique_ptr<AlignedBuffer>> m_result_buffers[2];
+    std::mutex m_mutex;
+};
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <queue>
@@ -28,7 +30,9 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/type/packed.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 
@@ -176,6 +180,12 @@ public:
         m_binary_constant_data = binary_constant_data;
     }
 
+    /// The writer stores the data of a Constant out of line and returns its offset
+    void set_constant_data_writer(function<size_t(const op::v0::Constant&)> writer)
+    {
+        m_constant_data_writer = writer;
+    }
+
     json serialize_function(const Function& function);
     json serialize_output(const Output<Node>& output);
     json serialize_parameter_vector(const ParameterVector& parameters);
@@ -191,6 +201,7 @@ protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
+    function<size_t(const op::v0::Constant&)> m_constant_data_writer;
     json m_json_nodes;
 };
 
@@ -277,6 +288,12 @@ public:
         m_const_data_callback = const_data_callback;
     }
 
+    /// Constants with out of line data are created in place over this buffer
+    void set_constant_data(shared_ptr<runtime::AlignedBuffer> constant_data)
+    {
+        m_constant_data = constant_data;
+    }
+
     shared_ptr<Function> deserialize_function(json j);
     Output<Node> deserialize_output(json j);
     OutputVector deserialize_output_vector(json j);
@@ -293,6 +310,7 @@ protected:
     unordered_map<string, shared_ptr<Node>> m_node_map;
     unordered_map<string, shared_ptr<Function>> m_function_map;
     function<const_data_callback_t> m_const_data_callback;
+    shared_ptr<runtime::AlignedBuffer> m_constant_data;
     map<string, Output<Node>> m_goe_alias;
 };
 
@@ -424,6 +442,109 @@ static element::Type read_element_type(json j)
     return rc;
 }
 
+static size_t constant_byte_size(const op::v0::Constant& constant)
+{
+    return packed::byte_size(constant.get_output_element_type(0),
+                             shape_size(constant.get_output_shape(0)));
+}
+
+// A binary serialized Function is laid out as
+//   header, padded to binary_alignment bytes
+//   the data of every Constant, each starting on a binary_alignment boundary
+//   the json graph, where Constants refer to their data by file offset
+static const char binary_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', 'N'};
+static const uint64_t binary_version = 1;
+static const size_t binary_alignment = 64;
+
+struct BinaryHeader
+{
+    char magic[8];
+    uint64_t version;
+    uint64_t graph_offset;
+    uint64_t graph_size;
+};
+
+static bool is_binary_file(const string& path)
+{
+    char magic[sizeof(binary_magic)] = {};
+    ifstream in(path, ios_base::binary | ios_base::in);
+    in.read(magic, sizeof(magic));
+    return in && memcmp(magic, binary_magic, sizeof(magic)) == 0;
+}
+
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    NGRAPH_CHECK(out, "error opening file '", path, "'");
+
+    const vector<char> padding(binary_alignment, 0);
+    out.write(padding.data(), padding.size());
+    uint64_t offset = padding.size();
+
+    // Constants that share a buffer, e.g. clones, are only written once
+    unordered_map<const void*, uint64_t> written;
+    JSONSerializer serializer;
+    serializer.set_constant_data_writer([&](const op::v0::Constant& constant) {
+        auto it = written.find(constant.get_data_ptr());
+        if (it != written.end())
+        {
+            return it->second;
+        }
+        uint64_t data_offset = offset;
+        size_t size = constant_byte_size(constant);
+        out.write(static_cast<const char*>(constant.get_data_ptr()), size);
+        size_t pad = (binary_alignment - size % binary_alignment) % binary_alignment;
+        out.write(padding.data(), pad);
+        offset += size + pad;
+        written[constant.get_data_ptr()] = data_offset;
+        return data_offset;
+    });
+
+    json j;
+    j.push_back(serializer.serialize_function(*func));
+    string graph = j.dump();
+    out.write(graph.data(), graph.size());
+
+    BinaryHeader header;
+    memcpy(header.magic, binary_magic, sizeof(binary_magic));
+    header.version = binary_version;
+    header.graph_offset = offset;
+    header.graph_size = graph.size();
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    NGRAPH_CHECK(out, "error writing file '", path, "'");
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize_binary(const string& path)
+{
+    shared_ptr<runtime::AlignedBuffer> buffer = file_util::map_file(path);
+    BinaryHeader header;
+    NGRAPH_CHECK(buffer->size() >= sizeof(header), "'", path, "' is not a serialized Function");
+    memcpy(&header, buffer->get_ptr(), sizeof(header));
+    NGRAPH_CHECK(memcmp(header.magic, binary_magic, sizeof(binary_magic)) == 0,
+                 "'",
+                 path,
+                 "' is not a serialized Function");
+    NGRAPH_CHECK(header.version == binary_version,
+                 "Unsupported serialization version ",
+                 header.version);
+    NGRAPH_CHECK(header.graph_offset + header.graph_size <= buffer->size(),
+                 "'",
+                 path,
+                 "' is truncated");
+
+    const char* graph = buffer->get_ptr<char>() + header.graph_offset;
+    json js = json::parse(graph, graph + header.graph_size);
+    JSONDeserializer deserializer;
+    deserializer.set_constant_data(buffer);
+    shared_ptr<Function> rc;
+    for (json func : js)
+    {
+        rc = deserializer.deserialize_function(func);
+    }
+    return rc;
+}
+
 void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
     ofstream out(path);
@@ -446,9 +567,7 @@ static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, s
                    [&](shared_ptr<Node> node) {
                        if (auto c = node->as_type<op::v0::Constant>())
                        {
-                           uint32_t size =
-                               static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                     c->get_output_element_type(0).size());
+                           uint32_t size = static_cast<uint32_t>(constant_byte_size(*c));
                            writer.write(c->get_name(), c->get_data_ptr(), size);
                        }
                    },
@@ -537,8 +656,15 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (is_binary_file(s))
+        {
+            rc = deserialize_binary(s);
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -1098,8 +1224,23 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::v0::Constant>(element_type, shape, value);
+            if (has_key(node_js, "data_offset"))
+            {
+                size_t offset = node_js.at("data_offset").get<size_t>();
+                size_t size = node_js.at("data_size").get<size_t>();
+                NGRAPH_CHECK(m_constant_data && offset + size <= m_constant_data->size(),
+                             "Data of Constant ",
+                             node_name,
+                             " is out of range");
+                auto data = make_shared<runtime::SharedBuffer>(
+                    m_constant_data->get_ptr<char>() + offset, size, m_constant_data);
+                node = make_shared<op::v0::Constant>(element_type, shape, data);
+            }
+            else
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::v0::Constant>(element_type, shape, value);
+            }
             break;
         }
         case OP_TYPEID::Convert_v0:
@@ -2494,17 +2635,23 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             {
                 body_nodes.push_back(deserialize_node(jnode));
             }
+            // Parameters and results used by the body were deserialized with its nodes, and
+            // must stay the same nodes so the body still refers to them
+            auto body_node = [&](json jnode) {
+                auto it = m_node_map.find(jnode.at("name").get<string>());
+                return it == m_node_map.end() ? deserialize_node(jnode) : it->second;
+            };
             json jparams = jbody["parameters"];
             ParameterVector parameters;
             for (json jparam : jparams)
             {
-                parameters.push_back(as_type_ptr<op::v0::Parameter>(deserialize_node(jparam)));
+                parameters.push_back(as_type_ptr<op::v0::Parameter>(body_node(jparam)));
             }
             json jresults = jbody["results"];
             ResultVector results;
             for (json jresult : jresults)
             {
-                results.push_back(as_type_ptr<op::v0::Result>(deserialize_node(jresult)));
+                results.push_back(as_type_ptr<op::v0::Result>(body_node(jresult)));
             }
             ti->set_body(make_shared<op::v0::TensorIterator::BodyLambda>(results, parameters));
             json jins = node_js["input_descriptions"];
@@ -2852,8 +2999,13 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant_v0:
     {
         auto tmp = static_cast<const op::v0::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() &&
-            shape_size(tmp->get_output_shape(0)) > 0)
+        if (m_constant_data_writer)
+        {
+            node["data_offset"] = m_constant_data_writer(*tmp);
+            node["data_size"] = constant_byte_size(*tmp);
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_output_shape(0)) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -51,13 +51,32 @@ namespace ngraph
     NGRAPH_API
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a binary file
+    ///
+    /// The graph is stored as compact json. The data of every Constant is stored separately, in
+    /// raw form and aligned to 64 bytes, so that deserialize_binary can use it in place.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Deserialize a Function written by serialize_binary
+    ///
+    /// The file is memory-mapped and Constants are created directly over their data in the
+    /// mapping, so constant data is neither parsed nor copied. The mapping stays alive as long
+    /// as any of the Constants does.
+    /// \param path The path of the file to deserialize
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function> deserialize_binary(const std::string& path);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string to deseriailze, or the path of a file written by
+    ///    serialize or serialize_binary.
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 }
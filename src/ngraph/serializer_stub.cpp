@@ -42,3 +42,13 @@ std::shared_ptr<ngraph::Function> ngraph::deserialize(const std::string& str)
 {
     throw std::runtime_error("serializer disabled in build");
 }
+
+void ngraph::serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+std::shared_ptr<ngraph::Function> ngraph::deserialize_binary(const std::string& path)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
@@ -16,8 +16,11 @@
 
 #include "ngraph/specialize_function.hpp"
 #include <pass/constant_folding.hpp>
+#include <set>
+#include "ngraph/except.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/ops.hpp"
 
 using namespace ngraph;
 
@@ -128,3 +131,86 @@ std::shared_ptr<Function>
     }
     return function;
 }
+
+bool ngraph::is_shape_polymorphic(const std::shared_ptr<Function>& f)
+{
+    // Ops whose output shapes follow from their input shapes and shape-free attributes (axes,
+    // broadcast specs). Their opset 1 to 0 conversions map them onto ops of this list again.
+    static const std::set<NodeTypeInfo> polymorphic_ops{
+        op::v0::Abs::type_info,          op::v0::Acos::type_info,
+        op::v0::Asin::type_info,         op::v0::Atan::type_info,
+        op::v0::Ceiling::type_info,      op::v0::Concat::type_info,
+        op::v0::Constant::type_info,     op::v0::Convert::type_info,
+        op::v0::Cos::type_info,          op::v0::Cosh::type_info,
+        op::v0::Dot::type_info,          op::v0::Erf::type_info,
+        op::v0::Exp::type_info,          op::v0::Floor::type_info,
+        op::v0::Gather::type_info,       op::v0::Log::type_info,
+        op::v0::Max::type_info,          op::v0::Min::type_info,
+        op::v0::Negative::type_info,     op::v0::Parameter::type_info,
+        op::v0::Product::type_info,      op::v0::Relu::type_info,
+        op::v0::Result::type_info,       op::v0::Select::type_info,
+        op::v0::Sigmoid::type_info,      op::v0::Sign::type_info,
+        op::v0::Sin::type_info,          op::v0::Sinh::type_info,
+        op::v0::Softmax::type_info,      op::v0::Sqrt::type_info,
+        op::v0::Sum::type_info,          op::v0::Tan::type_info,
+        op::v0::Tanh::type_info,         op::v1::Add::type_info,
+        op::v1::Divide::type_info,       op::v1::Equal::type_info,
+        op::v1::Gather::type_info,       op::v1::Greater::type_info,
+        op::v1::GreaterEqual::type_info, op::v1::Less::type_info,
+        op::v1::LessEqual::type_info,    op::v1::LogicalAnd::type_info,
+        op::v1::LogicalNot::type_info,   op::v1::LogicalOr::type_info,
+        op::v1::LogicalXor::type_info,   op::v1::Maximum::type_info,
+        op::v1::Minimum::type_info,      op::v1::Multiply::type_info,
+        op::v1::NotEqual::type_info,     op::v1::Power::type_info,
+        op::v1::ReduceMax::type_info,    op::v1::ReduceMin::type_info,
+        op::v1::ReduceProd::type_info,   op::v1::ReduceSum::type_info,
+        op::v1::Select::type_info,       op::v1::Softmax::type_info,
+        op::v1::Subtract::type_info};
+
+    for (auto node : f->get_ops())
+    {
+        if (polymorphic_ops.count(node->get_type_info()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<Function> ngraph::rebind_function(const std::shared_ptr<Function>& f,
+                                                  const std::vector<Shape>& parameter_shapes)
+{
+    NGRAPH_CHECK(f->get_parameters().size() == parameter_shapes.size());
+
+    std::vector<element::Type> parameter_element_types;
+    for (auto& parameter : f->get_parameters())
+    {
+        parameter_element_types.push_back(parameter->get_element_type());
+    }
+
+    std::shared_ptr<Function> function;
+    try
+    {
+        function = specialize_function(f,
+                                       parameter_element_types,
+                                       std::vector<PartialShape>(parameter_shapes.begin(),
+                                                                 parameter_shapes.end()),
+                                       std::vector<void*>(parameter_shapes.size(), nullptr),
+                                       false,
+                                       true);
+    }
+    catch (const ngraph_error&)
+    {
+        // The new shapes are not compatible, e.g. mismatched operands of an elementwise op
+        return nullptr;
+    }
+
+    for (auto& result : function->get_results())
+    {
+        if (result->get_output_partial_shape(0).is_dynamic())
+        {
+            return nullptr;
+        }
+    }
+    return function;
+}
@@ -204,4 +204,25 @@ namespace ngraph
                             const std::vector<void*>& parameter_values,
                             bool constant_folding,
                             bool share_constants);
+
+    /// \brief Checks whether every op of a function derives its output shapes from its input
+    ///        shapes alone.
+    ///
+    /// Such a function stays valid, and computes the same thing, when its parameters take other
+    /// static shapes, so a backend can reuse what it compiled for one set of input shapes for
+    /// another. Ops that carry absolute shapes or extents as attributes (e.g. v0 Reshape,
+    /// Broadcast or Slice), ops that read shapes (ShapeOf) and fused ops that may decompose
+    /// into such ops are not shape polymorphic.
+    NGRAPH_API
+    bool is_shape_polymorphic(const std::shared_ptr<Function>& f);
+
+    /// \brief Clones a shape polymorphic function for new static parameter shapes.
+    /// \param f The function to be cloned. Its element types are kept and its constants are
+    ///          shared with the clone.
+    /// \param parameter_shapes The new parameter shapes, one per parameter of f.
+    /// \return The clone, or nullptr if the ops of f do not validate with the new shapes or
+    ///         leave a result shape dynamic.
+    NGRAPH_API
+    std::shared_ptr<Function> rebind_function(const std::shared_ptr<Function>& f,
+                                              const std::vector<Shape>& parameter_shapes);
 }
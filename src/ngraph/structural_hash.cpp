@@ -0,0 +1,467 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+
+#include "ngraph/attribute_adapter.hpp"
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/structural_hash.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+static const uint64_t fnv_prime = 0x100000001b3ULL;
+
+static uint64_t fnv1a(const void* data, size_t size, uint64_t seed)
+{
+    uint64_t hash = seed;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= p[i];
+        hash *= fnv_prime;
+    }
+    return hash;
+}
+
+static size_t combine(size_t seed, size_t value)
+{
+    uint64_t v = value;
+    return static_cast<size_t>(fnv1a(&v, sizeof(v), seed));
+}
+
+size_t ngraph::stable_hash(const void* data, size_t size, size_t seed)
+{
+    return static_cast<size_t>(fnv1a(data, size, seed == 0 ? fnv_offset_basis : seed));
+}
+
+namespace
+{
+    // Encodes every attribute of a node into a byte string. Raw buffers (Constant data) are
+    // only hashed here and kept by reference so that equality can compare them in place.
+    class SignatureBuilder : public AttributeVisitor
+    {
+    public:
+        SignatureBuilder(string& encoding, vector<pair<const void*, size_t>>& blobs)
+            : m_encoding(encoding)
+            , m_blobs(blobs)
+        {
+        }
+
+        bool is_opaque() const { return m_opaque; }
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            m_opaque = true;
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            const void* data = adapter.get_ptr();
+            size_t size = adapter.size();
+            uint64_t hash = fnv1a(data, size, fnv_offset_basis);
+            tag(name, 'p');
+            append(&size, sizeof(size));
+            append(&hash, sizeof(hash));
+            m_blobs.push_back(make_pair(data, size));
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            tag(name, 's');
+            append_string(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            scalar(name, 'b', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int8_t>& adapter) override
+        {
+            scalar(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int16_t>& adapter) override
+        {
+            scalar(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int32_t>& adapter) override
+        {
+            scalar(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            scalar(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint8_t>& adapter) override
+        {
+            scalar(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint16_t>& adapter) override
+        {
+            scalar(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint32_t>& adapter) override
+        {
+            scalar(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            scalar(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            scalar(name, 'f', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            scalar(name, 'f', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            sequence(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            sequence(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            sequence(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            sequence(name, 'i', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            sequence(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            sequence(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            sequence(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            sequence(name, 'u', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            sequence(name, 'f', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            sequence(name, 'f', adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            tag(name, 'S');
+            const vector<string>& values = adapter.get();
+            uint64_t count = values.size();
+            append(&count, sizeof(count));
+            for (const string& value : values)
+            {
+                append_string(value);
+            }
+        }
+        // Nodes referenced as attributes (e.g. sub-graph bodies) would have to be hashed
+        // recursively; treat them as opaque instead.
+        node_id_t get_registered_node_id(const shared_ptr<Node>& node) override
+        {
+            m_opaque = true;
+            return invalid_node_id;
+        }
+
+    private:
+        void append(const void* data, size_t size)
+        {
+            m_encoding.append(static_cast<const char*>(data), size);
+        }
+        void append_string(const string& value)
+        {
+            uint64_t size = value.size();
+            append(&size, sizeof(size));
+            m_encoding.append(value);
+        }
+        void tag(const string& name, char type)
+        {
+            append_string(name);
+            m_encoding.push_back(type);
+        }
+        // Scalars are widened so that the encoding does not depend on the adapter width
+        template <typename T>
+        void scalar(const string& name, char type, T value)
+        {
+            tag(name, type);
+            if (type == 'f')
+            {
+                double v = static_cast<double>(value);
+                append(&v, sizeof(v));
+            }
+            else if (type == 'u')
+            {
+                uint64_t v = static_cast<uint64_t>(value);
+                append(&v, sizeof(v));
+            }
+            else
+            {
+                int64_t v = static_cast<int64_t>(value);
+                append(&v, sizeof(v));
+            }
+        }
+        template <typename T>
+        void sequence(const string& name, char type, const vector<T>& values)
+        {
+            uint64_t count = values.size();
+            tag(name, static_cast<char>(type - 'a' + 'A'));
+            append(&count, sizeof(count));
+            for (const T& value : values)
+            {
+                scalar("", type, value);
+            }
+        }
+
+        string& m_encoding;
+        vector<pair<const void*, size_t>>& m_blobs;
+        bool m_opaque{false};
+    };
+}
+
+const StructuralHash::Signature& StructuralHash::get_signature(const shared_ptr<Node>& node)
+{
+    auto it = m_signatures.find(node->get_instance_id());
+    if (it != m_signatures.end())
+    {
+        return it->second;
+    }
+
+    Signature& signature = m_signatures[node->get_instance_id()];
+    const auto& type_info = node->get_type_info();
+    string& encoding = signature.encoding;
+    encoding.append(type_info.name);
+    encoding.push_back('\0');
+    uint64_t version = type_info.version;
+    encoding.append(reinterpret_cast<const char*>(&version), sizeof(version));
+
+    for (auto& output : node->outputs())
+    {
+        encoding.append(output.get_element_type().c_type_string());
+        encoding.push_back('\0');
+        const PartialShape& shape = output.get_partial_shape();
+        int64_t rank = shape.rank().is_static() ? shape.rank().get_length() : -1;
+        encoding.append(reinterpret_cast<const char*>(&rank), sizeof(rank));
+        for (int64_t i = 0; i < rank; i++)
+        {
+            int64_t dim = shape[i].is_static() ? shape[i].get_length() : -1;
+            encoding.append(reinterpret_cast<const char*>(&dim), sizeof(dim));
+        }
+    }
+
+    SignatureBuilder builder(encoding, signature.blobs);
+    signature.opaque = !node->visit_attributes(builder) || builder.is_opaque();
+    signature.hash = static_cast<size_t>(fnv1a(encoding.data(), encoding.size(), fnv_offset_basis));
+    return signature;
+}
+
+size_t StructuralHash::compute_node_hash(const shared_ptr<Node>& node,
+                                         unordered_map<size_t, size_t>& node_hashes)
+{
+    // Iterative post-order walk so deep graphs do not exhaust the stack
+    vector<pair<shared_ptr<Node>, bool>> stack{{node, false}};
+    while (!stack.empty())
+    {
+        shared_ptr<Node> current = stack.back().first;
+        if (node_hashes.count(current->get_instance_id()) != 0)
+        {
+            stack.pop_back();
+            continue;
+        }
+        if (!stack.back().second)
+        {
+            stack.back().second = true;
+            for (auto& input : current->inputs())
+            {
+                auto source = input.get_source_output().get_node_shared_ptr();
+                if (node_hashes.count(source->get_instance_id()) == 0)
+                {
+                    stack.push_back(make_pair(source, false));
+                }
+            }
+            continue;
+        }
+
+        vector<size_t> input_hashes;
+        for (auto& input : current->inputs())
+        {
+            auto source = input.get_source_output();
+            input_hashes.push_back(
+                combine(node_hashes.at(source.get_node()->get_instance_id()), source.get_index()));
+        }
+        if (current->is_commutative())
+        {
+            sort(input_hashes.begin(), input_hashes.end());
+        }
+        size_t hash = get_signature(current).hash;
+        for (size_t input_hash : input_hashes)
+        {
+            hash = combine(hash, input_hash);
+        }
+        node_hashes[current->get_instance_id()] = hash;
+        stack.pop_back();
+    }
+    return node_hashes.at(node->get_instance_id());
+}
+
+size_t StructuralHash::get_attribute_hash(const shared_ptr<Node>& node)
+{
+    return get_signature(node).hash;
+}
+
+size_t StructuralHash::get_node_hash(const shared_ptr<Node>& node)
+{
+    return compute_node_hash(node, m_node_hashes);
+}
+
+size_t StructuralHash::get_output_hash(const Output<Node>& output)
+{
+    return combine(get_node_hash(output.get_node_shared_ptr()), output.get_index());
+}
+
+size_t StructuralHash::get_function_hash(const shared_ptr<Function>& function)
+{
+    // Parameters are hashed by position, so this walk cannot share node hashes with
+    // get_node_hash; attribute signatures are still shared.
+    unordered_map<size_t, size_t> node_hashes;
+    size_t hash = fnv_offset_basis;
+    size_t index = 0;
+    for (auto& parameter : function->get_parameters())
+    {
+        size_t parameter_hash = combine(get_signature(parameter).hash, index++);
+        node_hashes[parameter->get_instance_id()] = parameter_hash;
+        hash = combine(hash, parameter_hash);
+    }
+    for (auto& result : function->get_results())
+    {
+        hash = combine(hash, compute_node_hash(result, node_hashes));
+    }
+    return hash;
+}
+
+bool StructuralHash::is_hashable(const shared_ptr<Node>& node)
+{
+    return !get_signature(node).opaque;
+}
+
+bool StructuralHash::attributes_equal(const shared_ptr<Node>& a, const shared_ptr<Node>& b)
+{
+    if (a == b)
+    {
+        return true;
+    }
+    const Signature& sa = get_signature(a);
+    const Signature& sb = get_signature(b);
+    if (sa.opaque || sb.opaque || sa.hash != sb.hash || sa.encoding != sb.encoding ||
+        sa.blobs.size() != sb.blobs.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < sa.blobs.size(); i++)
+    {
+        if (sa.blobs[i].second != sb.blobs[i].second ||
+            (sa.blobs[i].first != sb.blobs[i].first &&
+             memcmp(sa.blobs[i].first, sb.blobs[i].first, sa.blobs[i].second) != 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StructuralHash::functions_equal(const shared_ptr<Function>& a, const shared_ptr<Function>& b)
+{
+    if (a == b)
+    {
+        return true;
+    }
+    if (a->get_parameters().size() != b->get_parameters().size() ||
+        a->get_results().size() != b->get_results().size() ||
+        get_function_hash(a) != get_function_hash(b))
+    {
+        return false;
+    }
+
+    NodeVector ops_a = a->get_ordered_ops();
+    NodeVector ops_b = b->get_ordered_ops();
+    if (ops_a.size() != ops_b.size())
+    {
+        return false;
+    }
+
+    // Both graphs must visit structurally equal nodes in the same topological order. Each node
+    // is then identified by its position in that order.
+    unordered_map<Node*, size_t> position_a;
+    unordered_map<Node*, size_t> position_b;
+    for (size_t i = 0; i < ops_a.size(); i++)
+    {
+        position_a[ops_a[i].get()] = i;
+        position_b[ops_b[i].get()] = i;
+    }
+    auto input_positions = [](const shared_ptr<Node>& node,
+                              const unordered_map<Node*, size_t>& position) {
+        vector<pair<size_t, size_t>> result;
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            result.push_back(make_pair(position.at(source.get_node()), source.get_index()));
+        }
+        if (node->is_commutative())
+        {
+            sort(result.begin(), result.end());
+        }
+        return result;
+    };
+    for (size_t i = 0; i < ops_a.size(); i++)
+    {
+        if (!attributes_equal(ops_a[i], ops_b[i]) ||
+            input_positions(ops_a[i], position_a) != input_positions(ops_b[i], position_b))
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a->get_parameters().size(); i++)
+    {
+        if (position_a.at(a->get_parameters()[i].get()) !=
+            position_b.at(b->get_parameters()[i].get()))
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a->get_results().size(); i++)
+    {
+        if (position_a.at(a->get_results()[i].get()) != position_b.at(b->get_results()[i].get()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StructuralHash::clear()
+{
+    m_signatures.clear();
+    m_node_hashes.clear();
+}
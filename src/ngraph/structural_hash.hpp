@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    /// \brief Computes canonical structural hashes of Nodes and Functions.
+    ///
+    /// The attribute hash of a node covers its op type and version, every attribute reported
+    /// by visit_attributes, and the element types and shapes of its outputs. The node hash also
+    /// folds in the hashes of the node's input values, so two subgraphs hash alike when they
+    /// apply the same ops with the same attributes to the same kind of sources.
+    ///
+    /// Hash values never depend on node names, instance ids or addresses, so they are stable
+    /// across processes and usable as persistent cache keys. Results are memoized by node
+    /// instance id; a StructuralHash must not outlive modifications to the nodes it has seen.
+    ///
+    /// Nodes that do not implement visit_attributes, or that have attributes the hasher does not
+    /// understand, are opaque: they still get a hash, but they never compare equal to another
+    /// node.
+    class NGRAPH_API StructuralHash
+    {
+    public:
+        /// \brief Hash of the op type, attributes and output types of node, ignoring inputs.
+        size_t get_attribute_hash(const std::shared_ptr<Node>& node);
+        /// \brief Hash of node and, recursively, every node it depends on.
+        size_t get_node_hash(const std::shared_ptr<Node>& node);
+        /// \brief Hash of a single output of a node.
+        size_t get_output_hash(const Output<Node>& output);
+        /// \brief Hash of a Function; parameters are identified by their position.
+        size_t get_function_hash(const std::shared_ptr<Function>& function);
+
+        /// \returns true if all of the attributes of node are understood by the hasher.
+        bool is_hashable(const std::shared_ptr<Node>& node);
+        /// \returns true if a and b are the same op with identical attributes and output types.
+        ///          Inputs are not compared.
+        bool attributes_equal(const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b);
+        /// \returns true if a and b have the same parameters and results and compute them with
+        ///          the same ops, attributes and topology.
+        bool functions_equal(const std::shared_ptr<Function>& a,
+                             const std::shared_ptr<Function>& b);
+
+        /// \brief Drops all memoized hashes.
+        void clear();
+
+    private:
+        struct Signature
+        {
+            size_t hash{0};
+            bool opaque{false};
+            std::string encoding;
+            std::vector<std::pair<const void*, size_t>> blobs;
+        };
+
+        const Signature& get_signature(const std::shared_ptr<Node>& node);
+        size_t compute_node_hash(const std::shared_ptr<Node>& node,
+                                 std::unordered_map<size_t, size_t>& node_hashes);
+
+        std::unordered_map<size_t, Signature> m_signatures;
+        std::unordered_map<size_t, size_t> m_node_hashes;
+    };
+
+    /// \brief Stable (FNV-1a) hash of a block of memory.
+    NGRAPH_API
+    size_t stable_hash(const void* data, size_t size, size_t seed = 0);
+}
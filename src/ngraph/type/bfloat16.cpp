@@ -37,11 +37,151 @@
 
 #include "ngraph/type/bfloat16.hpp"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NGRAPH_BF16_DISPATCH
+#include <immintrin.h>
+#endif
+
 using namespace std;
 using namespace ngraph;
 
 static_assert(sizeof(bfloat16) == 2, "class bfloat16 must be exactly 2 bytes");
 
+// The vector conversions use integer arithmetic to round exactly like bfloat16(float), rather
+// than VCVTNEPS2BF16, which rounds differently and flushes denormals.
+#ifdef NGRAPH_BF16_DISPATCH
+namespace
+{
+    enum class Isa
+    {
+        scalar,
+        avx2,
+        avx512
+    };
+
+    Isa get_isa()
+    {
+        static const Isa isa = []() {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f"))
+            {
+                return Isa::avx512;
+            }
+            return __builtin_cpu_supports("avx2") ? Isa::avx2 : Isa::scalar;
+        }();
+        return isa;
+    }
+
+    // Each function converts a prefix of the values and returns its length
+
+    __attribute__((target("avx512f"))) size_t
+        from_float_avx512(const float* in, bfloat16* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i x = _mm512_loadu_si512(in + i);
+#if defined ROUND_MODE_TO_NEAREST_EVEN
+            __m512i lsb = _mm512_and_si512(x, _mm512_set1_epi32(0x00010000));
+            x = _mm512_add_epi32(x, _mm512_srli_epi32(lsb, 1));
+#elif defined ROUND_MODE_TO_NEAREST
+            x = _mm512_add_epi32(x, _mm512_set1_epi32(0x8000));
+#endif
+            __m256i y = _mm512_cvtepi32_epi16(_mm512_srli_epi32(x, 16));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), y);
+        }
+        return i;
+    }
+
+    // The bfloat16 bits of 8 floats, in the low half of each 32 bit lane
+    __attribute__((target("avx2"))) inline __m256i round_avx2(const float* in)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+#if defined ROUND_MODE_TO_NEAREST_EVEN
+        __m256i lsb = _mm256_and_si256(x, _mm256_set1_epi32(0x00010000));
+        x = _mm256_add_epi32(x, _mm256_srli_epi32(lsb, 1));
+#elif defined ROUND_MODE_TO_NEAREST
+        x = _mm256_add_epi32(x, _mm256_set1_epi32(0x8000));
+#endif
+        return _mm256_srli_epi32(x, 16);
+    }
+
+    __attribute__((target("avx2"))) size_t
+        from_float_avx2(const float* in, bfloat16* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i lo = round_avx2(in + i);
+            __m256i hi = round_avx2(in + i + 8);
+            // packus interleaves the 128 bit lanes of its arguments
+            __m256i y = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), y);
+        }
+        return i;
+    }
+
+    __attribute__((target("avx512f"))) size_t
+        to_float_avx512(const bfloat16* in, float* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            _mm512_storeu_si512(out + i, _mm512_slli_epi32(_mm512_cvtepu16_epi32(x), 16));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) size_t
+        to_float_avx2(const bfloat16* in, float* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            __m256i y = _mm256_slli_epi32(_mm256_cvtepu16_epi32(x), 16);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), y);
+        }
+        return i;
+    }
+}
+#endif
+
+void bfloat16::from_float(const float* in, bfloat16* out, size_t count)
+{
+    size_t i = 0;
+#ifdef NGRAPH_BF16_DISPATCH
+    switch (get_isa())
+    {
+    case Isa::avx512: i = from_float_avx512(in, out, count); break;
+    case Isa::avx2: i = from_float_avx2(in, out, count); break;
+    case Isa::scalar: break;
+    }
+#endif
+    for (; i < count; i++)
+    {
+        out[i] = bfloat16(in[i]);
+    }
+}
+
+void bfloat16::to_float(const bfloat16* in, float* out, size_t count)
+{
+    size_t i = 0;
+#ifdef NGRAPH_BF16_DISPATCH
+    switch (get_isa())
+    {
+    case Isa::avx512: i = to_float_avx512(in, out, count); break;
+    case Isa::avx2: i = to_float_avx2(in, out, count); break;
+    case Isa::scalar: break;
+    }
+#endif
+    for (; i < count; i++)
+    {
+        out[i] = static_cast<float>(in[i]);
+    }
+}
+
 bool float_isnan(const float& x)
 {
     return std::isnan(x);
@@ -49,18 +189,15 @@ bool float_isnan(const float& x)
 
 std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16)
 {
-    std::vector<float> v_f32(v_bf16.begin(), v_bf16.end());
+    std::vector<float> v_f32(v_bf16.size());
+    to_float(v_bf16.data(), v_f32.data(), v_bf16.size());
     return v_f32;
 }
 
 std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f32)
 {
-    std::vector<bfloat16> v_bf16;
-    v_bf16.reserve(v_f32.size());
-    for (float a : v_f32)
-    {
-        v_bf16.push_back(static_cast<bfloat16>(a));
-    }
+    std::vector<bfloat16> v_bf16(v_f32.size());
+    from_float(v_f32.data(), v_bf16.data(), v_f32.size());
     return v_bf16;
 }
 
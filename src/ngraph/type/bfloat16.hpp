@@ -65,6 +65,11 @@ namespace ngraph
 
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
+        /// \brief Convert count floats, with the same result as converting them one by one.
+        ///        Uses AVX-512 or AVX2 when the CPU has them.
+        static void from_float(const float* in, bfloat16* out, size_t count);
+        /// \brief Convert count values to float. Uses AVX-512 or AVX2 when the CPU has them.
+        static void to_float(const bfloat16* in, float* out, size_t count);
         static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
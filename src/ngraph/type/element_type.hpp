@@ -46,11 +46,13 @@ namespace ngraph
             f16,
             f32,
             f64,
+            i4,
             i8,
             i16,
             i32,
             i64,
             u1,
+            u4,
             u8,
             u16,
             u32,
@@ -139,11 +141,13 @@ namespace ngraph
         extern NGRAPH_API const Type f16;
         extern NGRAPH_API const Type f32;
         extern NGRAPH_API const Type f64;
+        extern NGRAPH_API const Type i4;
         extern NGRAPH_API const Type i8;
         extern NGRAPH_API const Type i16;
         extern NGRAPH_API const Type i32;
         extern NGRAPH_API const Type i64;
         extern NGRAPH_API const Type u1;
+        extern NGRAPH_API const Type u4;
         extern NGRAPH_API const Type u8;
         extern NGRAPH_API const Type u16;
         extern NGRAPH_API const Type u32;
@@ -55,6 +55,12 @@ namespace ngraph
         using value_type = double;
     };
 
+    template <>
+    struct element_type_traits<element::Type_t::i4>
+    {
+        using value_type = int8_t;
+    };
+
     template <>
     struct element_type_traits<element::Type_t::i8>
     {
@@ -85,6 +91,12 @@ namespace ngraph
         using value_type = int8_t;
     };
 
+    template <>
+    struct element_type_traits<element::Type_t::u4>
+    {
+        using value_type = uint8_t;
+    };
+
     template <>
     struct element_type_traits<element::Type_t::u8>
     {
@@ -35,6 +35,11 @@
 #include <iostream>
 #include <limits>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NGRAPH_F16C_DISPATCH
+#include <immintrin.h>
+#endif
+
 #include "ngraph/type/float16.hpp"
 
 using namespace std;
@@ -42,90 +47,119 @@ using namespace ngraph;
 
 static_assert(sizeof(float16) == 2, "class float16 must be exactly 2 bytes");
 
+#ifdef NGRAPH_F16C_DISPATCH
+static bool has_f16c()
+{
+    static const bool f16c = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    }();
+    return f16c;
+}
+
+// Both convert the first count - count % 8 values. The scalar conversions round the same way
+// as VCVTPS2PH with round to nearest even, so results do not depend on the CPU.
+__attribute__((target("avx,f16c"))) static size_t
+    from_float_f16c(const float* in, float16* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c"))) static size_t
+    to_float_f16c(const float16* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+    }
+    return i;
+}
+#endif
+
+void float16::from_float(const float* in, float16* out, size_t count)
+{
+    size_t i = 0;
+#ifdef NGRAPH_F16C_DISPATCH
+    if (has_f16c())
+    {
+        i = from_float_f16c(in, out, count);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        out[i] = float16(in[i]);
+    }
+}
+
+void float16::to_float(const float16* in, float* out, size_t count)
+{
+    size_t i = 0;
+#ifdef NGRAPH_F16C_DISPATCH
+    if (has_f16c())
+    {
+        i = to_float_f16c(in, out, count);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        out[i] = static_cast<float>(in[i]);
+    }
+}
+
 float16::float16(float value)
 {
-    // Work in 32-bit and shift right 16 in the end
+    // Round to nearest even, with gradual underflow and quiet NaNs, like F16C's VCVTPS2PH
     union {
         float fv;
         uint32_t iv;
     };
     fv = value;
-    // sign
-    constexpr uint32_t smask = 0x80000000;
-    // floqt32 exp
-    constexpr uint32_t emask_32 = 0x7F800000;
-    // float32 frac
-    constexpr uint32_t fmask_32 = 0x007fffff;
-    // float16 exp
-    constexpr uint32_t emask_16 = 0x7c000000;
-    // float16 frac
-    constexpr uint32_t fmask_16 = 0x03ff0000;
-    // bits for half to even round
-    constexpr uint32_t rhalf_16 = 0x0001ffff;
-    // bit value for normal round
-    constexpr uint32_t rnorm_16 = 0x00007fff;
-    // bit value for half to even round
-    constexpr uint32_t reven_16 = 0x00008000;
-    // value for an non-half to even round
-    constexpr uint32_t rodd_16 = 0x000018000;
-
-    // exp bits in position
-    uint32_t biased_exp_field_32 = iv & emask_32;
-    uint32_t frac = (iv & fmask_32) << 3;
-    if (biased_exp_field_32 == emask_32)
+    uint16_t sign = static_cast<uint16_t>((iv >> 16) & 0x8000);
+    uint32_t abs = iv & 0x7FFFFFFF;
+    if (abs >= 0x7F800000)
     {
-        // Inf or NaN
-        if (frac != 0)
-        {
-            // NaN
-            frac &= fmask_16;
-            if (frac == 0)
-            {
-                frac = 0x00010000;
-            }
-        }
-        m_value = ((iv & smask) | emask_16 | frac) >> 16;
-        return;
-    }
-    if (biased_exp_field_32 == 0)
-    {
-        m_value = (iv & smask) >> 16;
-        return;
+        // Inf or NaN, which keeps the top of its payload
+        uint16_t nan_bits = abs > 0x7F800000 ? 0x0200 | ((abs >> 13) & 0x03FF) : 0;
+        m_value = sign | 0x7C00 | nan_bits;
     }
-    int16_t biased_exp_16 = (biased_exp_field_32 >> 23) - 127 + 15;
-    // In the normalized_16 realm
-    if ((frac & rhalf_16) == rodd_16 || (frac & rnorm_16) != 0)
+    else if (abs >= 0x477FF000)
     {
-        frac += reven_16;
-        if (0 != (frac & emask_16))
-        {
-            frac &= emask_16;
-            biased_exp_16++;
-        }
+        // 65520 and above round to infinity
+        m_value = sign | 0x7C00;
     }
-    frac &= fmask_16;
-    if (biased_exp_16 > 30)
+    else if (abs >= 0x38800000)
     {
-        // Infinity
-        m_value = ((iv & smask) | emask_16 | 0) >> 16;
-        return;
+        // Normal: rebias the exponent from 127 to 15 and round away the low 13 bits
+        abs += 0xC8000FFF + ((abs >> 13) & 1);
+        m_value = sign | static_cast<uint16_t>(abs >> 13);
     }
-    if (biased_exp_16 > 0)
+    else if (abs > 0x33000000)
     {
-        m_value = ((iv & smask) | biased_exp_16 << 26 | frac) >> 16;
-        return;
+        // Subnormal: the significand with its hidden 1, in units of 2^-24
+        uint32_t shift = 126 - (abs >> 23);
+        uint32_t significand = (abs & 0x007FFFFF) | 0x00800000;
+        uint32_t result = significand >> shift;
+        uint32_t remainder = significand & ((1u << shift) - 1);
+        uint32_t half = 1u << (shift - 1);
+        if (remainder > half || (remainder == half && (result & 1)))
+        {
+            result++;
+        }
+        m_value = sign | static_cast<uint16_t>(result);
     }
-    // Restore the hidden 1
-    frac = 0x04000000 | ((iv & fmask_32) << 3);
-    // Will any bits be shifted off?
-    uint32_t sticky = (frac & ((1 << (1 - biased_exp_16)) - 1)) ? 1 : 0;
-    frac >>= 1 + (-biased_exp_16);
-    frac |= sticky;
-    if (((frac & rhalf_16) == rodd_16) || ((frac & rnorm_16) != 0))
+    else
     {
-        frac += reven_16;
+        // At most half of the smallest subnormal
+        m_value = sign;
     }
-    m_value = ((iv & smask) | frac) >> 16;
 }
 
 std::string float16::to_string() const
@@ -200,6 +234,11 @@ float16::operator float() const
     else if (exp == 0x1F)
     {
         fexp = 0xFF;
+        if (frac != 0)
+        {
+            // Quiet signaling NaNs
+            frac |= 0x0200;
+        }
     }
     frac = frac << (23 - frac_size);
     i_val = static_cast<uint32_t>((m_value & 0x8000)) << 16 | (fexp << 23) | frac;
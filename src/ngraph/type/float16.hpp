@@ -58,6 +58,12 @@ namespace ngraph
         bool operator>=(const float16& other) const;
         operator float() const;
 
+        /// \brief Convert count floats, with the same result as converting them one by one.
+        ///        Uses F16C when the CPU has it.
+        static void from_float(const float* in, float16* out, size_t count);
+        /// \brief Convert count values to float, with the same result as converting them one
+        ///        by one. Uses F16C when the CPU has it.
+        static void to_float(const float16* in, float* out, size_t count);
         static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const float16& obj)
@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ngraph/except.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    /// \brief Access to the elements of the sub-byte types u1, u4 and i4.
+    ///
+    /// Elements of these types are packed without padding:
+    /// - u1: element i is bit (7 - i % 8) of byte i / 8, most significant bit first
+    /// - u4, i4: element i is the low nibble of byte i / 2 when i is even and the high nibble
+    ///   when i is odd; i4 is two's complement
+    namespace packed
+    {
+        /// \return true if elements of type take less than a byte
+        inline bool is_packed(const element::Type& type)
+        {
+            return type.is_static() && type.bitwidth() < 8;
+        }
+
+        /// \return The number of bytes holding count elements of type
+        inline size_t byte_size(const element::Type& type, size_t count)
+        {
+            return is_packed(type) ? (count * type.bitwidth() + 7) / 8 : count * type.size();
+        }
+
+        inline uint8_t get_u1(const uint8_t* data, size_t index)
+        {
+            return (data[index / 8] >> (7 - index % 8)) & 0x01;
+        }
+
+        inline uint8_t get_u4(const uint8_t* data, size_t index)
+        {
+            return (data[index / 2] >> (index % 2 * 4)) & 0x0F;
+        }
+
+        inline int8_t get_i4(const uint8_t* data, size_t index)
+        {
+            int8_t value = get_u4(data, index);
+            return value < 8 ? value : value - 16;
+        }
+
+        inline void set_u1(uint8_t* data, size_t index, uint8_t value)
+        {
+            uint8_t mask = static_cast<uint8_t>(0x80 >> (index % 8));
+            data[index / 8] = (value & 0x01) ? (data[index / 8] | mask) : (data[index / 8] & ~mask);
+        }
+
+        inline void set_u4(uint8_t* data, size_t index, uint8_t value)
+        {
+            size_t shift = index % 2 * 4;
+            data[index / 2] = static_cast<uint8_t>((data[index / 2] & ~(0x0F << shift)) |
+                                                   ((value & 0x0F) << shift));
+        }
+
+        inline void set_i4(uint8_t* data, size_t index, int8_t value)
+        {
+            set_u4(data, index, static_cast<uint8_t>(value));
+        }
+
+        /// \brief Reads element index of a buffer of packed type
+        inline int64_t get(const element::Type& type, const void* data, size_t index)
+        {
+            auto bytes = static_cast<const uint8_t*>(data);
+            switch (type)
+            {
+            case element::Type_t::u1: return get_u1(bytes, index);
+            case element::Type_t::u4: return get_u4(bytes, index);
+            case element::Type_t::i4: return get_i4(bytes, index);
+            default: throw ngraph_error("Element type " + type.get_type_name() + " is not packed");
+            }
+        }
+
+        /// \brief Writes element index of a buffer of packed type. Values out of the range of
+        ///        type are truncated to their low bits.
+        inline void set(const element::Type& type, void* data, size_t index, int64_t value)
+        {
+            auto bytes = static_cast<uint8_t*>(data);
+            switch (type)
+            {
+            case element::Type_t::u1: set_u1(bytes, index, static_cast<uint8_t>(value)); break;
+            case element::Type_t::u4: set_u4(bytes, index, static_cast<uint8_t>(value)); break;
+            case element::Type_t::i4: set_i4(bytes, index, static_cast<int8_t>(value)); break;
+            default: throw ngraph_error("Element type " + type.get_type_name() + " is not packed");
+            }
+        }
+
+        /// \brief Unpacks count elements of a buffer of packed type, one T per element
+        template <typename T>
+        void unpack(const element::Type& type, const void* data, T* out, size_t count)
+        {
+            auto bytes = static_cast<const uint8_t*>(data);
+            switch (type)
+            {
+            case element::Type_t::u1:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out[i] = static_cast<T>(get_u1(bytes, i));
+                }
+                break;
+            case element::Type_t::u4:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out[i] = static_cast<T>(get_u4(bytes, i));
+                }
+                break;
+            case element::Type_t::i4:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out[i] = static_cast<T>(get_i4(bytes, i));
+                }
+                break;
+            default: throw ngraph_error("Element type " + type.get_type_name() + " is not packed");
+            }
+        }
+    }
+}
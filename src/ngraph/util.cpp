@@ -699,10 +699,8 @@ vector<float> read_float_vector(shared_ptr<runtime::Tensor> tv)
     else if (element_type == element::f16)
     {
         vector<float16> vec = read_vector<float16>(tv);
-        for (float16 value : vec)
-        {
-            float_vec.push_back(static_cast<float>(value));
-        }
+        float_vec.resize(vec.size());
+        float16::to_float(vec.data(), float_vec.data(), vec.size());
     }
     else if (element_type == element::f32)
     {
@@ -72,6 +72,8 @@ static void dump_result_tensors(vector<shared_ptr<runtime::HostTensor>>& results
         case (element::Type_t::boolean): dump_tensor_elements<char>(*result); break;
         case (element::Type_t::bf16): dump_tensor_elements<bfloat16>(*result); break;
         case (element::Type_t::f16): dump_tensor_elements<float16>(*result); break;
+        case element::Type_t::i4:
+        case element::Type_t::u4:
         case element::Type_t::u1: throw runtime_error("unsupported type");
         case element::Type_t::undefined: throw runtime_error("unsupported type");
         case element::Type_t::dynamic: throw runtime_error("unsupported type");
@@ -90,7 +92,8 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                                                   bool timing_detail,
                                                   size_t warmup_iterations,
                                                   bool copy_data,
-                                                  bool dump_results)
+                                                  bool dump_results,
+                                                  BenchmarkStats& stats)
 {
     stopwatch timer;
     timer.start();
@@ -100,6 +103,9 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     stringstream ss;
     ss.imbue(locale(""));
     ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    stats.mode = "latency";
+    stats.compile_ms = timer.get_milliseconds();
+    stats.latencies_us.reserve(iterations);
 
     vector<shared_ptr<runtime::HostTensor>> arg_data;
     vector<shared_ptr<runtime::Tensor>> args;
@@ -139,12 +145,14 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     }
 
     stopwatch t1;
+    stopwatch request_timer;
     for (size_t i = 0; i < iterations + warmup_iterations; i++)
     {
         if (i == warmup_iterations)
         {
             t1.start();
         }
+        request_timer.start();
         if (copy_data)
         {
             for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
@@ -169,11 +177,18 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                              data->get_element_count() * data->get_element_type().size());
             }
         }
+        request_timer.stop();
+        if (i >= warmup_iterations)
+        {
+            stats.latencies_us.push_back(request_timer.get_nanoseconds() / 1000.0);
+        }
     }
     t1.stop();
     float time = t1.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
     cout << ss.str();
+    stats.wall_ms = t1.get_nanoseconds() / 1.0e6;
+    stats.batch_size = get_batch_size(f);
 
     if (dump_results)
     {
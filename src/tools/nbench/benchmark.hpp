@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "benchmark_stats.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 
@@ -30,4 +31,5 @@ std::vector<ngraph::runtime::PerformanceCounter> run_benchmark(std::shared_ptr<n
                                                                bool timing_detail,
                                                                size_t warmup_iterations,
                                                                bool copy_data,
-                                                               bool dump_results);
+                                                               bool dump_results,
+                                                               BenchmarkStats& stats);
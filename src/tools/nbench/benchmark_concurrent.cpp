@@ -0,0 +1,291 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "benchmark_concurrent.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    class ClientTensors
+    {
+    public:
+        vector<shared_ptr<runtime::HostTensor>> parameter_data;
+        vector<vector<char>> result_data;
+
+        vector<shared_ptr<runtime::Tensor>> input_tensors;
+        vector<shared_ptr<runtime::Tensor>> output_tensors;
+    };
+
+    /// Holds clients back after warm-up so that the measured interval starts with every
+    /// client ready to issue requests.
+    class StartGate
+    {
+    public:
+        void arrive()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_arrived++;
+            m_condition.notify_all();
+            m_condition.wait(lock, [this] { return m_open; });
+        }
+
+        void open(size_t client_count)
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_condition.wait(lock, [&] { return m_arrived == client_count; });
+            m_open = true;
+            m_condition.notify_all();
+        }
+
+    private:
+        mutex m_mutex;
+        condition_variable m_condition;
+        size_t m_arrived = 0;
+        bool m_open = false;
+    };
+}
+
+static Shape get_concrete_shape(const PartialShape& shape, size_t batch_size)
+{
+    NGRAPH_CHECK(shape.rank().is_static(), "Parameters with dynamic rank are not supported");
+    Shape result;
+    for (size_t i = 0; i < static_cast<size_t>(shape.rank().get_length()); i++)
+    {
+        if (shape[i].is_static())
+        {
+            result.push_back(shape[i].get_length());
+        }
+        else
+        {
+            NGRAPH_CHECK(i == 0, "Only the leading (batch) dimension may be dynamic");
+            NGRAPH_CHECK(batch_size > 0, "Model has a dynamic batch dimension, use --batch_sizes");
+            result.push_back(batch_size);
+        }
+    }
+    return result;
+}
+
+static ClientTensors
+    create_client_tensors(runtime::Backend& backend, const Function& f, size_t batch_size)
+{
+    ClientTensors tensors;
+    for (shared_ptr<op::v0::Parameter> param : f.get_parameters())
+    {
+        Shape shape = get_concrete_shape(param->get_output_partial_shape(0), batch_size);
+        auto tensor = backend.create_tensor(param->get_element_type(), shape);
+        auto tensor_data = make_shared<runtime::HostTensor>(param->get_element_type(), shape);
+        random_init(tensor_data);
+        tensor->write(tensor_data->get_data_ptr(), tensor_data->get_size_in_bytes());
+        tensors.input_tensors.push_back(tensor);
+        tensors.parameter_data.push_back(tensor_data);
+    }
+    for (shared_ptr<Node> result : f.get_results())
+    {
+        const PartialShape& shape = result->get_output_partial_shape(0);
+        const element::Type& type = result->get_output_element_type(0);
+        tensors.output_tensors.push_back(shape.is_static()
+                                             ? backend.create_tensor(type, shape.to_shape())
+                                             : backend.create_dynamic_tensor(type, shape));
+        tensors.result_data.emplace_back();
+    }
+    return tensors;
+}
+
+static void run_request(runtime::Executable& exec, ClientTensors& tensors, bool copy_data)
+{
+    if (copy_data)
+    {
+        for (size_t i = 0; i < tensors.input_tensors.size(); i++)
+        {
+            const shared_ptr<runtime::HostTensor>& data = tensors.parameter_data[i];
+            tensors.input_tensors[i]->write(data->get_data_ptr(), data->get_size_in_bytes());
+        }
+    }
+    exec.call(tensors.output_tensors, tensors.input_tensors);
+    if (copy_data)
+    {
+        for (size_t i = 0; i < tensors.output_tensors.size(); i++)
+        {
+            const shared_ptr<runtime::Tensor>& result = tensors.output_tensors[i];
+            vector<char>& data = tensors.result_data[i];
+            data.resize(result->get_size_in_bytes());
+            result->read(data.data(), data.size());
+        }
+    }
+}
+
+static void client_entry(runtime::Executable* exec,
+                         ClientTensors* tensors,
+                         size_t iterations,
+                         size_t warmup_iterations,
+                         bool copy_data,
+                         StartGate* gate,
+                         vector<double>* latencies_us,
+                         exception_ptr* error)
+{
+    bool arrived = false;
+    try
+    {
+        for (size_t i = 0; i < warmup_iterations; i++)
+        {
+            run_request(*exec, *tensors, copy_data);
+        }
+        arrived = true;
+        gate->arrive();
+        stopwatch request_timer;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            request_timer.start();
+            run_request(*exec, *tensors, copy_data);
+            request_timer.stop();
+            latencies_us->push_back(request_timer.get_nanoseconds() / 1000.0);
+        }
+    }
+    catch (...)
+    {
+        *error = current_exception();
+        if (!arrived)
+        {
+            gate->arrive();
+        }
+    }
+}
+
+vector<runtime::PerformanceCounter> run_benchmark_concurrent(shared_ptr<Function> f,
+                                                             const string& backend_name,
+                                                             size_t iterations,
+                                                             bool timing_detail,
+                                                             size_t warmup_iterations,
+                                                             bool copy_data,
+                                                             const vector<size_t>& client_counts,
+                                                             const vector<size_t>& batch_sizes,
+                                                             vector<BenchmarkStats>& stats)
+{
+    bool is_dynamic = f->is_dynamic();
+    NGRAPH_CHECK(is_dynamic || batch_sizes.empty(),
+                 "Batch size sweep requires a model with a dynamic batch dimension");
+    NGRAPH_CHECK(!is_dynamic || !batch_sizes.empty(),
+                 "Model has dynamic shapes, use --batch_sizes to pick the batch dimension");
+
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name, is_dynamic);
+    auto exec = backend->compile(f, timing_detail);
+    timer.stop();
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    cout << ss.str();
+    set_denormals_flush_to_zero();
+
+    size_t max_clients = 1;
+    for (size_t client_count : client_counts)
+    {
+        max_clients = max(max_clients, client_count);
+    }
+    int32_t concurrency = getenv_int("NGRAPH_CPU_CONCURRENCY", 1);
+    if (backend_name == "CPU" && static_cast<size_t>(concurrency) < max_clients)
+    {
+        cout << "NGRAPH_CPU_CONCURRENCY is " << concurrency << ", at most " << concurrency
+             << " of " << max_clients << " clients run at once\n";
+    }
+
+    vector<size_t> sweep_batch_sizes = batch_sizes;
+    if (sweep_batch_sizes.empty())
+    {
+        sweep_batch_sizes.push_back(get_batch_size(f));
+    }
+
+    for (size_t batch_size : sweep_batch_sizes)
+    {
+        vector<ClientTensors> tensors;
+        for (size_t i = 0; i < max_clients; i++)
+        {
+            tensors.push_back(create_client_tensors(*backend, *f, batch_size));
+        }
+        if (is_dynamic)
+        {
+            // Keep specializing the function for this shape out of the measurements
+            run_request(*exec, tensors[0], copy_data);
+        }
+
+        for (size_t client_count : client_counts)
+        {
+            NGRAPH_CHECK(client_count > 0, "client count must be at least 1");
+            StartGate gate;
+            vector<vector<double>> latencies(client_count);
+            vector<exception_ptr> errors(client_count);
+            vector<thread> threads;
+            for (size_t i = 0; i < client_count; i++)
+            {
+                latencies[i].reserve(iterations);
+                threads.push_back(thread(client_entry,
+                                         exec.get(),
+                                         &tensors[i],
+                                         iterations,
+                                         warmup_iterations,
+                                         copy_data,
+                                         &gate,
+                                         &latencies[i],
+                                         &errors[i]));
+            }
+            stopwatch wall_timer;
+            gate.open(client_count);
+            wall_timer.start();
+            for (thread& t : threads)
+            {
+                t.join();
+            }
+            wall_timer.stop();
+            for (const exception_ptr& error : errors)
+            {
+                if (error)
+                {
+                    rethrow_exception(error);
+                }
+            }
+
+            BenchmarkStats result;
+            result.mode = "concurrent";
+            result.batch_size = batch_size;
+            result.clients = client_count;
+            result.compile_ms = timer.get_milliseconds();
+            result.wall_ms = wall_timer.get_nanoseconds() / 1.0e6;
+            for (const vector<double>& client_latencies : latencies)
+            {
+                result.latencies_us.insert(
+                    result.latencies_us.end(), client_latencies.begin(), client_latencies.end());
+            }
+            stats.push_back(result);
+        }
+    }
+
+    vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
+    return perf_data;
+}
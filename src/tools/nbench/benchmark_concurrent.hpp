@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_stats.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// Compile f once and measure every (batch size, client count) combination. Each client thread
+/// owns its tensors and issues `iterations` requests against the shared executable, so on the
+/// CPU backend the number of requests in flight is bounded by NGRAPH_CPU_CONCURRENCY.
+/// batch_sizes replaces the dynamic leading dimension of the Parameters and must be empty for
+/// models with static shapes.
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_benchmark_concurrent(std::shared_ptr<ngraph::Function> f,
+                             const std::string& backend_name,
+                             size_t iterations,
+                             bool timing_detail,
+                             size_t warmup_iterations,
+                             bool copy_data,
+                             const std::vector<size_t>& client_counts,
+                             const std::vector<size_t>& batch_sizes,
+                             std::vector<BenchmarkStats>& stats);
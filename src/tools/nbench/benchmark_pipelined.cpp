@@ -14,7 +14,6 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <array>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -48,7 +47,9 @@ static condition_variable s_condition;
 static size_t current_iteration = 0;
 static size_t s_iterations;
 static size_t s_warmup_iterations;
+static size_t s_pipeline_depth;
 static stopwatch s_timer;
+static vector<double> s_latencies_us;
 
 static void
     thread_entry(runtime::Executable* exec, const TensorCollection& tensors, size_t pipeline_stage)
@@ -56,10 +57,14 @@ static void
     bool data_written = false;
     const vector<shared_ptr<runtime::Tensor>>& args = tensors.input_tensors;
     const vector<shared_ptr<runtime::Tensor>>& results = tensors.output_tensors;
+    // A request is submitted when this stage starts writing its inputs and completes once its
+    // results are read back, so its latency includes the wait for the stage's turn
+    stopwatch request_timer;
     while (current_iteration < s_iterations + s_warmup_iterations)
     {
         if (!data_written)
         {
+            request_timer.start();
             for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
             {
                 const shared_ptr<runtime::Tensor>& arg = args[arg_index];
@@ -73,7 +78,7 @@ static void
             data_written = true;
         }
         unique_lock<mutex> lock(s_mutex);
-        if ((current_iteration & 1) != pipeline_stage)
+        if (current_iteration % s_pipeline_depth != pipeline_stage)
         {
             s_condition.wait(lock);
         }
@@ -84,8 +89,9 @@ static void
                 s_timer.start();
             }
             // our turn to run
+            bool measured = current_iteration >= s_warmup_iterations;
             exec->call(results, args);
-            current_iteration++;
+            size_t completed = ++current_iteration;
             data_written = false;
             s_condition.notify_all();
             lock.unlock();
@@ -96,7 +102,13 @@ static void
                 result->read(data->get_data_ptr(),
                              data->get_element_count() * data->get_element_type().size());
             }
-            if (current_iteration == (s_iterations + s_warmup_iterations - 1))
+            request_timer.stop();
+            if (measured)
+            {
+                lock_guard<mutex> guard(s_mutex);
+                s_latencies_us.push_back(request_timer.get_nanoseconds() / 1000.0);
+            }
+            if (completed == s_iterations + s_warmup_iterations)
             {
                 s_timer.stop();
             }
@@ -109,12 +121,19 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
                                                             size_t iterations,
                                                             bool timing_detail,
                                                             int warmup_iterations,
-                                                            bool /* copy_data */)
+                                                            bool /* copy_data */,
+                                                            size_t pipeline_depth,
+                                                            BenchmarkStats& stats)
 {
-    constexpr size_t pipeline_depth = 2;
+    NGRAPH_CHECK(pipeline_depth > 0, "pipeline depth must be at least 1");
+    current_iteration = 0;
     s_iterations = iterations;
     s_warmup_iterations = warmup_iterations;
-    array<TensorCollection, pipeline_depth> tensor_collections;
+    s_pipeline_depth = pipeline_depth;
+    s_timer = stopwatch();
+    s_latencies_us.clear();
+    s_latencies_us.reserve(iterations);
+    vector<TensorCollection> tensor_collections(pipeline_depth);
     stopwatch timer;
     timer.start();
     auto backend = runtime::Backend::create(backend_name);
@@ -149,7 +168,6 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
 
     // Create input tensors for all Parameters
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> input_tensors_array;
     size_t input_index = 0;
     for (shared_ptr<op::v0::Parameter> param : f->get_parameters())
     {
@@ -161,7 +179,6 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     }
 
     // Create output tensors for all Results
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> output_tensors_array;
     size_t output_index = 0;
     for (shared_ptr<Node> result : f->get_results())
     {
@@ -172,7 +189,7 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
         }
     }
 
-    thread threads[pipeline_depth];
+    vector<thread> threads(pipeline_depth);
     for (size_t i = 0; i < pipeline_depth; i++)
     {
         threads[i] = thread(thread_entry, exec.get(), tensor_collections[i], i);
@@ -186,6 +203,13 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     ss << time / iterations << "ms per iteration" << endl;
     cout << ss.str();
 
+    stats.mode = "pipelined";
+    stats.batch_size = get_batch_size(f);
+    stats.pipeline_depth = pipeline_depth;
+    stats.compile_ms = timer.get_milliseconds();
+    stats.wall_ms = s_timer.get_nanoseconds() / 1.0e6;
+    stats.latencies_us = s_latencies_us;
+
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
     return perf_data;
 }
@@ -0,0 +1,176 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+#ifndef NGRAPH_JSON_DISABLE
+#include <nlohmann/json.hpp>
+#endif
+
+#include "benchmark_stats.hpp"
+
+using namespace std;
+
+double BenchmarkStats::mean_us() const
+{
+    double sum = 0;
+    for (double latency : latencies_us)
+    {
+        sum += latency;
+    }
+    return latencies_us.empty() ? 0 : sum / latencies_us.size();
+}
+
+double BenchmarkStats::percentile_us(double p) const
+{
+    if (latencies_us.empty())
+    {
+        return 0;
+    }
+    vector<double> sorted = latencies_us;
+    size_t rank = static_cast<size_t>(ceil(p / 100.0 * sorted.size()));
+    size_t index = min(max(rank, size_t(1)), sorted.size()) - 1;
+    nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+double BenchmarkStats::requests_per_second() const
+{
+    return wall_ms > 0 ? requests() * 1000.0 / wall_ms : 0;
+}
+
+double BenchmarkStats::samples_per_second() const
+{
+    return requests_per_second() * max(batch_size, size_t(1));
+}
+
+vector<pair<double, size_t>> BenchmarkStats::histogram() const
+{
+    vector<pair<double, size_t>> buckets;
+    for (double latency : latencies_us)
+    {
+        size_t bucket = latency <= 1 ? 0 : static_cast<size_t>(ceil(log2(latency)));
+        if (bucket >= buckets.size())
+        {
+            for (size_t i = buckets.size(); i <= bucket; i++)
+            {
+                buckets.push_back({ldexp(1.0, static_cast<int>(i)), 0});
+            }
+        }
+        buckets[bucket].second++;
+    }
+    // Leading empty buckets carry no information
+    auto first = find_if(buckets.begin(), buckets.end(), [](const pair<double, size_t>& b) {
+        return b.second != 0;
+    });
+    return vector<pair<double, size_t>>(first, buckets.end());
+}
+
+void BenchmarkStats::print(ostream& out) const
+{
+    out << mode << ": batch " << batch_size << ", clients " << clients << ", pipeline depth "
+        << pipeline_depth << ", " << requests() << " requests\n";
+    out << fixed << setprecision(3);
+    out << "    latency (ms): mean " << mean_us() / 1000 << "  p50 " << percentile_us(50) / 1000
+        << "  p90 " << percentile_us(90) / 1000 << "  p99 " << percentile_us(99) / 1000
+        << "  p99.9 " << percentile_us(99.9) / 1000 << "\n";
+    out << "    throughput: " << setprecision(1) << requests_per_second() << " requests/s, "
+        << samples_per_second() << " samples/s\n";
+
+    auto buckets = histogram();
+    size_t max_count = 0;
+    for (auto& bucket : buckets)
+    {
+        max_count = max(max_count, bucket.second);
+    }
+    constexpr size_t bar_width = 40;
+    for (auto& bucket : buckets)
+    {
+        size_t bar = max_count == 0 ? 0 : (bucket.second * bar_width + max_count - 1) / max_count;
+        out << "    <= " << setw(10) << setprecision(0) << bucket.first << "us " << setw(8)
+            << bucket.second << " " << string(bar, '#') << "\n";
+    }
+    out << defaultfloat;
+}
+
+int find_best_under_p99(const vector<BenchmarkStats>& stats, double target_ms)
+{
+    int best = -1;
+    for (size_t i = 0; i < stats.size(); i++)
+    {
+        if (stats[i].percentile_us(99) <= target_ms * 1000 &&
+            (best < 0 || stats[i].samples_per_second() > stats[best].samples_per_second()))
+        {
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+void write_json_report(const string& path,
+                       const string& backend_name,
+                       const vector<pair<string, BenchmarkStats>>& results)
+{
+#ifndef NGRAPH_JSON_DISABLE
+    nlohmann::json report;
+    report["backend"] = backend_name;
+    nlohmann::json runs = nlohmann::json::array();
+    for (auto& result : results)
+    {
+        const BenchmarkStats& stats = result.second;
+        nlohmann::json run;
+        run["model"] = result.first;
+        run["mode"] = stats.mode;
+        run["batch_size"] = stats.batch_size;
+        run["clients"] = stats.clients;
+        run["pipeline_depth"] = stats.pipeline_depth;
+        run["requests"] = stats.requests();
+        run["compile_ms"] = stats.compile_ms;
+        run["wall_ms"] = stats.wall_ms;
+        run["requests_per_second"] = stats.requests_per_second();
+        run["samples_per_second"] = stats.samples_per_second();
+        run["latency_us"] = {{"mean", stats.mean_us()},
+                             {"p50", stats.percentile_us(50)},
+                             {"p90", stats.percentile_us(90)},
+                             {"p99", stats.percentile_us(99)},
+                             {"p99.9", stats.percentile_us(99.9)}};
+        nlohmann::json histogram = nlohmann::json::array();
+        for (auto& bucket : stats.histogram())
+        {
+            histogram.push_back({{"le_us", bucket.first}, {"count", bucket.second}});
+        }
+        run["histogram"] = histogram;
+        runs.push_back(run);
+    }
+    report["runs"] = runs;
+
+    ofstream out(path);
+    if (!out)
+    {
+        throw runtime_error("Unable to open '" + path + "' for writing");
+    }
+    out << setw(4) << report << endl;
+#else
+    (void)path;
+    (void)backend_name;
+    (void)results;
+    throw runtime_error("JSON report requires nGraph built with NGRAPH_JSON_ENABLE");
+#endif
+}
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Latency and throughput measured for one benchmark configuration.
+class BenchmarkStats
+{
+public:
+    std::string mode;
+    size_t batch_size = 0;
+    size_t clients = 1;
+    size_t pipeline_depth = 1;
+    double compile_ms = 0;
+    double wall_ms = 0;
+    std::vector<double> latencies_us;
+
+    size_t requests() const { return latencies_us.size(); }
+    double mean_us() const;
+    /// Nearest-rank percentile, p in [0, 100]
+    double percentile_us(double p) const;
+    /// Requests completed per second of wall time
+    double requests_per_second() const;
+    /// Samples per second, counting each request as batch_size samples
+    double samples_per_second() const;
+    /// Counts per power-of-two bucket; each entry is (upper bound in us, count)
+    std::vector<std::pair<double, size_t>> histogram() const;
+
+    void print(std::ostream& out) const;
+};
+
+/// Return the index of the configuration with the highest throughput whose p99 latency is at
+/// most target_ms, or -1 if none qualifies.
+int find_best_under_p99(const std::vector<BenchmarkStats>& stats, double target_ms);
+
+/// Write all results as a JSON document suitable for regression tracking.
+void write_json_report(const std::string& path,
+                       const std::string& backend_name,
+                       const std::vector<std::pair<std::string, BenchmarkStats>>& results);
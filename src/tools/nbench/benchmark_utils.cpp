@@ -100,6 +100,8 @@ void random_init(shared_ptr<runtime::Tensor> tensor)
     case element::Type_t::u64: init_int_tensor<uint64_t>(tensor, 0, 1); break;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
+    case element::Type_t::i4:
+    case element::Type_t::u4:
     case element::Type_t::u1:
     case element::Type_t::bf16:
     case element::Type_t::f16:
@@ -115,3 +117,17 @@ default_random_engine& get_random_engine()
     static std::default_random_engine s_random_engine;
     return s_random_engine;
 }
+
+size_t get_batch_size(shared_ptr<Function> f)
+{
+    size_t batch_size = 0;
+    if (!f->get_parameters().empty())
+    {
+        const PartialShape& shape = f->get_parameters()[0]->get_output_partial_shape(0);
+        if (shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0].is_static())
+        {
+            batch_size = shape[0].get_length();
+        }
+    }
+    return batch_size;
+}
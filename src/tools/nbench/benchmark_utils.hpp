@@ -28,6 +28,9 @@ void set_denormals_flush_to_zero();
 
 void random_init(std::shared_ptr<ngraph::runtime::Tensor> tensor);
 
+/// Leading dimension of the first static Parameter, used as the batch size of a static model
+size_t get_batch_size(std::shared_ptr<ngraph::Function> f);
+
 std::default_random_engine& get_random_engine();
 
 template <typename T>
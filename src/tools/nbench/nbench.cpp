@@ -29,7 +29,9 @@
 #include <iomanip>
 
 #include "benchmark.hpp"
+#include "benchmark_concurrent.hpp"
 #include "benchmark_pipelined.hpp"
+#include "benchmark_stats.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
@@ -154,6 +156,16 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
     }
 }
 
+vector<size_t> parse_size_list(const string& arg)
+{
+    vector<size_t> values;
+    for (const string& value : split(arg, ',', true))
+    {
+        values.push_back(parse_string<size_t>(value));
+    }
+    return values;
+}
+
 int main(int argc, char** argv)
 {
     string model_arg;
@@ -168,7 +180,11 @@ int main(int argc, char** argv)
     bool copy_data = true;
     bool dump_results = false;
     bool dot_file = false;
-    bool double_buffer = false;
+    size_t pipeline_depth = 1;
+    vector<size_t> client_counts{1};
+    vector<size_t> batch_sizes;
+    double p99_target_ms = 0;
+    string json_report;
     string visualize_output_format = ".pdf";
 
     for (int i = 1; i < argc; i++)
@@ -234,7 +250,40 @@ int main(int argc, char** argv)
         }
         else if (arg == "--double_buffer")
         {
-            double_buffer = true;
+            pipeline_depth = 2;
+        }
+        else if (arg == "--pipeline_depth" || arg == "--clients" || arg == "--batch_sizes" ||
+                 arg == "--p99_target")
+        {
+            try
+            {
+                string value = argv[++i];
+                if (arg == "--pipeline_depth")
+                {
+                    pipeline_depth = parse_string<size_t>(value);
+                }
+                else if (arg == "--clients")
+                {
+                    client_counts = parse_size_list(value);
+                }
+                else if (arg == "--batch_sizes")
+                {
+                    batch_sizes = parse_size_list(value);
+                }
+                else
+                {
+                    p99_target_ms = parse_string<double>(value);
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--json_report")
+        {
+            json_report = argv[++i];
         }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
@@ -269,6 +318,11 @@ int main(int argc, char** argv)
         cout << "Either file or directory must be specified\n";
         failed = true;
     }
+    else if (pipeline_depth > 1 && (client_counts != vector<size_t>{1} || !batch_sizes.empty()))
+    {
+        cout << "--pipeline_depth cannot be combined with --clients or --batch_sizes\n";
+        failed = true;
+    }
 
     if (failed)
     {
@@ -292,7 +346,14 @@ OPTIONS
         --no_copy_data            Disable copy of input/result data every iteration
         --dump_results            Dump result tensors to standard output.
         --dot                     Generate Graphviz dot file
-        --double_buffer           Double buffer inputs and outputs
+        --double_buffer           Double buffer inputs and outputs (same as --pipeline_depth 2)
+        --pipeline_depth <n>      Pipeline n sets of inputs and outputs, one thread per stage
+        --clients <n[,n...]>      Issue requests from n concurrent client threads against one
+                                  executable. A list sweeps client counts. On CPU the number of
+                                  concurrent calls is bounded by NGRAPH_CPU_CONCURRENCY.
+        --batch_sizes <n[,n...]>  Sweep the dynamic batch dimension of the model's Parameters
+        --p99_target <ms>         Report the highest throughput with p99 latency under target
+        --json_report <file>      Write latency percentiles, histograms and throughput as JSON
 )###";
         return 1;
     }
@@ -317,6 +378,7 @@ OPTIONS
     }
 
     vector<PerfShape> aggregate_perf_data;
+    vector<pair<string, BenchmarkStats>> report;
     int rc = 0;
     for (const string& model : models)
     {
@@ -440,22 +502,67 @@ OPTIONS
                 ss << t1.get_milliseconds();
                 cout << "deserialize took " << ss.str() << "ms\n";
                 vector<runtime::PerformanceCounter> perf_data;
-                if (double_buffer)
+                vector<BenchmarkStats> stats;
+                if (pipeline_depth > 1)
+                {
+                    NGRAPH_CHECK(!dump_results,
+                                 "'dump_results' not implemented in pipelined mode");
+                    stats.emplace_back();
+                    perf_data = run_benchmark_pipelined(f,
+                                                        backend,
+                                                        iterations,
+                                                        timing_detail,
+                                                        warmup_iterations,
+                                                        copy_data,
+                                                        pipeline_depth,
+                                                        stats.back());
+                }
+                else if (client_counts != vector<size_t>{1} || !batch_sizes.empty() ||
+                         f->is_dynamic())
                 {
                     NGRAPH_CHECK(!dump_results,
-                                 "'dump_results' not implemented in double buffer mode");
-                    perf_data = run_benchmark_pipelined(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                                 "'dump_results' not implemented in concurrent mode");
+                    perf_data = run_benchmark_concurrent(f,
+                                                         backend,
+                                                         iterations,
+                                                         timing_detail,
+                                                         warmup_iterations,
+                                                         copy_data,
+                                                         client_counts,
+                                                         batch_sizes,
+                                                         stats);
                 }
                 else
                 {
+                    stats.emplace_back();
                     perf_data = run_benchmark(f,
                                               backend,
                                               iterations,
                                               timing_detail,
                                               warmup_iterations,
                                               copy_data,
-                                              dump_results);
+                                              dump_results,
+                                              stats.back());
+                }
+                cout << "\n---- Latency and throughput ----\n";
+                for (const BenchmarkStats& run : stats)
+                {
+                    run.print(cout);
+                    report.push_back({model, run});
+                }
+                if (p99_target_ms > 0)
+                {
+                    int best = find_best_under_p99(stats, p99_target_ms);
+                    if (best < 0)
+                    {
+                        cout << "No configuration meets p99 <= " << p99_target_ms << "ms\n";
+                    }
+                    else
+                    {
+                        cout << "Best under p99 <= " << p99_target_ms << "ms: batch "
+                             << stats[best].batch_size << ", clients " << stats[best].clients
+                             << ", " << stats[best].samples_per_second() << " samples/s\n";
+                    }
                 }
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
@@ -484,5 +591,18 @@ OPTIONS
         print_results(aggregate_perf_data, timing_detail);
     }
 
+    if (!json_report.empty())
+    {
+        try
+        {
+            write_json_report(json_report, backend, report);
+        }
+        catch (exception& e)
+        {
+            cout << e.what() << endl;
+            rc += 1;
+        }
+    }
+
     return rc;
 }
@@ -110,3 +110,26 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, get_memory_report)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 1, 1, 1});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{2, 3, 4, 5}, MIN_FLOAT_TOLERANCE_BITS));
+
+    auto report = handle->get_memory_report();
+    EXPECT_EQ(report.get_bytes(runtime::MemoryReport::constants), 16);
+    EXPECT_GE(report.get_total_bytes(), 16);
+    EXPECT_GE(report.get_peak_bytes(), 16);
+}
@@ -26,8 +26,10 @@
 // clang-format on
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
+#include "util/all_close_f.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/autodiff/numeric_compare.hpp"
 #include "util/random.hpp"
@@ -1813,6 +1815,125 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_reverse_sequence_n4d2c3h2w2)
     ASSERT_EQ(read_vector<int>(da), expected);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_rematerialization)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    const size_t layers = 9;
+    Shape x_shape{4, 8};
+    Shape w_shape{8, 8};
+
+    // Gradients of sum(tanh(...tanh(X.W0)...W8)) with respect to the weights
+    auto make_backprop = [&](const autodiff::RematerializationConfig& config,
+                             autodiff::RematerializationReport& report) {
+        auto X = make_shared<op::v0::Parameter>(element::f32, x_shape);
+        ParameterVector params{X};
+        Output<Node> h = X;
+        for (size_t i = 0; i < layers; i++)
+        {
+            auto W = make_shared<op::v0::Parameter>(element::f32, w_shape);
+            params.push_back(W);
+            h = make_shared<op::v0::Tanh>(make_shared<op::v0::Dot>(h, W));
+        }
+        auto loss = make_shared<op::v0::Sum>(h, AxisSet{0, 1});
+        auto C = make_shared<op::v0::Parameter>(element::f32, Shape{});
+        autodiff::Adjoints adjoints(OutputVector{loss}, OutputVector{C});
+        OutputVector gradients;
+        for (size_t i = 1; i < params.size(); i++)
+        {
+            gradients.push_back(adjoints.backprop_output(params[i]));
+        }
+        report = adjoints.rematerialize(config);
+        params.push_back(C);
+        return make_shared<Function>(gradients, params);
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    args.push_back(vector<float>(shape_size(x_shape)));
+    rng.initialize(args.back());
+    for (size_t i = 0; i < layers; i++)
+    {
+        args.push_back(vector<float>(shape_size(w_shape)));
+        rng.initialize(args.back());
+    }
+    args.push_back(vector<float>{1.0f});
+    runtime::MemoryReport memory;
+    auto run = [&](const shared_ptr<Function>& f) {
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            auto shape = f->get_parameters()[i]->get_output_shape(0);
+            inputs.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(inputs.back(), args[i]);
+        }
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        for (size_t i = 0; i < f->get_output_size(); i++)
+        {
+            outputs.push_back(backend->create_tensor(element::f32, f->get_output_shape(i)));
+        }
+        auto handle = backend->compile(f);
+        handle->call_with_validate(outputs, inputs);
+        memory = handle->get_memory_report();
+        vector<vector<float>> result;
+        for (auto& output : outputs)
+        {
+            result.push_back(read_vector<float>(output));
+        }
+        return result;
+    };
+
+    autodiff::RematerializationConfig keep_all;
+    keep_all.policy = autodiff::RematerializationConfig::Policy::NONE;
+    autodiff::RematerializationReport report;
+    auto expected = run(make_backprop(keep_all, report));
+    EXPECT_EQ(report.recomputed_ops, 0u);
+    EXPECT_EQ(report.activation_bytes, report.checkpoint_bytes);
+    size_t keep_all_intermediates = memory.get_bytes(runtime::MemoryReport::intermediates);
+
+    autodiff::RematerializationConfig sqrt_n;
+    auto f = make_backprop(sqrt_n, report);
+    EXPECT_GT(report.recomputed_ops, 0u);
+    EXPECT_GT(report.extra_flops, 0u);
+    EXPECT_LT(report.checkpoint_bytes, report.activation_bytes);
+
+    // Backends eliminate common subexpressions when they compile, which must not merge the
+    // recomputed ops back into the forward ops they copy. Backprop adds no Tanh of its own.
+    auto count_tanh = [](const shared_ptr<Function>& function) {
+        auto ops = function->get_ops();
+        return count_if(ops.begin(), ops.end(), [](const shared_ptr<Node>& node) {
+            return is_type<op::v0::Tanh>(node);
+        });
+    };
+    auto tanh_count = count_tanh(f);
+    EXPECT_GT(tanh_count, layers);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_tanh(f), tanh_count);
+
+    auto results = run(f);
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(expected[i], results[i]));
+    }
+    // Backends that report the intermediates they hold must hold fewer of them
+    if (keep_all_intermediates > 0)
+    {
+        EXPECT_LT(memory.get_bytes(runtime::MemoryReport::intermediates), keep_all_intermediates);
+    }
+
+    autodiff::RematerializationConfig budget;
+    budget.policy = autodiff::RematerializationConfig::Policy::MEMORY_BUDGET;
+    budget.memory_budget = report.activation_bytes / 2;
+    results = run(make_backprop(budget, report));
+    EXPECT_LE(report.checkpoint_bytes, budget.memory_budget);
+    EXPECT_GT(report.get_memory_saved(), 0u);
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(expected[i], results[i]));
+    }
+}
+
 // clang-format off
 #ifdef AUTODIFF_BACKEND_${BACKEND_NAME}
 #undef AUTODIFF_BACKEND_${BACKEND_NAME}
@@ -171,3 +171,70 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_bf16_float32)
                              1.5f}),
               read_vector<float>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, convert_float32_f16)
+{
+    Shape shape_a{1, 1, 3, 5};
+
+    // input data, including values that round and values out of range
+    vector<float> a_data = {0.5f,
+                            1.5f,
+                            0.1f,
+                            2.5f,
+                            -1.5f,
+                            1e-6f,
+                            3.5f,
+                            65504.f,
+                            7e4f,
+                            0.5f,
+                            2.5f,
+                            0.3f,
+                            0.5f,
+                            0.5f,
+                            1.5f};
+
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    auto convert = make_shared<op::v0::Convert>(A, element::f16);
+    auto f = make_shared<Function>(OutputVector{convert}, ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f16, shape_a);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    vector<float16> expected;
+    for (float value : a_data)
+    {
+        expected.push_back(float16(value));
+    }
+    auto actual = read_vector<float16>(result);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(expected[i].to_bits(), actual[i].to_bits());
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convert_f16_float32)
+{
+    Shape shape_a{1, 1, 3, 5};
+
+    // input data
+    vector<float16> a_data = {
+        0.5, 1.5, 0.5, 2.5, 1.5, 0.5, 3.5, 2.5, 0.5, 0.5, 2.5, 0.5, 0.5, 0.5, 1.5};
+
+    auto A = make_shared<op::v0::Parameter>(element::f16, shape_a);
+    auto convert = make_shared<op::v0::Convert>(A, element::f32);
+    auto f = make_shared<Function>(OutputVector{convert}, ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape_a);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{
+                  0.5, 1.5, 0.5, 2.5, 1.5, 0.5, 3.5, 2.5, 0.5, 0.5, 2.5, 0.5, 0.5, 0.5, 1.5}),
+              read_vector<float>(result));
+}
@@ -248,3 +248,33 @@ NGRAPH_TEST(${BACKEND_NAME}, dyn_convolution_backprop_filter)
     handle->call_with_validate({result}, {a, b, c});
     EXPECT_FALSE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, binary_convolution_padded)
+{
+    Shape shape_a{1, 1, 3, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    // Filter bits 1 and 0 stand for +1 and -1
+    auto B = op::v0::Constant::create(element::u1, Shape{1, 1, 2, 2}, {1, 0, 0, 1});
+    Shape shape_r{1, 1, 3, 3};
+    auto conv = make_shared<op::v1::BinaryConvolution>(
+        A,
+        B,
+        Strides{1, 1},
+        CoordinateDiff{1, 1},
+        CoordinateDiff{0, 0},
+        Strides{1, 1},
+        op::v1::BinaryConvolution::BinaryConvolutionMode::XNOR_POPCOUNT,
+        -1.0f);
+    auto f = make_shared<Function>(conv, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, -2, 2, -2, 4, -2, 2, -2, -2},
+                                  read_vector<float>(result)));
+}
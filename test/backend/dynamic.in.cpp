@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -433,3 +434,92 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_rank_add)
         EXPECT_TRUE(test::all_close_f(results, expected_values));
     }
 }
+
+namespace
+{
+    // Forwards to a wrapped backend, counting the Functions it is asked to compile
+    class CompileCountingBackend : public runtime::Backend
+    {
+    public:
+        CompileCountingBackend(shared_ptr<runtime::Backend> wrapped)
+            : m_wrapped(wrapped)
+        {
+        }
+
+        shared_ptr<runtime::Tensor> create_tensor() override { return m_wrapped->create_tensor(); }
+        shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                  const Shape& shape) override
+        {
+            return m_wrapped->create_tensor(element_type, shape);
+        }
+        shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                  const Shape& shape,
+                                                  void* memory_pointer) override
+        {
+            return m_wrapped->create_tensor(element_type, shape, memory_pointer);
+        }
+        shared_ptr<runtime::Executable> compile(shared_ptr<Function> func,
+                                                bool enable_performance_data) override
+        {
+            m_compile_count++;
+            return m_wrapped->compile(func, enable_performance_data);
+        }
+
+        size_t get_compile_count() const { return m_compile_count; }
+    private:
+        shared_ptr<runtime::Backend> m_wrapped;
+        size_t m_compile_count = 0;
+    };
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_polymorphic)
+{
+    //
+    // f(x, b) = sum(x + b, axis 1), which is compiled once and rebound to each batch size.
+    //
+    auto x = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+    auto b = make_shared<op::v0::Parameter>(element::f32, PartialShape{4});
+    auto add = make_shared<op::v1::Add>(x, b);
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {1});
+    auto sum = make_shared<op::v1::ReduceSum>(add, axes);
+
+    auto f = make_shared<Function>(OutputVector{sum}, ParameterVector{x, b});
+
+    auto counting =
+        make_shared<CompileCountingBackend>(runtime::Backend::create("${BACKEND_NAME}"));
+    auto backend = make_shared<runtime::dynamic::DynamicBackend>(counting);
+    auto ex = backend->compile(f);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{Dimension::dynamic()});
+    auto t_b = backend->create_tensor(element::f32, Shape{4});
+    copy_data(t_b, vector<float>{1, 2, 3, 4});
+
+    for (size_t batch : {1, 3, 2, 5, 3})
+    {
+        t_r->reset();
+        vector<float> inputs(batch * 4);
+        for (size_t i = 0; i < batch * 4; i++)
+        {
+            inputs[i] = i;
+        }
+        auto t_x = backend->create_tensor(element::f32, Shape{batch, 4});
+        copy_data(t_x, inputs);
+
+        ex->call_with_validate({t_r}, {t_x, t_b});
+
+        ASSERT_EQ(t_r->get_shape(), (Shape{batch}));
+
+        vector<float> expected_values(batch);
+        for (size_t i = 0; i < batch; i++)
+        {
+            expected_values[i] = 16 * i + 6 + 10;
+        }
+
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected_values));
+    }
+
+    // INTERPRETER rebinds its first executable to every later batch size. The other backends
+    // compile each of the four distinct batch sizes.
+    size_t expected_compiles = string("${BACKEND_NAME}") == "INTERPRETER" ? 1 : 4;
+    EXPECT_EQ(counting->get_compile_count(), expected_compiles);
+}
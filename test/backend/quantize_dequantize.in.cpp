@@ -322,6 +322,35 @@ NGRAPH_TEST(${BACKEND_NAME}, dequantize_int8)
                           MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, dequantize_int4_dot)
+{
+    Shape input_shape{3, 2};
+    Shape scale_offset_shape{2};
+    AxisSet quantization_axes{1};
+
+    // Packed 4-bit weights with one scale and offset per output channel
+    auto W = op::v0::Constant::create(element::i4, input_shape, {-8, 7, -1, 0, 3, -2});
+    auto scale = op::v0::Constant::create(element::f32, scale_offset_shape, {0.5f, 2.0f});
+    auto offset = op::v0::Constant::create(element::i4, scale_offset_shape, {1, -1});
+    auto dequantize =
+        make_shared<op::v0::Dequantize>(W, scale, offset, element::f32, quantization_axes);
+    // weights minus offset    -9  8  -2  1  2  -1
+    // multiplied by scale   -4.5 16  -1  2  1  -2
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto dot = make_shared<op::v0::Dot>(X, dequantize);
+    auto f = make_shared<Function>(dot, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(element::f32, Shape{2, 3});
+    auto y = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{-3.5, 14, -17, 62}), read_vector<float>(y), MIN_FLOAT_TOLERANCE_BITS));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, quantize_int8_zero_offset)
 {
     Shape input_shape{4, 3};
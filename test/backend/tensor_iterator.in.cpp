@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_cumulative_sum)
+{
+    // Each iteration adds one row of X to the running sum carried through the back edge
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{4, 2});
+    auto H_init = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+
+    auto X_i = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto H_i = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto H_o = make_shared<op::v1::Add>(H_i, X_i);
+    auto body = make_shared<op::v0::TensorIterator::BodyLambda>(OutputVector{H_o},
+                                                                ParameterVector{X_i, H_i});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(X_i, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_merged_input(H_i, H_init, H_o);
+    auto sums = tensor_iterator->get_concatenated_slices(H_o, 0, 1, 1, -1, 0);
+    auto last = tensor_iterator->get_iter_value(H_o, -1);
+    auto function = make_shared<Function>(OutputVector{sums, last}, ParameterVector{X, H_init});
+
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4, 5, 6, 7, 8});
+    test_case.add_input<float>({10, 20});
+    test_case.add_expected_output<float>(Shape{4, 2}, {11, 22, 14, 26, 19, 32, 26, 40});
+    test_case.add_expected_output<float>(Shape{1, 2}, {26, 40});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_reverse_inner_axis)
+{
+    // Iterates backwards over the columns of X, so slices and concatenated outputs are strided
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto W = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1});
+    auto H_init = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1});
+
+    auto X_i = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1});
+    auto W_i = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1});
+    auto H_i = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1});
+    auto H_o = make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(H_i, W_i), X_i);
+    auto body = make_shared<op::v0::TensorIterator::BodyLambda>(OutputVector{H_o},
+                                                                ParameterVector{X_i, W_i, H_i});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(X_i, X, -1, -1, 1, 0, 1);
+    tensor_iterator->set_invariant_input(W_i, W);
+    tensor_iterator->set_merged_input(H_i, H_init, H_o);
+    auto states = tensor_iterator->get_concatenated_slices(H_o, -1, -1, 1, 0, 1);
+    auto last = tensor_iterator->get_iter_value(H_o, -1);
+    auto function =
+        make_shared<Function>(OutputVector{states, last}, ParameterVector{X, W, H_init});
+
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4, 5, 6});
+    test_case.add_input<float>({2, 3});
+    test_case.add_input<float>({0, 1});
+    test_case.add_expected_output<float>(Shape{2, 3}, {17, 8, 3, 100, 32, 9});
+    test_case.add_expected_output<float>(Shape{2, 1}, {17, 100});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_concurrent_calls)
+{
+    // Several threads share one executable, and with it the compiled body
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{4, 2});
+    auto H_init = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+
+    auto X_i = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto H_i = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto H_o = make_shared<op::v1::Add>(H_i, X_i);
+    auto body = make_shared<op::v0::TensorIterator::BodyLambda>(OutputVector{H_o},
+                                                                ParameterVector{X_i, H_i});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(X_i, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_merged_input(H_i, H_init, H_o);
+    auto last = tensor_iterator->get_iter_value(H_o, -1);
+    auto function = make_shared<Function>(OutputVector{last}, ParameterVector{X, H_init});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(function);
+
+    auto run = [&](float offset, bool& correct) {
+        auto x = backend->create_tensor(element::f32, Shape{4, 2});
+        auto h = backend->create_tensor(element::f32, Shape{1, 2});
+        auto result = backend->create_tensor(element::f32, Shape{1, 2});
+        copy_data(x, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+        copy_data(h, vector<float>{offset, offset});
+        correct = true;
+        for (size_t i = 0; i < 20; i++)
+        {
+            handle->call_with_validate({result}, {x, h});
+            correct = correct && test::all_close_f(vector<float>{16 + offset, 20 + offset},
+                                                   read_vector<float>(result));
+        }
+    };
+    bool correct[2];
+    thread first(run, 0.0f, std::ref(correct[0]));
+    thread second(run, 100.0f, std::ref(correct[1]));
+    first.join();
+    second.join();
+    EXPECT_TRUE(correct[0]);
+    EXPECT_TRUE(correct[1]);
+}
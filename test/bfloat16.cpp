@@ -140,6 +140,36 @@ TEST(bfloat16, to_float)
     EXPECT_EQ(f, 1.03125f);
 }
 
+TEST(bfloat16, block_conversions)
+{
+    // An odd count exercises both the vector loop and the scalar tail
+    const size_t count = 1003;
+    std::mt19937 engine(0);
+    std::uniform_int_distribution<uint32_t> bits;
+    std::vector<float> floats(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        floats[i] = test::FloatUnion(bits(engine)).f;
+    }
+    floats[0] = std::numeric_limits<float>::quiet_NaN();
+    floats[1] = -std::numeric_limits<float>::infinity();
+
+    std::vector<bfloat16> halves(count);
+    bfloat16::from_float(floats.data(), halves.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(halves[i].to_bits(), bfloat16(floats[i]).to_bits()) << "index " << i;
+    }
+
+    std::vector<float> back(count);
+    bfloat16::to_float(halves.data(), back.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(test::FloatUnion(back[i]).i, test::FloatUnion(float(halves[i])).i)
+            << "index " << i;
+    }
+}
+
 TEST(bfloat16, numeric_limits)
 {
     bfloat16 infinity = numeric_limits<bfloat16>::infinity();
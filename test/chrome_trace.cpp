@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "nlohmann/json.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+// Whether the complete event inner lies within outer on the same thread
+static bool nests_in(const json& inner, const json& outer)
+{
+    size_t inner_begin = inner["ts"];
+    size_t inner_end = inner_begin + inner["dur"].get<size_t>();
+    size_t outer_begin = outer["ts"];
+    size_t outer_end = outer_begin + outer["dur"].get<size_t>();
+    return inner["tid"] == outer["tid"] && outer_begin <= inner_begin && inner_end <= outer_end;
+}
+
+// Whether inner nests in one of the events of outers, which are sorted by "ts" and do not
+// overlap
+static bool nests_in_any(const json& inner, const vector<json>& outers)
+{
+    auto it = upper_bound(
+        outers.begin(), outers.end(), inner["ts"].get<size_t>(), [](size_t ts, const json& e) {
+            return ts < e["ts"].get<size_t>();
+        });
+    return it != outers.begin() && nests_in(inner, *prev(it));
+}
+
+TEST(chrome_trace, two_threads)
+{
+    auto path = file_util::path_join(file_util::get_temp_directory_path(), "chrome_trace.json");
+    bool was_enabled = event::Manager::is_event_tracing_enabled();
+    event::Manager::close();
+    event::Manager::open(path);
+    event::Manager::enable_event_tracing();
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(make_shared<op::v1::Add>(A, B), B),
+                                   ParameterVector{A, B});
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+
+    // Enough calls that each thread fills and flushes its buffer several times before it exits
+    const size_t calls = 500;
+    auto run = [&](size_t worker, size_t& tid) {
+        tid = event::Manager::get_thread_id();
+        event::Duration worker_span("worker", "Test", R"({"worker":)" + to_string(worker) + "}");
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        for (size_t i = 0; i < calls; i++)
+        {
+            handle->call_with_validate({result}, {a, b});
+        }
+    };
+    size_t tids[2];
+    thread first(run, 0, std::ref(tids[0]));
+    thread second(run, 1, std::ref(tids[1]));
+    first.join();
+    second.join();
+
+    event::Manager::close();
+    if (!was_enabled)
+    {
+        event::Manager::disable_event_tracing();
+    }
+
+    json trace;
+    {
+        ifstream in(path);
+        ASSERT_NO_THROW(in >> trace);
+    }
+    file_util::remove_file(path);
+    ASSERT_TRUE(trace.is_array());
+
+    vector<json> run_passes;
+    vector<json> passes;
+    map<size_t, vector<json>> workers;
+    map<size_t, vector<json>> calls_by_tid;
+    map<size_t, vector<json>> ops_by_tid;
+    for (auto& event : trace)
+    {
+        if (event["ph"] != "X")
+        {
+            continue;
+        }
+        size_t tid = event["tid"];
+        if (event["cat"] == "Pass")
+        {
+            (event["name"] == "run_passes" ? run_passes : passes).push_back(event);
+        }
+        else if (event["cat"] == "Test")
+        {
+            workers[tid].push_back(event);
+        }
+        else if (event["cat"] == "Interpreter")
+        {
+            (event["name"] == "call" ? calls_by_tid : ops_by_tid)[tid].push_back(event);
+        }
+    }
+
+    // Every pass runs inside a run_passes span of the thread that compiled
+    ASSERT_FALSE(passes.empty());
+    for (auto& pass : passes)
+    {
+        EXPECT_TRUE(any_of(run_passes.begin(), run_passes.end(), [&](const json& outer) {
+            return nests_in(pass, outer);
+        })) << pass.dump();
+    }
+
+    ASSERT_NE(tids[0], tids[1]);
+    for (size_t worker = 0; worker < 2; worker++)
+    {
+        size_t tid = tids[worker];
+        ASSERT_EQ(workers[tid].size(), 1u);
+        auto& worker_span = workers[tid][0];
+        EXPECT_EQ(worker_span["args"]["worker"], worker);
+
+        // Each thread's calls land under its own tid and nest in its worker span, and each op
+        // nests in one of those calls
+        auto& calls_of_thread = calls_by_tid[tid];
+        sort(calls_of_thread.begin(), calls_of_thread.end(), [](const json& a, const json& b) {
+            return a["ts"].get<size_t>() < b["ts"].get<size_t>();
+        });
+        EXPECT_EQ(calls_of_thread.size(), calls);
+        for (auto& call : calls_of_thread)
+        {
+            EXPECT_TRUE(nests_in(call, worker_span));
+        }
+        auto& ops = ops_by_tid[tid];
+        EXPECT_GE(ops.size(), calls * f->get_ops().size());
+        for (auto& op : ops)
+        {
+            EXPECT_TRUE(nests_in_any(op, calls_of_thread)) << op.dump();
+        }
+    }
+}
@@ -1012,6 +1012,61 @@ TEST(constant, float16_vector_broadcast)
     EXPECT_EQ(p[3], float16(1));
 }
 
+//
+// Packed sub-byte types
+//
+
+TEST(constant, uint1_vector)
+{
+    Shape shape{10};
+    op::v0::Constant c(element::u1, shape, vector<uint8_t>{1, 0, 1, 1, 0, 0, 0, 1, 1, 0});
+    auto v = c.get_vector<uint8_t>();
+    ASSERT_EQ(v.size(), shape_size(shape));
+    EXPECT_EQ(v, (vector<uint8_t>{1, 0, 1, 1, 0, 0, 0, 1, 1, 0}));
+
+    // Most significant bit first
+    const uint8_t* p = c.get_data_ptr<uint8_t>();
+    EXPECT_EQ(p[0], 0xB1);
+    EXPECT_EQ(p[1], 0x80);
+}
+
+TEST(constant, uint4_string)
+{
+    Shape shape{3};
+    op::v0::Constant c(element::u4, shape, vector<string>{"1", "15", "7"});
+    auto v = c.get_vector<uint8_t>();
+    ASSERT_EQ(v.size(), shape_size(shape));
+    EXPECT_EQ(v, (vector<uint8_t>{1, 15, 7}));
+    EXPECT_EQ(c.get_value_strings(), (vector<string>{"1", "15", "7"}));
+
+    // Low nibble first
+    const uint8_t* p = c.get_data_ptr<uint8_t>();
+    EXPECT_EQ(p[0], 0xF1);
+    EXPECT_EQ(p[1], 0x07);
+}
+
+TEST(constant, uint4_vector_broadcast)
+{
+    Shape shape{5};
+    op::v0::Constant c(element::u4, shape, vector<uint8_t>{9});
+    EXPECT_EQ(c.get_vector<uint8_t>(), (vector<uint8_t>{9, 9, 9, 9, 9}));
+    EXPECT_EQ(c.get_output_tensor(0).size(), 3);
+}
+
+TEST(constant, int4_vector)
+{
+    Shape shape{4};
+    op::v0::Constant c(element::i4, shape, vector<int8_t>{-8, 7, -1, 0});
+    auto v = c.get_vector<int8_t>();
+    ASSERT_EQ(v.size(), shape_size(shape));
+    EXPECT_EQ(v, (vector<int8_t>{-8, 7, -1, 0}));
+    EXPECT_EQ(c.get_value_strings(), (vector<string>{"-8", "7", "-1", "0"}));
+
+    const uint8_t* p = c.get_data_ptr<uint8_t>();
+    EXPECT_EQ(p[0], 0x78);
+    EXPECT_EQ(p[1], 0x0F);
+}
+
 TEST(constant, shared_data)
 {
     Shape shape{100, 200};
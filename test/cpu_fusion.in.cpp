@@ -37,6 +37,9 @@
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/gelu.hpp"
 #include "ngraph/op/group_conv.hpp"
+#include "ngraph/op/gru_cell.hpp"
+#include "ngraph/op/lstm_cell.hpp"
+#include "ngraph/op/lstm_sequence.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
@@ -45,14 +48,17 @@
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/rnn_cell.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tanh.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
@@ -66,11 +72,13 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/packed_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -3060,6 +3068,46 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_quant_fusion_qconvba_q)
     ASSERT_EQ(count_ops_of_type<op::v0::Quantize>(fuse), 6);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_quant_fusion_post_training_int8)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 4, 6, 6});
+        auto filters1 = op::v0::Constant::create(
+            element::f32, Shape{8, 4, 3, 3}, vector<float>(8 * 4 * 3 * 3, 0.25f));
+        auto conv1 = make_shared<op::v0::Convolution>(data, filters1);
+        auto relu = make_shared<op::v0::Relu>(conv1);
+        auto filters2 = op::v0::Constant::create(
+            element::f32, Shape{4, 8, 1, 1}, vector<float>(4 * 8, -0.5f));
+        auto conv2 = make_shared<op::v0::Convolution>(relu, filters2);
+        return make_shared<Function>(conv2, ParameterVector{data});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> input(4 * 6 * 6);
+    rng.initialize(input);
+    auto sample = backend->create_tensor(element::f32, Shape{1, 4, 6, 6});
+    copy_data(sample, input);
+
+    auto cpu_f = make_function();
+    auto table = pass::PostTrainingQuantization::calibrate(cpu_f, *backend, {{sample}});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(
+        pass::PostTrainingQuantization::Precision::INT8, table);
+    pass_manager.run_passes(cpu_f);
+
+    auto fused_f = clone_function(*cpu_f);
+    pass::Manager fusion_manager;
+    fusion_manager.register_pass<runtime::cpu::pass::CPUQuantFusion>();
+    fusion_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::v0::QuantizedConvolutionBias>(fused_f), 2);
+    ASSERT_EQ(count_ops_of_type<op::v0::Convolution>(fused_f), 0);
+
+    auto fp32_results = execute<float>(make_function(), {input}, "${BACKEND_NAME}");
+    auto int8_results = execute<float>(cpu_f, {input}, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(fp32_results.at(0), int8_results.at(0), 0.05f, 0.5f));
+}
+
 #ifndef NGRAPH_JSON_DISABLE
 // Tests that rely on deserializing json files
 
@@ -3239,6 +3287,311 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_lstm_cell)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_gru_cell)
+{
+    auto make_function = [](bool linear_before_reset) {
+        const size_t batch_size = 3;
+        const size_t input_size = 4;
+        const size_t hidden_size = 5;
+        const size_t gates_count = 3;
+
+        const auto X = make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, input_size});
+        const auto W = make_shared<op::v0::Parameter>(element::f32,
+                                                      Shape{gates_count * hidden_size, input_size});
+        const auto R = make_shared<op::v0::Parameter>(
+            element::f32, Shape{gates_count * hidden_size, hidden_size});
+        const auto H_t =
+            make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        const auto B = make_shared<op::v0::Parameter>(
+            element::f32, Shape{(gates_count + (linear_before_reset ? 1 : 0)) * hidden_size});
+
+        const auto gru_cell = make_shared<op::v3::GRUCell>(X,
+                                                           H_t,
+                                                           W,
+                                                           R,
+                                                           B,
+                                                           hidden_size,
+                                                           vector<string>{"sigmoid", "tanh"},
+                                                           vector<float>{},
+                                                           vector<float>{},
+                                                           0.f,
+                                                           linear_before_reset);
+        return make_shared<Function>(OutputVector{gru_cell->output(0)},
+                                     ParameterVector{X, H_t, W, R, B});
+    };
+
+    for (bool linear_before_reset : {false, true})
+    {
+        auto gru_function_cpu = make_function(linear_before_reset);
+        auto gru_function_inter = make_function(linear_before_reset);
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<vector<float>> args;
+
+        for (shared_ptr<op::v0::Parameter> param : gru_function_cpu->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+
+        auto int_results = execute(gru_function_inter, args, "INTERPRETER");
+        auto cpu_results = execute(gru_function_cpu, args, "${BACKEND_NAME}");
+
+        EXPECT_EQ(count_ops_of_type<op::v3::GRUCell>(gru_function_cpu), 0);
+        EXPECT_EQ(count_ops_of_type<op::Rnn>(gru_function_cpu), 1);
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_rnn_cell)
+{
+    auto make_function = []() {
+        const size_t batch_size = 3;
+        const size_t input_size = 4;
+        const size_t hidden_size = 5;
+
+        const auto X = make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, input_size});
+        const auto W = make_shared<op::v0::Parameter>(element::f32, Shape{hidden_size, input_size});
+        const auto R =
+            make_shared<op::v0::Parameter>(element::f32, Shape{hidden_size, hidden_size});
+        const auto H_t =
+            make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        const auto B = make_shared<op::v0::Parameter>(element::f32, Shape{hidden_size});
+
+        const auto rnn_cell = make_shared<op::v0::RNNCell>(X, H_t, W, R, B, hidden_size);
+        return make_shared<Function>(OutputVector{rnn_cell->output(0)},
+                                     ParameterVector{X, H_t, W, R, B});
+    };
+    auto rnn_function_cpu = make_function();
+    auto rnn_function_inter = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+
+    for (shared_ptr<op::v0::Parameter> param : rnn_function_cpu->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(rnn_function_inter, args, "INTERPRETER");
+    auto cpu_results = execute(rnn_function_cpu, args, "${BACKEND_NAME}");
+
+    EXPECT_EQ(count_ops_of_type<op::v0::RNNCell>(rnn_function_cpu), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(rnn_function_cpu), 1);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_lstm_cell_peephole)
+{
+    auto make_function = []() {
+        const size_t batch_size = 3;
+        const size_t input_size = 4;
+        const size_t hidden_size = 5;
+        const size_t gates_count = 4;
+        const size_t peepholes_count = 3;
+
+        const auto X = make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, input_size});
+        const auto W = make_shared<op::v0::Parameter>(element::f32,
+                                                      Shape{gates_count * hidden_size, input_size});
+        const auto R = make_shared<op::v0::Parameter>(
+            element::f32, Shape{gates_count * hidden_size, hidden_size});
+        const auto H_t =
+            make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        const auto C_t =
+            make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        const auto B =
+            make_shared<op::v0::Parameter>(element::f32, Shape{gates_count * hidden_size});
+        const auto P =
+            make_shared<op::v0::Parameter>(element::f32, Shape{peepholes_count * hidden_size});
+
+        const auto lstm_cell = make_shared<op::v0::LSTMCell>(
+            X, H_t, C_t, W, R, B, P, hidden_size, op::LSTMWeightsFormat::FICO);
+        return make_shared<Function>(OutputVector{lstm_cell->output(0), lstm_cell->output(1)},
+                                     ParameterVector{X, H_t, C_t, W, R, B, P});
+    };
+    auto lstm_function_cpu = make_function();
+    auto lstm_function_inter = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+
+    for (shared_ptr<op::v0::Parameter> param : lstm_function_cpu->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(lstm_function_inter, args, "INTERPRETER");
+    auto cpu_results = execute(lstm_function_cpu, args, "${BACKEND_NAME}");
+
+    EXPECT_EQ(count_ops_of_type<op::v0::LSTMCell>(lstm_function_cpu), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(lstm_function_cpu), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_lstm_sequence_bidirectional)
+{
+    auto make_function = []() {
+        const size_t seq_length = 6;
+        const size_t batch_size = 3;
+        const size_t input_size = 4;
+        const size_t hidden_size = 5;
+        const size_t num_directions = 2;
+        const size_t gates_count = 4;
+        const size_t peepholes_count = 3;
+
+        const auto X = make_shared<op::v0::Parameter>(element::f32,
+                                                      Shape{seq_length, batch_size, input_size});
+        const auto H_t = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, batch_size, hidden_size});
+        const auto C_t = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, batch_size, hidden_size});
+        const auto seq_lengths = op::v0::Constant::create(
+            element::i32, Shape{batch_size}, vector<int32_t>(batch_size, seq_length));
+        const auto W = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, gates_count * hidden_size, input_size});
+        const auto R = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, gates_count * hidden_size, hidden_size});
+        const auto B = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, gates_count * hidden_size});
+        const auto P = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, peepholes_count * hidden_size});
+
+        const auto lstm_sequence = make_shared<op::v0::LSTMSequence>(
+            X,
+            H_t,
+            C_t,
+            seq_lengths,
+            W,
+            R,
+            B,
+            P,
+            hidden_size,
+            op::v0::LSTMSequence::direction::BIDIRECTIONAL);
+        return make_shared<Function>(lstm_sequence->outputs(),
+                                     ParameterVector{X, H_t, C_t, W, R, B, P});
+    };
+    auto lstm_function_cpu = make_function();
+    auto lstm_function_inter = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+
+    for (shared_ptr<op::v0::Parameter> param : lstm_function_cpu->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(lstm_function_inter, args, "INTERPRETER");
+    auto cpu_results = execute(lstm_function_cpu, args, "${BACKEND_NAME}");
+
+    EXPECT_EQ(count_ops_of_type<op::v0::LSTMSequence>(lstm_function_cpu), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(lstm_function_cpu), 2);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_tensor_iterator_gru)
+{
+    const size_t seq_length = 5;
+    const size_t batch_size = 3;
+    const size_t input_size = 4;
+    const size_t hidden_size = 6;
+    const size_t gates_count = 3;
+
+    auto make_parameters = [&]() {
+        return ParameterVector{
+            make_shared<op::v0::Parameter>(element::f32,
+                                           Shape{batch_size, seq_length, input_size}),
+            make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size}),
+            make_shared<op::v0::Parameter>(element::f32,
+                                           Shape{gates_count * hidden_size, input_size}),
+            make_shared<op::v0::Parameter>(element::f32,
+                                           Shape{gates_count * hidden_size, hidden_size}),
+            make_shared<op::v0::Parameter>(element::f32, Shape{gates_count * hidden_size})};
+    };
+
+    // the loop steps a GRUCell over the sequence, sliced along axis 1
+    auto params = make_parameters();
+    auto Xi = make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, 1, input_size});
+    auto Hi = make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size});
+    auto W_body = make_shared<op::v0::Parameter>(element::f32, params[2]->get_output_shape(0));
+    auto R_body = make_shared<op::v0::Parameter>(element::f32, params[3]->get_output_shape(0));
+    auto B_body = make_shared<op::v0::Parameter>(element::f32, params[4]->get_output_shape(0));
+    auto cell = make_shared<op::v3::GRUCell>(
+        make_shared<op::v0::Reshape>(Xi, AxisVector{0, 1, 2}, Shape{batch_size, input_size}),
+        Hi,
+        W_body,
+        R_body,
+        B_body,
+        hidden_size);
+    Output<Node> Yi = make_shared<op::v0::Reshape>(
+        cell->output(0), AxisVector{0, 1}, Shape{batch_size, 1, hidden_size});
+    auto body = make_shared<op::v0::TensorIterator::BodyLambda>(
+        OutputVector{cell->output(0), Yi}, ParameterVector{Xi, Hi, W_body, R_body, B_body});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, params[0], 0, 1, 1, -1, 1);
+    tensor_iterator->set_merged_input(Hi, params[1], cell->output(0));
+    tensor_iterator->set_invariant_input(W_body, params[2]);
+    tensor_iterator->set_invariant_input(R_body, params[3]);
+    tensor_iterator->set_invariant_input(B_body, params[4]);
+    auto Y = tensor_iterator->get_concatenated_slices(Yi, 0, 1, 1, -1, 1);
+    auto H_last = tensor_iterator->get_iter_value(cell->output(0), -1);
+    auto cpu_f = make_shared<Function>(OutputVector{Y, H_last}, params);
+
+    // the INTERPRETER reference unrolls the same loop by hand
+    auto ref_params = make_parameters();
+    Output<Node> H = ref_params[1];
+    OutputVector steps;
+    for (size_t t = 0; t < seq_length; t++)
+    {
+        auto Xt = make_shared<op::v0::Slice>(ref_params[0],
+                                             Coordinate{0, t, 0},
+                                             Coordinate{batch_size, t + 1, input_size});
+        H = make_shared<op::v3::GRUCell>(
+                make_shared<op::v0::Reshape>(
+                    Xt, AxisVector{0, 1, 2}, Shape{batch_size, input_size}),
+                H,
+                ref_params[2],
+                ref_params[3],
+                ref_params[4],
+                hidden_size)
+                ->output(0);
+        steps.push_back(make_shared<op::v0::Reshape>(
+            H, AxisVector{0, 1}, Shape{batch_size, 1, hidden_size}));
+    }
+    Output<Node> Y_ref = make_shared<op::v0::Concat>(steps, 1);
+    auto int_f = make_shared<Function>(OutputVector{Y_ref, H}, ref_params);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : params)
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+
+    EXPECT_EQ(count_ops_of_type<op::v0::TensorIterator>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(cpu_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_rnn_fusion_2rnn_layer_3lstm_cell)
 {
     const std::string file_name("mxnet/2rnn_layer_3lstm_cell.json");
@@ -3343,3 +3696,117 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_mlir_matmul_bias)
 }
 
 #endif
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_elementwise_chain)
+{
+    Shape shape{2, 3, 40};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{40});
+        auto half = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto scaled = make_shared<op::v1::Multiply>(A, B);
+        auto biased = make_shared<op::v1::Add>(
+            scaled, make_shared<op::v0::Broadcast>(bias, shape, AxisSet{0, 1}));
+        auto activated = make_shared<op::v1::Multiply>(
+            make_shared<op::v0::Tanh>(biased),
+            make_shared<op::v0::Broadcast>(half, shape, AxisSet{0, 1, 2}));
+        auto sum = make_shared<op::v0::Sum>(make_shared<op::v0::Exp>(activated), AxisSet{2});
+        return make_shared<Function>(OutputVector{activated, sum}, ParameterVector{A, B, bias});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+    // The activation is a result of its own, the exponent and the sum form a second chain
+    EXPECT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::v0::Tanh>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Sum>(cpu_f), 0);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_conv_post_ops)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 5, 5});
+        auto weights = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto conv = make_shared<op::v0::Convolution>(data, weights);
+        auto half = op::v0::Constant::create(
+            element::f32, conv->get_output_shape(0), vector<float>(2 * 4 * 3 * 3, 0.5f));
+        auto scaled = make_shared<op::v1::Multiply>(make_shared<op::v0::Tanh>(conv), half);
+        auto swish = make_shared<op::v1::Multiply>(scaled, make_shared<op::v0::Sigmoid>(scaled));
+        return make_shared<Function>(OutputVector{swish}, ParameterVector{data, weights});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    // Tanh, the scale and Swish all run as post-ops of the convolution
+    EXPECT_EQ(count_ops_of_type<op::v0::Tanh>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Sigmoid>(cpu_f), 0);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_packed_matmul)
+{
+    size_t depth = 75;
+    size_t channels = 130;
+    vector<uint8_t> weights(depth * channels);
+    vector<float> scales(channels);
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        weights[i] = (i * 7) % 16;
+    }
+    for (size_t i = 0; i < channels; i++)
+    {
+        scales[i] = 0.01f * (i % 5 + 1);
+    }
+    // Weights as [K, N] with per channel scales, and as [N, K] read through a transpose
+    auto make_function = [&](bool transposed) {
+        Shape shape = transposed ? Shape{channels, depth} : Shape{depth, channels};
+        auto data = make_shared<op::v0::Parameter>(element::f32, Shape{3, depth});
+        auto w = op::v0::Constant::create(element::u4, shape, weights);
+        auto scale = op::v0::Constant::create(element::f32, Shape{channels}, scales);
+        auto zero_point = op::v0::Constant::create(element::u4, Shape{}, {8});
+        auto dq = make_shared<op::v0::Dequantize>(
+            w, scale, zero_point, element::f32, AxisSet{transposed ? 0u : 1u});
+        auto dot = make_shared<op::v0::MatMul>(data, dq, false, transposed);
+        return make_shared<Function>(OutputVector{dot}, ParameterVector{data});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(3 * depth);
+    rng.initialize(data);
+    for (bool transposed : {false, true})
+    {
+        auto cpu_f = make_function(transposed);
+        auto int_f = make_function(transposed);
+        auto int_results = execute(int_f, {data}, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, {data}, "${BACKEND_NAME}");
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+        EXPECT_EQ(count_ops_of_type<op::PackedMatmul>(cpu_f), 1);
+        EXPECT_EQ(count_ops_of_type<op::v0::Dequantize>(cpu_f), 0);
+    }
+}
@@ -16,14 +16,18 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <sstream>
 #include <thread>
 
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/ring.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -37,12 +41,16 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_autotuner.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close.hpp"
@@ -920,6 +928,91 @@ NGRAPH_TEST(${BACKEND_NAME},
         vector<float>{-5., -6., -7., -8.}, read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_in_place_elementwise_last_user)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto sin = make_shared<op::v0::Sin>(A);
+    auto cos = make_shared<op::v0::Cos>(sin);
+    // Last user of both sin and cos
+    auto power = make_shared<op::v1::Power>(sin, cos);
+    auto f = make_shared<Function>(make_shared<op::v0::Sin>(power), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    EXPECT_NE(cos->get_output_tensor(0).get_pool_offset(),
+              sin->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(power->get_output_tensor(0).get_pool_offset(),
+              sin->get_output_tensor(0).get_pool_offset());
+
+    vector<float> a_data{0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f};
+    vector<float> expected;
+    for (auto x : a_data)
+    {
+        expected.push_back(std::sin(std::pow(std::sin(x), std::cos(std::sin(x)))));
+    }
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_in_place_pad)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::v0::Negative>(A);
+    auto pad_value = op::v0::Constant::create(element::f32, Shape{}, {9});
+    auto pad = make_shared<op::v0::Pad>(neg, pad_value, CoordinateDiff{1, 0}, CoordinateDiff{2, 0});
+    auto f = make_shared<Function>(make_shared<op::v0::Sin>(pad), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    // The negation is written after the first padded row
+    EXPECT_EQ(neg->get_output_tensor(0).get_pool_offset(),
+              pad->get_output_tensor(0).get_pool_offset() + 3 * sizeof(float));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, Shape{5, 3});
+    vector<float> expected;
+    for (float x : {9, 9, 9, -1, -2, -3, -4, -5, -6, 9, 9, 9, 9, 9, 9})
+    {
+        expected.push_back(std::sin(x));
+    }
+    for (auto it = 0; it < 2; it++)
+    {
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_in_place_unit_axis_transpose)
+{
+    Shape shape{2, 1, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::v0::Negative>(A);
+    auto reshape = make_shared<op::v0::Reshape>(neg, AxisVector{1, 0, 2}, Shape{1, 2, 3});
+    auto f = make_shared<Function>(make_shared<op::v0::Sin>(reshape), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    EXPECT_EQ(reshape->get_output_tensor(0).get_pool_offset(),
+              neg->get_output_tensor(0).get_pool_offset());
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, Shape{1, 2, 3});
+    handle->call_with_validate({result}, {a});
+    vector<float> expected;
+    for (float x : {1, 2, 3, 4, 5, 6})
+    {
+        expected.push_back(std::sin(-x));
+    }
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_convert_inplace)
 {
     Shape shape{2, 2};
@@ -2320,3 +2413,457 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_released_constant_bytes)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto C = op::v0::Constant::create(element::f32, shape, {2, 2, 2, 2});
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(A, make_shared<op::v1::Multiply>(B, C)),
+                                   ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    ASSERT_NE(handle, nullptr);
+    // B * C is folded into a single Constant, the storage of B and C is no longer used
+    EXPECT_EQ(handle->get_constant_bytes(), shape_size(shape) * sizeof(float));
+    EXPECT_EQ(handle->get_released_constant_bytes(), shape_size(shape) * sizeof(float));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 1, 1, 1});
+    auto result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(vector<float>{3, 5, 7, 9}, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_memory_report)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(make_shared<op::v1::Add>(A, B), C),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 1, 1, 1});
+    copy_data(b, vector<float>{1, 2, 3, 4});
+    auto result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 6, 12, 20}, read_vector<float>(result)));
+
+    auto report = handle->get_memory_report();
+    size_t tensor_bytes = shape_size(shape) * sizeof(float);
+    EXPECT_EQ(report.get_bytes(runtime::MemoryReport::constants), tensor_bytes);
+    // The sum is the only intermediate, one pool per context holds it
+    EXPECT_GE(report.get_bytes(runtime::MemoryReport::intermediates), tensor_bytes);
+    size_t op_intermediate_bytes = 0;
+    for (auto& op : report.get_ops())
+    {
+        auto it = op.second.find(runtime::MemoryReport::intermediates);
+        op_intermediate_bytes += it == op.second.end() ? 0 : it->second;
+    }
+    EXPECT_EQ(op_intermediate_bytes, tensor_bytes);
+    // A single call uses one context
+    EXPECT_GE(report.get_peak_bytes(), 2 * tensor_bytes);
+    EXPECT_LE(report.get_peak_bytes(), report.get_total_bytes());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_layout_reorders)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto W = op::v0::Constant::create(
+            element::f32, Shape{16, 16, 3, 3}, vector<float>(16 * 16 * 3 * 3, 0.1f));
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, 6, 6});
+        auto conv = make_shared<op::v0::Convolution>(A, W);
+        // The sum is only read by the Result, so it should keep the native layout of B
+        return make_shared<Function>(make_shared<op::v1::Add>(conv, B), ParameterVector{A, B});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    auto f = make_function();
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    ASSERT_NE(handle, nullptr);
+    size_t output_reorders = 0;
+    for (auto& reorder : handle->get_layout_reorders())
+    {
+        EXPECT_NE(reorder.producer, f->get_parameters().at(1)->get_name());
+        EXPECT_GT(reorder.bytes, 0);
+        if (reorder.producer != f->get_parameters().at(0)->get_name())
+        {
+            output_reorders++;
+        }
+    }
+    // At most the convolution output is converted back to the native layout
+    EXPECT_LE(output_reorders, 1);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_autotune_dot)
+{
+    auto cache_path =
+        file_util::path_join(file_util::get_temp_directory_path(), "cpu_test_tuning_cache.txt");
+    if (file_util::exists(cache_path))
+    {
+        file_util::remove_file(cache_path);
+    }
+    set_environment("NGRAPH_CPU_AUTOTUNE", "1", 1);
+    set_environment("NGRAPH_CPU_TUNING_CACHE", cache_path.c_str(), 1);
+
+    Shape shape_a{3, 2};
+    Shape shape_b{2, 4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::v0::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1, 0, 0, 1, 0, 1, 1, 1});
+    auto result = backend->create_tensor(element::f32, Shape{3, 4});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 2, 2, 3, 3, 4, 4, 7, 5, 6, 6, 11},
+                                  read_vector<float>(result)));
+
+    unset_environment("NGRAPH_CPU_AUTOTUNE");
+    unset_environment("NGRAPH_CPU_TUNING_CACHE");
+
+    // The choice for the product shape is persisted
+    auto cache = file_util::read_file_to_string(cache_path);
+    EXPECT_NE(cache.find("Gemm_f32_NN_3x4x2"), string::npos);
+    file_util::remove_file(cache_path);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_autotune_matmul_bias)
+{
+    auto temp_dir = file_util::get_temp_directory_path();
+    auto cache_path = file_util::path_join(temp_dir, "cpu_test_matmul_tuning_cache.txt");
+    if (file_util::exists(cache_path))
+    {
+        file_util::remove_file(cache_path);
+    }
+    set_environment("NGRAPH_CPU_AUTOTUNE", "1", 1);
+
+    // C(3 x 4) = transpose(W) * transpose(x)
+    Shape shape_w{2, 3};
+    Shape shape_x{4, 2};
+    // The backend returns the executable it already has for a Function, so each compile below
+    // gets a fresh one to make the builder consult the autotuner again
+    auto make_function = [&]() {
+        auto W = make_shared<op::v0::Parameter>(element::f32, shape_w);
+        auto x = make_shared<op::v0::Parameter>(element::f32, shape_x);
+        auto mm = make_shared<op::MatmulBias>(W, x, Output<Node>(), shape_w, shape_x, true, true);
+        return make_shared<Function>(mm, ParameterVector{W, x});
+    };
+    const string signature = "Gemm_f32_TT_3x4x2";
+    auto& autotuner = runtime::cpu::CPUAutotuner::get();
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto w = backend->create_tensor(element::f32, shape_w);
+    copy_data(w, vector<float>{1, 2, 3, 4, 5, 6});
+    auto a = backend->create_tensor(element::f32, shape_x);
+    copy_data(a, vector<float>{1, 0, 0, 1, 1, 1, 2, 0});
+    auto result = backend->create_tensor(element::f32, Shape{3, 4});
+    vector<float> expected{1, 4, 5, 2, 2, 5, 7, 4, 3, 6, 9, 6};
+
+    set_environment("NGRAPH_CPU_TUNING_CACHE", cache_path.c_str(), 1);
+    backend->compile(make_function())->call_with_validate({result}, {w, a});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    auto tuned = file_util::read_file_to_string(cache_path);
+    ASSERT_NE(tuned.find(signature), string::npos);
+
+    // Rewrite the measured choice to force cblas (0) and then Eigen (1)
+    for (size_t choice : {0, 1})
+    {
+        auto forced_path = file_util::path_join(
+            temp_dir, "cpu_test_matmul_tuning_cache_" + to_string(choice) + ".txt");
+        {
+            ofstream forced(forced_path, ios::trunc);
+            stringstream lines(tuned);
+            string line;
+            while (getline(lines, line))
+            {
+                forced << line.substr(0, line.rfind('\t')) << "\t" << choice << "\n";
+            }
+        }
+        set_environment("NGRAPH_CPU_TUNING_CACHE", forced_path.c_str(), 1);
+        copy_data(result, vector<float>(12, 0));
+        auto selected = autotuner.get_selection_count(signature, choice);
+        backend->compile(make_function())->call_with_validate({result}, {w, a});
+        EXPECT_EQ(autotuner.get_selection_count(signature, choice), selected + 1);
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+        file_util::remove_file(forced_path);
+    }
+
+    unset_environment("NGRAPH_CPU_AUTOTUNE");
+    unset_environment("NGRAPH_CPU_TUNING_CACHE");
+    file_util::remove_file(cache_path);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dnnl_primitive_cache)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 7, 7});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{5, 3, 3, 3});
+        auto conv = make_shared<op::v0::Convolution>(A,
+                                                     B,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     Strides{1, 1});
+        return make_shared<Function>(OutputVector{conv}, ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    auto int_f = make_function();
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+
+    // The second executable reuses the convolution primitive built for the first one, which
+    // has already been destroyed
+    auto& cache = runtime::cpu::DNNLPrimitiveCache::get();
+    auto first_results = execute(make_function(), args, "${BACKEND_NAME}");
+    auto cached = cache.size();
+    EXPECT_GT(cached, 0);
+    auto hits = cache.hits();
+    auto second_results = execute(make_function(), args, "${BACKEND_NAME}");
+    // Nothing new was built, the lookup returned the primitive already in the cache
+    EXPECT_EQ(cache.size(), cached);
+    EXPECT_GT(cache.hits(), hits);
+
+    EXPECT_TRUE(test::all_close(first_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    EXPECT_TRUE(test::all_close(second_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dnnl_temporaries_in_memory_pool)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1, 4, 8, 8});
+        auto D = make_shared<op::v0::Parameter>(element::f32, Shape{1, 4, 4, 4});
+        // The negation is dead by the time the backprop runs
+        auto sum = make_shared<op::v0::Sum>(make_shared<op::v0::Negative>(A), AxisSet{0});
+        auto bprop = make_shared<op::v0::MaxPoolBackprop>(
+            sum, D, Shape{2, 2}, Strides{2, 2}, Shape{0, 0}, Shape{0, 0});
+        return make_shared<Function>(OutputVector{bprop}, ParameterVector{A, D});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    auto int_f = make_function();
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_f = make_function();
+    vector<shared_ptr<runtime::Tensor>> arg_tensors;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto param = cpu_f->get_parameters().at(i);
+        arg_tensors.push_back(
+            backend->create_tensor(param->get_element_type(), param->get_output_shape(0)));
+        copy_data(arg_tensors.back(), args.at(i));
+    }
+    auto result = backend->create_tensor(element::f32, Shape{1, 4, 8, 8});
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    auto handle = backend->compile(cpu_f, pass_config);
+    for (auto it = 0; it < 2; it++)
+    {
+        handle->call_with_validate({result}, arg_tensors);
+        EXPECT_TRUE(
+            test::all_close(int_results.at(0), read_vector<float>(result), 1.0e-4f, 1.0e-4f));
+    }
+
+    // The max pooling workspace lives in the memory pool, in the space left by the negation
+    auto report = handle->get_memory_report();
+    EXPECT_EQ(report.get_bytes(runtime::MemoryReport::workspaces), 0);
+    EXPECT_GT(report.get_saved_bytes(runtime::MemoryReport::workspaces), 0);
+}
+
+// Ops whose DNNL scratchpads are planned in the memory pool run next to ops that use none, and
+// nothing is left for the shared scratchpad buffer
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dnnl_scratchpads_in_memory_pool)
+{
+#ifdef NGRAPH_TBB_ENABLE
+    bool use_tbb = getenv_bool("NGRAPH_CPU_USE_TBB");
+    unset_environment("NGRAPH_CPU_USE_TBB");
+#endif
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 8, 16, 16});
+        auto W = make_shared<op::v0::Parameter>(element::f32, Shape{8, 8, 3, 3});
+        auto conv = make_shared<op::v0::Convolution>(A, W, Strides{1, 1}, Strides{1, 1});
+        auto relu = make_shared<op::v0::Relu>(conv);
+        auto pool = make_shared<op::v0::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+        auto conv2 = make_shared<op::v0::Convolution>(pool, W, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(OutputVector{conv2}, ParameterVector{A, W});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    auto int_f = make_function();
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_f = make_function();
+    vector<shared_ptr<runtime::Tensor>> arg_tensors;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto param = cpu_f->get_parameters().at(i);
+        arg_tensors.push_back(
+            backend->create_tensor(param->get_element_type(), param->get_output_shape(0)));
+        copy_data(arg_tensors.back(), args.at(i));
+    }
+    auto result = backend->create_tensor(element::f32, cpu_f->get_output_shape(0));
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    auto handle = backend->compile(cpu_f, pass_config);
+    for (auto it = 0; it < 2; it++)
+    {
+        handle->call_with_validate({result}, arg_tensors);
+        EXPECT_TRUE(
+            test::all_close(int_results.at(0), read_vector<float>(result), 1.0e-4f, 1.0e-4f));
+    }
+
+    auto report = handle->get_memory_report();
+    EXPECT_EQ(report.get_bytes(runtime::MemoryReport::scratchpad), 0);
+
+#ifdef NGRAPH_TBB_ENABLE
+    // The flow graph leaves every scratchpad unplanned, so they go to the shared buffer. Its
+    // primitives come from the same cache as the planned ones above
+    set_environment("NGRAPH_CPU_USE_TBB", "1", 1);
+    auto tbb_handle = backend->compile(make_function(), pass_config);
+    if (!use_tbb)
+    {
+        unset_environment("NGRAPH_CPU_USE_TBB");
+    }
+    auto tbb_result = backend->create_tensor(element::f32, cpu_f->get_output_shape(0));
+    for (auto it = 0; it < 2; it++)
+    {
+        tbb_handle->call_with_validate({tbb_result}, arg_tensors);
+        handle->call_with_validate({result}, arg_tensors);
+        EXPECT_TRUE(
+            test::all_close(int_results.at(0), read_vector<float>(tbb_result), 1.0e-4f, 1.0e-4f));
+        EXPECT_TRUE(
+            test::all_close(int_results.at(0), read_vector<float>(result), 1.0e-4f, 1.0e-4f));
+    }
+    EXPECT_GT(tbb_handle->get_memory_report().get_bytes(runtime::MemoryReport::scratchpad), 0);
+#endif
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_sampled_op_latency)
+{
+    set_environment("NGRAPH_CPU_PERF_SAMPLE_PERIOD", "4", 1);
+    Shape shape{2, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto add = make_shared<op::v1::Add>(A, B);
+    auto f = make_shared<Function>(make_shared<op::v0::Tanh>(add), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    unset_environment("NGRAPH_CPU_PERF_SAMPLE_PERIOD");
+    ASSERT_NE(handle, nullptr);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{0, 0, 0, 0, 0, 0});
+    for (size_t i = 0; i < 10; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+    }
+
+    // Calls 0, 4 and 8 are timed
+    auto latencies = handle->get_sampled_performance_data();
+    ASSERT_FALSE(latencies.empty());
+    for (auto& latency : latencies)
+    {
+        EXPECT_EQ(latency.samples, 3u);
+        uint64_t bucketed = 0;
+        for (auto& bucket : latency.histogram)
+        {
+            bucketed += bucket.second;
+        }
+        EXPECT_EQ(bucketed, latency.samples);
+        EXPECT_GE(latency.total_microseconds, 0);
+        EXPECT_NE(latency.node, nullptr);
+    }
+
+    handle->reset_sampled_performance_data();
+    EXPECT_TRUE(handle->get_sampled_performance_data().empty());
+}
+
+#ifndef _WIN32
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_allreduce_async)
+{
+    // A ring of one rank reduces to a copy, which exercises the asynchronous AllReduce path
+    auto exchange_ports = [](int port) { return vector<int>{port}; };
+    set_distributed_interface(
+        unique_ptr<DistributedInterface>(new distributed::Ring(0, 1, exchange_ports)));
+    Shape shape{2, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto ar_a = make_shared<op::v0::AllReduce>(make_shared<op::v0::Negative>(A));
+    auto ar_b = make_shared<op::v0::AllReduce>(B);
+    auto f = make_shared<Function>(OutputVector{make_shared<op::v1::Add>(ar_a, ar_b), ar_b},
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto sum = backend->create_tensor(element::f32, shape);
+    auto reduced_b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{6, 5, 4, 3, 2, 1});
+    for (size_t i = 0; i < 3; i++)
+    {
+        handle->call_with_validate({sum, reduced_b}, {a, b});
+        EXPECT_EQ(read_vector<float>(sum), (vector<float>{5, 3, 1, -1, -3, -5}));
+        EXPECT_EQ(read_vector<float>(reduced_b), (vector<float>{6, 5, 4, 3, 2, 1}));
+    }
+    set_distributed_interface(unique_ptr<DistributedInterface>(new distributed::Null()));
+}
+#endif
@@ -24,6 +24,7 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/product.hpp"
@@ -67,6 +68,26 @@ TEST(CSE, abs_abs_negative)
     ASSERT_EQ(f->get_results().at(1)->get_argument(0), abs2);
 }
 
+TEST(CSE, abs_abs_control_dependency)
+{
+    Shape zero_shape{0};
+    auto A = std::make_shared<op::v0::Parameter>(element::i32, zero_shape);
+    auto B = std::make_shared<op::v0::Parameter>(element::i32, zero_shape);
+    auto abs1 = std::make_shared<op::v0::Abs>(A);
+    auto neg = std::make_shared<op::v0::Negative>(B);
+    // Recomputes abs1 only once neg has run
+    auto abs2 = std::make_shared<op::v0::Abs>(A);
+    abs2->add_control_dependency(neg);
+    auto f = std::make_shared<Function>(OutputVector{abs1, abs2, neg}, ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), abs1);
+    ASSERT_EQ(f->get_results().at(1)->get_argument(0), abs2);
+    ASSERT_EQ(abs2->get_control_dependencies().size(), 1u);
+}
+
 TEST(CSE, add_add)
 {
     Shape zero_shape{0};
@@ -336,6 +357,38 @@ TEST(CSE, one_hot)
     }
 }
 
+TEST(CSE, subtract_not_commutative)
+{
+    Shape shape{2};
+    auto A = std::make_shared<op::v0::Parameter>(element::i32, shape);
+    auto B = std::make_shared<op::v0::Parameter>(element::i32, shape);
+    auto sub1 = std::make_shared<op::v1::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::v1::Subtract>(B, A);
+    auto f = std::make_shared<Function>(OutputVector{sub1, sub2}, ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+}
+
+TEST(CSE, attributes_through_visitor)
+{
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 8, 8});
+    auto filters = std::make_shared<op::v0::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto conv1 = std::make_shared<op::v0::Convolution>(data, filters, Strides{1, 1});
+    auto conv2 = std::make_shared<op::v0::Convolution>(data, filters, Strides{1, 1});
+    auto conv3 = std::make_shared<op::v0::Convolution>(data, filters, Strides{1, 1}, Strides{2, 2});
+    auto f = std::make_shared<Function>(OutputVector{conv1, conv2, conv3},
+                                        ParameterVector{data, filters});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+}
+
 TEST(CSE, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::CommonSubexpressionElimination>();
@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/distributed/ring.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+#ifndef _WIN32
+// Run body(ring) on one thread per rank of a ring of the given size. Every rank listens on a port
+// the system picks and the threads share those ports, so tests never collide on a fixed port.
+static void run_ring(int size, function<void(distributed::Ring&)> body)
+{
+    mutex ports_mutex;
+    condition_variable ports_known;
+    vector<int> ports(size, 0);
+    int missing = size;
+
+    vector<thread> ranks;
+    for (int rank = 0; rank < size; rank++)
+    {
+        ranks.emplace_back([&, rank]() {
+            auto exchange_ports = [&](int port) {
+                unique_lock<mutex> lock(ports_mutex);
+                ports[rank] = port;
+                if (--missing == 0)
+                {
+                    ports_known.notify_all();
+                }
+                ports_known.wait(lock, [&] { return missing == 0; });
+                return ports;
+            };
+            distributed::Ring ring(rank, size, exchange_ports, "127.0.0.1", 1024);
+            body(ring);
+        });
+    }
+    for (auto& rank : ranks)
+    {
+        rank.join();
+    }
+}
+
+TEST(distributed, ring_all_reduce)
+{
+    // Counts smaller than, not divisible by and spanning several segments of the ring
+    for (size_t count : {1, 7, 10001})
+    {
+        run_ring(3, [count](distributed::Ring& ring) {
+            vector<float> in(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                in[i] = static_cast<float>((ring.get_rank() + 1) * (i % 7));
+            }
+            vector<float> out(count);
+            ring.all_reduce(
+                in.data(), out.data(), element::Type_t::f32, reduction::Type::SUM, count);
+            for (size_t i = 0; i < count; i++)
+            {
+                EXPECT_EQ(out[i], 6.0f * (i % 7));
+            }
+
+            vector<int32_t> values(count, ring.get_rank());
+            ring.all_reduce(values.data(),
+                            values.data(),
+                            element::Type_t::i32,
+                            reduction::Type::MAX,
+                            count);
+            EXPECT_EQ(values, vector<int32_t>(count, 2));
+        });
+    }
+}
+
+TEST(distributed, ring_all_reduce_async)
+{
+    run_ring(4, [](distributed::Ring& ring) {
+        vector<vector<double>> buffers(8, vector<double>(513, ring.get_rank()));
+        vector<shared_ptr<DistributedRequest>> requests;
+        for (auto& buffer : buffers)
+        {
+            requests.push_back(ring.all_reduce_async(buffer.data(),
+                                                     buffer.data(),
+                                                     element::Type_t::f64,
+                                                     reduction::Type::SUM,
+                                                     buffer.size()));
+        }
+        for (size_t i = 0; i < buffers.size(); i++)
+        {
+            requests[i]->wait();
+            EXPECT_EQ(buffers[i], vector<double>(513, 6.0));
+        }
+    });
+}
+
+TEST(distributed, ring_broadcast_send_recv)
+{
+    run_ring(3, [](distributed::Ring& ring) {
+        vector<int64_t> data(5, ring.get_rank() == 1 ? 42 : 0);
+        ring.broadcast(data.data(), element::Type_t::i64, data.size(), 1);
+        EXPECT_EQ(data, vector<int64_t>(5, 42));
+
+        float value = static_cast<float>(ring.get_rank());
+        if (ring.get_rank() == 0)
+        {
+            ring.send(&value, element::Type_t::f32, 1, 2);
+        }
+        else if (ring.get_rank() == 2)
+        {
+            ring.recv(&value, element::Type_t::f32, 1, 0);
+            EXPECT_EQ(value, 0.0f);
+        }
+    });
+}
+#endif
+
+TEST(distributed, allreduce_bucketing)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::v0::Parameter>(element::f32, Shape{});
+    auto D = make_shared<op::v0::Parameter>(element::f64, Shape{4});
+    auto ar_a = make_shared<op::v0::AllReduce>(A);
+    auto ar_b = make_shared<op::v0::AllReduce>(B);
+    auto ar_c = make_shared<op::v0::AllReduce>(C);
+    auto ar_d = make_shared<op::v0::AllReduce>(D);
+    // Depends on another AllReduce, so it must stay on its own
+    auto ar_e = make_shared<op::v0::AllReduce>(make_shared<op::v0::Negative>(ar_b));
+    auto f = make_shared<Function>(OutputVector{ar_a, ar_b, ar_c, ar_d, ar_e},
+                                   ParameterVector{A, B, C, D});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+
+    // A, B and C share one bucket; D has another type and E depends on B
+    EXPECT_EQ(count_ops_of_type<op::v0::AllReduce>(f), 3);
+    EXPECT_EQ(count_ops_of_type<op::v0::Concat>(f), 1);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(f->get_output_shape(2), (Shape{}));
+
+    auto g = make_shared<Function>(
+        OutputVector{make_shared<op::v0::AllReduce>(A), make_shared<op::v0::AllReduce>(B)},
+        ParameterVector{A, B});
+    pass::Manager small_buckets;
+    small_buckets.register_pass<pass::AllReduceBucketing>(16);
+    small_buckets.run_passes(g);
+    EXPECT_EQ(count_ops_of_type<op::v0::AllReduce>(g), 2);
+}
@@ -119,3 +119,35 @@ TEST(float16, values)
     EXPECT_EQ(static_cast<float16>(65519.0).to_bits(), 0x7bff);
     EXPECT_EQ(static_cast<float16>(65520.0).to_bits(), 0x7c00);
 }
+
+TEST(float16, block_conversions)
+{
+    // An odd count exercises both the vector loop and the scalar tail
+    const size_t count = 1003;
+    std::mt19937 engine(0);
+    std::uniform_int_distribution<uint32_t> bits;
+    std::vector<float> floats(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        floats[i] = test::FloatUnion(bits(engine)).f;
+    }
+    floats[0] = std::numeric_limits<float>::quiet_NaN();
+    floats[1] = -std::numeric_limits<float>::infinity();
+    floats[2] = 65520.0f;
+    floats[3] = 1.5f / (256.0f * 65536.0f);
+
+    std::vector<float16> halves(count);
+    float16::from_float(floats.data(), halves.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(halves[i].to_bits(), float16(floats[i]).to_bits()) << "index " << i;
+    }
+
+    std::vector<float> back(count);
+    float16::to_float(halves.data(), back.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(test::FloatUnion(back[i]).i, test::FloatUnion(float(halves[i])).i)
+            << "index " << i;
+    }
+}
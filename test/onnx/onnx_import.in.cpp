@@ -35,6 +35,7 @@
 // clang-format on
 
 #include "gtest/gtest.h"
+#include "misc.hpp"
 #include "ngraph/frontend/onnx_import/onnx.hpp"
 #include "ngraph/frontend/onnx_import/onnx_utils.hpp"
 #include "ngraph/frontend/onnx_import/default_opset.hpp"
@@ -188,6 +189,32 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    // The unused initializer refers to a missing file and must not be loaded
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data.prototxt"));
+    EXPECT_EQ(count_ops_of_type<onnx_import::default_opset::Constant>(function), 1);
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({2, 4, 6, 8});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_parallel_import)
+{
+    set_environment("NGRAPH_ONNX_IMPORT_THREADS", "4", 1);
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/independent_nodes.prototxt"));
+    unset_environment("NGRAPH_ONNX_IMPORT_THREADS");
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_multiple_inputs(Inputs{{-1, 2, -3, 4}, {-5, 6, 7, -8}});
+    test_case.add_expected_output(Shape{4}, std::vector<float>{6, 6, 10, 8});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(
@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "util/all_close.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static vector<float> make_values(size_t size, float scale, size_t seed)
+{
+    vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = scale * (static_cast<float>((i * 37 + seed * 11) % 23) / 11.0f - 1.0f);
+    }
+    return values;
+}
+
+// Parameter -> Convolution -> Relu -> Convolution
+static shared_ptr<Function> make_conv_chain()
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 5, 5});
+    auto filters1 = op::v0::Constant::create(
+        element::f32, Shape{4, 2, 3, 3}, make_values(4 * 2 * 3 * 3, 0.5f, 1));
+    auto conv1 = make_shared<op::v0::Convolution>(data, filters1);
+    conv1->set_friendly_name("conv1");
+    auto relu = make_shared<op::v0::Relu>(conv1);
+    auto filters2 =
+        op::v0::Constant::create(element::f32, Shape{3, 4, 1, 1}, make_values(3 * 4, 2.0f, 2));
+    auto conv2 = make_shared<op::v0::Convolution>(relu, filters2);
+    conv2->set_friendly_name("conv2");
+    return make_shared<Function>(conv2, ParameterVector{data});
+}
+
+TEST(post_training_quantization, int8_calibrated)
+{
+    auto f = make_conv_chain();
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    vector<vector<shared_ptr<runtime::Tensor>>> samples;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto sample = backend->create_tensor(element::f32, Shape{1, 2, 5, 5});
+        copy_data(sample, make_values(2 * 5 * 5, 1.0f, i));
+        samples.push_back({sample});
+    }
+    auto table = pass::PostTrainingQuantization::calibrate(f, *backend, samples);
+    // Data and output of both convolutions; conv1's output is not conv2's input
+    ASSERT_EQ(table.size(), 4);
+    ASSERT_EQ(table.count("conv1:0"), 1);
+    EXPECT_LT(table["conv1:0"].min, 0);
+    EXPECT_GT(table["conv1:0"].max, 0);
+
+    auto reference = clone_function(*f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(
+        pass::PostTrainingQuantization::Precision::INT8, table);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Quantize>(f), 4);
+    // Four activations plus the two per-channel filters
+    EXPECT_EQ(count_ops_of_type<op::v0::Dequantize>(f), 6);
+    for (auto node : f->get_ordered_ops())
+    {
+        if (auto q = as_type_ptr<op::v0::Quantize>(node))
+        {
+            if (is_type<op::v0::Relu>(q->get_argument(0)))
+            {
+                // Non-negative activations use the full unsigned range
+                EXPECT_EQ(q->get_output_element_type(0), element::u8);
+            }
+        }
+    }
+
+    auto expected = backend->create_tensor(element::f32, Shape{1, 3, 3, 3});
+    auto actual = backend->create_tensor(element::f32, Shape{1, 3, 3, 3});
+    backend->compile(reference)->call_with_validate({expected}, {samples[1][0]});
+    backend->compile(f)->call_with_validate({actual}, {samples[1][0]});
+    auto expected_values = read_vector<float>(expected);
+    float bound = 0;
+    for (auto v : expected_values)
+    {
+        bound = max(bound, fabs(v));
+    }
+    EXPECT_TRUE(
+        test::all_close(expected_values, read_vector<float>(actual), 0.05f, 0.02f * bound));
+}
+
+TEST(post_training_quantization, int8_keeps_fp32)
+{
+    auto f = make_conv_chain();
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto sample = backend->create_tensor(element::f32, Shape{1, 2, 5, 5});
+    copy_data(sample, make_values(2 * 5 * 5, 1.0f, 0));
+    auto table = pass::PostTrainingQuantization::calibrate(f, *backend, {{sample}});
+    // Uncalibrated convolutions stay in f32 too
+    table.erase("conv2:0");
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(
+        pass::PostTrainingQuantization::Precision::INT8, table, set<string>{"conv1"});
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Quantize>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Dequantize>(f), 0);
+}
+
+TEST(post_training_quantization, bf16)
+{
+    auto f = make_conv_chain();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(
+        pass::PostTrainingQuantization::Precision::BF16);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 4);
+    for (auto node : f->get_ordered_ops())
+    {
+        if (is_type<op::v0::Convolution>(node))
+        {
+            EXPECT_EQ(node->get_input_element_type(0), element::bf16);
+            EXPECT_EQ(node->get_input_element_type(1), element::bf16);
+        }
+        else if (is_type<op::v0::Relu>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::f32);
+        }
+    }
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+}
@@ -29,6 +29,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/structural_hash.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 #include "util/all_close_f.hpp"
@@ -192,6 +193,83 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, binary_constant)
+{
+    const string tmp_file = file_util::tmp_filename("ngraph");
+    Shape shape{2, 3};
+    auto A = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6});
+    auto B = op::v0::Constant::create(element::i8, Shape{3}, {-1, 0, 1});
+    auto P = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::v1::Add>(make_shared<op::v1::Add>(P, A), A);
+    auto f = make_shared<Function>(OutputVector{sum, B}, ParameterVector{P});
+
+    serialize_binary(tmp_file, f);
+    // deserialize detects the binary format
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    file_util::remove_file(tmp_file);
+    EXPECT_TRUE(StructuralHash().functions_equal(f, g));
+
+    size_t count = 0;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        if (auto c = as_type_ptr<op::v0::Constant>(node))
+        {
+            count++;
+            EXPECT_EQ(reinterpret_cast<size_t>(c->get_data_ptr()) % 64, 0);
+            if (c->get_output_element_type(0) == element::f32)
+            {
+                EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6}), c->get_vector<float>());
+            }
+            else
+            {
+                EXPECT_EQ((vector<int8_t>{-1, 0, 1}), c->get_vector<int8_t>());
+            }
+        }
+    }
+    EXPECT_EQ(count, 2);
+}
+
+TEST(serialize, packed_constant)
+{
+    auto A = op::v0::Constant::create(element::u4, Shape{2, 3}, {0, 1, 2, 13, 14, 15});
+    auto B = op::v0::Constant::create(element::i4, Shape{3}, {-8, 0, 7});
+    auto C = op::v0::Constant::create(element::u1, Shape{9}, {1, 0, 0, 1, 1, 0, 1, 0, 1});
+    auto f = make_shared<Function>(OutputVector{A, B, C}, ParameterVector{});
+
+    const string tmp_file = file_util::tmp_filename("ngraph");
+    serialize_binary(tmp_file, f);
+    for (auto g : {deserialize(serialize(f)), deserialize(tmp_file)})
+    {
+        ASSERT_NE(g, nullptr);
+        size_t count = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = as_type_ptr<op::v0::Constant>(node))
+            {
+                count++;
+                auto type = c->get_output_element_type(0);
+                if (type == element::u4)
+                {
+                    EXPECT_EQ((vector<uint8_t>{0, 1, 2, 13, 14, 15}), c->get_vector<uint8_t>());
+                }
+                else if (type == element::i4)
+                {
+                    EXPECT_EQ((vector<int8_t>{-8, 0, 7}), c->get_vector<int8_t>());
+                }
+                else
+                {
+                    EXPECT_EQ(type, element::u1);
+                    EXPECT_EQ((vector<uint8_t>{1, 0, 0, 1, 1, 0, 1, 0, 1}),
+                              c->get_vector<uint8_t>());
+                }
+            }
+        }
+        EXPECT_EQ(count, 3);
+    }
+    file_util::remove_file(tmp_file);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
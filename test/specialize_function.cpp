@@ -362,3 +362,40 @@ TEST(specialize_function, share_constants_with_cf)
     ASSERT_EQ(add_const_1->get_output_target_inputs(0).size(), 1);
     ASSERT_EQ(add_const_2->get_output_target_inputs(0).size(), 1);
 }
+
+// Elementwise ops and reductions over constant axes do not depend on the parameter shapes.
+TEST(specialize_function, shape_polymorphic)
+{
+    auto p0 =
+        std::make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+    auto p1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{4});
+    auto add = std::make_shared<op::v1::Add>(p0, p1);
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {1});
+    auto sum = std::make_shared<op::v1::ReduceSum>(add, axes);
+
+    auto f = std::make_shared<Function>(sum, ParameterVector{p0, p1});
+
+    ASSERT_TRUE(is_shape_polymorphic(f));
+
+    auto g = rebind_function(f, {Shape{3, 4}, Shape{4}});
+    ASSERT_TRUE(g != nullptr);
+    ASSERT_EQ(g->get_output_shape(0), (Shape{3}));
+
+    auto h = rebind_function(g, {Shape{7, 4}, Shape{4}});
+    ASSERT_TRUE(h != nullptr);
+    ASSERT_EQ(h->get_output_shape(0), (Shape{7}));
+
+    // Incompatible shapes fail validation
+    ASSERT_TRUE(rebind_function(f, {Shape{3, 5}, Shape{4}}) == nullptr);
+}
+
+// A v0 Reshape has its output shape baked into the op.
+TEST(specialize_function, shape_polymorphic_reshape)
+{
+    auto p0 = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto reshape = std::make_shared<op::v0::Reshape>(p0, AxisVector{0, 1}, Shape{6});
+
+    auto f = std::make_shared<Function>(reshape, ParameterVector{p0});
+
+    ASSERT_FALSE(is_shape_polymorphic(f));
+}
@@ -0,0 +1,161 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+#include "ngraph/structural_hash.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Function> make_conv_function(const Strides& strides, float bias_value)
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 8, 8});
+    auto filters = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto conv = make_shared<op::v0::Convolution>(data, filters, strides);
+    Shape conv_shape = conv->get_output_shape(0);
+    auto bias = op::v0::Constant::create(
+        element::f32, conv_shape, vector<float>(shape_size(conv_shape), bias_value));
+    auto add = make_shared<op::v1::Add>(conv, bias);
+    return make_shared<Function>(OutputVector{add}, ParameterVector{data, filters});
+}
+
+TEST(structural_hash, identical_functions)
+{
+    StructuralHash hasher;
+    auto f1 = make_conv_function(Strides{1, 1}, 1.0f);
+    auto f2 = make_conv_function(Strides{1, 1}, 1.0f);
+    EXPECT_EQ(hasher.get_function_hash(f1), hasher.get_function_hash(f2));
+    EXPECT_TRUE(hasher.functions_equal(f1, f2));
+
+    // Hashes must not depend on any per-process state
+    StructuralHash other_hasher;
+    EXPECT_EQ(hasher.get_function_hash(f1), other_hasher.get_function_hash(f2));
+}
+
+TEST(structural_hash, attributes_differ)
+{
+    StructuralHash hasher;
+    auto f1 = make_conv_function(Strides{1, 1}, 1.0f);
+    auto f2 = make_conv_function(Strides{2, 2}, 1.0f);
+    EXPECT_NE(hasher.get_function_hash(f1), hasher.get_function_hash(f2));
+    EXPECT_FALSE(hasher.functions_equal(f1, f2));
+}
+
+TEST(structural_hash, constant_data_differs)
+{
+    StructuralHash hasher;
+    auto f1 = make_conv_function(Strides{1, 1}, 1.0f);
+    auto f2 = make_conv_function(Strides{1, 1}, 2.0f);
+    EXPECT_NE(hasher.get_function_hash(f1), hasher.get_function_hash(f2));
+    EXPECT_FALSE(hasher.functions_equal(f1, f2));
+}
+
+TEST(structural_hash, parameter_order)
+{
+    StructuralHash hasher;
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto f1 = make_shared<Function>(make_shared<op::v1::Subtract>(a, b), ParameterVector{a, b});
+    auto f2 = make_shared<Function>(make_shared<op::v1::Subtract>(b, a), ParameterVector{a, b});
+    EXPECT_NE(hasher.get_function_hash(f1), hasher.get_function_hash(f2));
+    EXPECT_FALSE(hasher.functions_equal(f1, f2));
+
+    // Add is commutative, so the order of its inputs does not matter
+    auto f3 = make_shared<Function>(make_shared<op::v1::Add>(a, b), ParameterVector{a, b});
+    auto f4 = make_shared<Function>(make_shared<op::v1::Add>(b, a), ParameterVector{a, b});
+    EXPECT_EQ(hasher.get_function_hash(f3), hasher.get_function_hash(f4));
+    EXPECT_TRUE(hasher.functions_equal(f3, f4));
+}
+
+TEST(structural_hash, node_hash_includes_inputs)
+{
+    StructuralHash hasher;
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto abs1 = make_shared<op::v0::Abs>(a);
+    auto abs2 = make_shared<op::v0::Abs>(a);
+    auto neg = make_shared<op::v0::Negative>(a);
+    auto abs_abs = make_shared<op::v0::Abs>(abs1);
+    auto abs_neg = make_shared<op::v0::Abs>(neg);
+
+    EXPECT_EQ(hasher.get_node_hash(abs1), hasher.get_node_hash(abs2));
+    EXPECT_EQ(hasher.get_attribute_hash(abs_abs), hasher.get_attribute_hash(abs_neg));
+    EXPECT_NE(hasher.get_node_hash(abs_abs), hasher.get_node_hash(abs_neg));
+    EXPECT_TRUE(hasher.attributes_equal(abs_abs, abs_neg));
+}
+
+namespace
+{
+    // The cache only stores executables, so one that cannot be called is enough here
+    class NullExecutable : public runtime::Executable
+    {
+    public:
+        bool call(const vector<shared_ptr<runtime::Tensor>>& /* outputs */,
+                  const vector<shared_ptr<runtime::Tensor>>& /* inputs */) override
+        {
+            return false;
+        }
+    };
+}
+
+// Executables are only shared between structurally equal functions, even if their hashes collide
+TEST(structural_hash, executable_cache_collision)
+{
+    runtime::ExecutableCache cache;
+    auto f1 = make_conv_function(Strides{1, 1}, 1.0f);
+    auto f2 = make_conv_function(Strides{2, 2}, 1.0f);
+    shared_ptr<runtime::Executable> exec = make_shared<NullExecutable>();
+
+    size_t colliding_hash = 42;
+    cache.add_structural_entry(colliding_hash, exec, f1);
+    EXPECT_EQ(cache.get_structural_entry(colliding_hash, make_conv_function(Strides{1, 1}, 1.0f)),
+              exec);
+    EXPECT_EQ(cache.get_structural_entry(colliding_hash, f2), nullptr);
+
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+    auto f3 = make_shared<Function>(make_shared<op::v0::Abs>(a), ParameterVector{a});
+    auto f4 = make_shared<Function>(make_shared<op::v0::Abs>(b), ParameterVector{b});
+    cache.add_structural_entry(colliding_hash, exec, f3);
+    EXPECT_EQ(cache.get_structural_entry(colliding_hash, f4), nullptr);
+}
+
+// Evicting the last shape entry of an executable also drops the Function kept for it
+TEST(structural_hash, executable_cache_eviction)
+{
+    set_environment("NGRAPH_CACHE_SIZE", "1", 1);
+    runtime::ExecutableCache cache;
+    unset_environment("NGRAPH_CACHE_SIZE");
+
+    auto f1 = make_conv_function(Strides{1, 1}, 1.0f);
+    auto f2 = make_conv_function(Strides{2, 2}, 1.0f);
+    shared_ptr<runtime::Executable> exec1 = make_shared<NullExecutable>();
+    shared_ptr<runtime::Executable> exec2 = make_shared<NullExecutable>();
+
+    cache.add_structural_entry(1, exec1, f1);
+    cache.add_entry({1}, exec1, f1);
+    EXPECT_EQ(cache.get_structural_entry(1, f1), exec1);
+
+    cache.add_structural_entry(2, exec2, f2);
+    cache.add_entry({2}, exec2, f2);
+    EXPECT_EQ(cache.get_structural_entry(1, f1), nullptr);
+    EXPECT_EQ(f1.use_count(), 1);
+    EXPECT_EQ(cache.get_structural_entry(2, f2), exec2);
+}